@@ -35,6 +35,7 @@ endif()
 
 find_package(Charm ${SPECTRE_REQUIRED_CHARM_VERSION} REQUIRED
   COMPONENTS
+  CkLoop
   EveryLB
   ${SCOTCHLB_COMPONENT}
   )
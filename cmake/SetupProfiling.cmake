@@ -3,10 +3,14 @@
 
 option(ENABLE_PROFILING "Enables various options to make profiling easier" OFF)
 
+option(ENABLE_TRACING
+  "Compile in the low-overhead tracing of hot code paths (see tracing::)" ON)
+
 option(KEEP_FRAME_POINTER "Add keep frame pointer for profiling" OFF)
 
 add_library(Profiling::KeepFramePointer IMPORTED INTERFACE)
 add_library(Profiling::EnableProfiling IMPORTED INTERFACE)
+add_library(Profiling::EnableTracing IMPORTED INTERFACE)
 
 if (KEEP_FRAME_POINTER OR ENABLE_PROFILING)
   set_property(
@@ -27,9 +31,19 @@ if (ENABLE_PROFILING)
     )
 endif()
 
+if (ENABLE_TRACING)
+  set_property(
+    TARGET Profiling::EnableTracing
+    APPEND PROPERTY
+    INTERFACE_COMPILE_DEFINITIONS
+    $<$<COMPILE_LANGUAGE:CXX>:SPECTRE_TRACING>
+    )
+endif()
+
 target_link_libraries(
   SpectreFlags
   INTERFACE
   Profiling::EnableProfiling
+  Profiling::EnableTracing
   Profiling::KeepFramePointer
   )
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 #include "ControlSystem/Averager.hpp"
 #include "ControlSystem/CalculateMeasurementTimescales.hpp"
@@ -31,6 +32,7 @@
 #include "Utilities/MakeString.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace domain::Tags {
@@ -92,7 +94,10 @@ namespace control_system {
  *    `control_system::Tags::MeasurementTimescales`. Call the
  *    `control_system::AggregateUpdate` simple action on the first control
  *    system in the `component_list` of the metavariables. This simple action
- *    will mutate the global cache tags when it has enough data.
+ *    will mutate the global cache tags when it has enough data. When tracing
+ *    is enabled, the wall time at which this measurement started being
+ *    processed is passed along so that the latency of the update can be
+ *    traced on each node (see `control_system::UpdateMultipleFunctionsOfTime`).
  */
 template <typename ControlSystem>
 struct UpdateControlSystem {
@@ -104,6 +109,12 @@ struct UpdateControlSystem {
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/, const double time,
                     tuples::TaggedTuple<TupleTags...> data) {
+#ifdef SPECTRE_TRACING
+    const std::int64_t measurement_wall_time =
+        tracing::enabled() ? tracing::system_clock_now() : -1;
+#else
+    const std::int64_t measurement_wall_time = -1;
+#endif  // SPECTRE_TRACING
     const std::string& function_of_time_name = ControlSystem::name();
 
     // Begin step 1
@@ -284,7 +295,8 @@ struct UpdateControlSystem {
     Parallel::simple_action<AggregateUpdate<ControlSystem>>(
         first_control_system_proxy, new_measurement_timescale,
         current_measurement_expiration_time, new_measurement_expiration_time,
-        control_signal, current_fot_expiration_time, new_fot_expiration_time);
+        control_signal, current_fot_expiration_time, new_fot_expiration_time,
+        measurement_wall_time);
   }
 };
 }  // namespace control_system
@@ -3,6 +3,7 @@
 
 #include "ControlSystem/UpdateFunctionOfTime.hpp"
 
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <pup.h>
@@ -16,6 +17,7 @@
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Tracing.hpp"
 
 namespace control_system {
 void UpdateSingleFunctionOfTime::apply(
@@ -35,7 +37,8 @@ void UpdateMultipleFunctionsOfTime::apply(
         f_of_t_list,
     const double update_time,
     const std::unordered_map<std::string, std::pair<DataVector, double>>&
-        update_args) {
+        update_args,
+    const std::int64_t /*measurement_wall_time*/) {
   for (auto& [f_of_t_name, update_deriv_and_expr_time] : update_args) {
     UpdateSingleFunctionOfTime::apply(f_of_t_list, f_of_t_name, update_time,
                                       update_deriv_and_expr_time.first,
@@ -43,6 +46,21 @@ void UpdateMultipleFunctionsOfTime::apply(
   }
 }
 
+void UpdateMultipleFunctionsOfTime::mutation_complete(
+    const double /*update_time*/,
+    const std::unordered_map<std::string, std::pair<DataVector, double>>&
+    /*update_args*/,
+    const std::int64_t measurement_wall_time) {
+#ifdef SPECTRE_TRACING
+  if (measurement_wall_time >= 0 and tracing::enabled()) {
+    tracing::record_since("ControlSystem::UpdateLatency",
+                          measurement_wall_time);
+  }
+#else
+  (void)measurement_wall_time;
+#endif  // SPECTRE_TRACING
+}
+
 UpdateAggregator::UpdateAggregator(
     std::string combined_name,
     std::unordered_set<std::string> active_control_system_names)
@@ -53,7 +71,8 @@ void UpdateAggregator::insert(const std::string& control_system_name,
                               const DataVector& new_measurement_timescale,
                               const double new_measurement_expiration_time,
                               DataVector control_signal,
-                              const double new_fot_expiration_time) {
+                              const double new_fot_expiration_time,
+                              const std::int64_t measurement_wall_time) {
   ASSERT(expiration_times_.count(control_system_name) == 0,
          "Already received expiration time data for control system '"
              << control_system_name << "'.");
@@ -62,6 +81,14 @@ void UpdateAggregator::insert(const std::string& control_system_name,
              << control_system_name << "'. Active control systems are "
              << active_names_);
 
+  if (expiration_times_.empty()) {
+    earliest_measurement_wall_time_ = -1;
+  }
+  if (measurement_wall_time >= 0 and
+      (earliest_measurement_wall_time_ < 0 or
+       measurement_wall_time < earliest_measurement_wall_time_)) {
+    earliest_measurement_wall_time_ = measurement_wall_time;
+  }
   expiration_times_[control_system_name] = std::make_pair(
       std::make_pair(std::move(control_signal), new_fot_expiration_time),
       std::make_pair(min(new_measurement_timescale),
@@ -129,6 +156,13 @@ UpdateAggregator::combined_measurement_expiration_time() {
   return std::make_pair(min_measurement_timescale, min_expiration_time);
 }
 
+std::int64_t UpdateAggregator::earliest_measurement_wall_time() const {
+  ASSERT(is_ready(),
+         "Trying to get the earliest measurement wall time, but have not "
+         "received data from all control systems.");
+  return earliest_measurement_wall_time_;
+}
+
 void UpdateAggregator::pup(PUP::er& p) {
   p | expiration_times_;
   p | active_names_;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <pup.h>
 #include <string>
@@ -53,6 +54,12 @@ struct UpdateSingleFunctionOfTime {
  * The value `std::pair<DataVector, double>` for each key is the updated
  * derivative for the function of time and the new expiration time,
  * respectively.
+ *
+ * The `measurement_wall_time` is the wall time, as returned by
+ * `tracing::system_clock_now()`, at which the measurement that triggered the
+ * update was processed, or -1 if it wasn't taken. Once the mutation and its
+ * callbacks are done on a node, `mutation_complete` traces the time since
+ * then as the event `ControlSystem::UpdateLatency` (see `tracing`).
  */
 struct UpdateMultipleFunctionsOfTime {
   static void apply(
@@ -62,7 +69,14 @@ struct UpdateMultipleFunctionsOfTime {
           f_of_t_list,
       double update_time,
       const std::unordered_map<std::string, std::pair<DataVector, double>>&
-          update_args);
+          update_args,
+      std::int64_t measurement_wall_time);
+
+  static void mutation_complete(
+      double update_time,
+      const std::unordered_map<std::string, std::pair<DataVector, double>>&
+          update_args,
+      std::int64_t measurement_wall_time);
 };
 
 /*!
@@ -100,11 +114,15 @@ struct UpdateAggregator {
    * calculated during that update (will be `std::move`ed).
    * \param new_fot_expiration_time New function of time expiration time
    * calculated for during that update
+   * \param measurement_wall_time Wall time, as returned by
+   * `tracing::system_clock_now()`, at which the control system processed the
+   * measurement, or -1 if it wasn't taken
    */
   void insert(const std::string& control_system_name,
               const DataVector& new_measurement_timescale,
               double new_measurement_expiration_time, DataVector control_signal,
-              double new_fot_expiration_time);
+              double new_fot_expiration_time,
+              std::int64_t measurement_wall_time);
 
   /*!
    * \brief Checks if `insert` has been called for all control systems that this
@@ -143,6 +161,17 @@ struct UpdateAggregator {
    */
   std::pair<double, double> combined_measurement_expiration_time();
 
+  /*!
+   * \brief Once `is_ready` is true, returns the earliest
+   * `measurement_wall_time` passed to `insert` that isn't -1, or -1 if there
+   * is none.
+   *
+   * \details This must be called before `combined_measurement_expiration_time`.
+   * The wall times are not serialized, so an update interrupted by a migration
+   * is not traced.
+   */
+  std::int64_t earliest_measurement_wall_time() const;
+
   /// \cond
   void pup(PUP::er& p);
   /// \endcond
@@ -153,6 +182,7 @@ struct UpdateAggregator {
       expiration_times_{};
   std::unordered_set<std::string> active_names_{};
   std::string combined_name_{};
+  std::int64_t earliest_measurement_wall_time_ = -1;
 };
 
 /*!
@@ -168,7 +198,10 @@ struct UpdateAggregator {
  *
  * When the `UpdateAggregator::is_ready`, the measurement timescale is mutated
  * with `UpdateSingleFunctionOfTime` and the functions of time are mutated with
- * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`.
+ * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`. The
+ * `measurement_wall_time` is passed to `UpdateMultipleFunctionsOfTime` so
+ * that each node traces the latency from the measurement to the update of
+ * its functions of time.
  *
  * The "appropriate" `UpdateAggregator` is chosen from the
  * `control_system::Tags::SystemToCombinedNames` for the templated
@@ -186,7 +219,8 @@ struct AggregateUpdate {
                     const double new_measurement_expiration_time,
                     DataVector control_signal,
                     const double old_fot_expiration_time,
-                    const double new_fot_expiration_time) {
+                    const double new_fot_expiration_time,
+                    const std::int64_t measurement_wall_time) {
     auto& aggregators =
         db::get_mutable_reference<Tags::UpdateAggregators>(make_not_null(&box));
     const auto& system_to_combined_names =
@@ -209,12 +243,15 @@ struct AggregateUpdate {
 
     aggregator.insert(control_system_name, new_measurement_timescale,
                       new_measurement_expiration_time,
-                      std::move(control_signal), new_fot_expiration_time);
+                      std::move(control_signal), new_fot_expiration_time,
+                      measurement_wall_time);
 
     if (aggregator.is_ready()) {
       std::unordered_map<std::string, std::pair<DataVector, double>>
           combined_fot_expiration_times =
               aggregator.combined_fot_expiration_times();
+      const std::int64_t earliest_measurement_wall_time =
+          aggregator.earliest_measurement_wall_time();
       const std::pair<double, double> combined_measurement_expiration_time =
           aggregator.combined_measurement_expiration_time();
 
@@ -226,7 +263,8 @@ struct AggregateUpdate {
       Parallel::mutate<::domain::Tags::FunctionsOfTime,
                        UpdateMultipleFunctionsOfTime>(
           cache, old_fot_expiration_time,
-          std::move(combined_fot_expiration_times));
+          std::move(combined_fot_expiration_times),
+          earliest_measurement_wall_time);
     }
   }
 };
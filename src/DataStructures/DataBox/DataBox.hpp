@@ -360,6 +360,10 @@ class DataBox<tmpl::list<Tags...>> : public Access,
   // clang-tidy: redundant declaration
   friend auto copy_items(const DataBox<DbTagList>& box);
 
+  template <typename MovedItemsTagList, typename DbTagList>
+  // clang-tidy: redundant declaration
+  friend auto move_items(gsl::not_null<DataBox<DbTagList>*> box);
+
   template <typename... MutateTags, typename TagList, typename Invokable,
             typename... Args>
   // clang-tidy: redundant declaration
@@ -441,6 +445,12 @@ class DataBox<tmpl::list<Tags...>> : public Access,
   tuples::TaggedTuple<CopiedItemsTags...> copy_items(
       tmpl::list<CopiedItemsTags...> /*meta*/) const;
 
+  // move items corresponding to MovedItemsTags
+  // from the DataBox to a TaggedTuple
+  template <typename... MovedItemsTags>
+  tuples::TaggedTuple<MovedItemsTags...> move_items(
+      tmpl::list<MovedItemsTags...> /*meta*/);
+
   template <typename ParentTag>
   constexpr void add_mutable_subitems_to_box(tmpl::list<> /*meta*/) {}
 
@@ -1283,6 +1293,22 @@ DataBox<tmpl::list<DbTags...>>::copy_items(
   return tuples::TaggedTuple<CopiedItemsTags...>{
       copy_item<CopiedItemsTags>()...};
 }
+
+template <typename... DbTags>
+template <typename... MovedItemsTags>
+tuples::TaggedTuple<MovedItemsTags...>
+DataBox<tmpl::list<DbTags...>>::move_items(
+    tmpl::list<MovedItemsTags...> /*meta*/) {
+  static_assert(
+      (tmpl::list_contains_v<
+           mutable_item_creation_tags,
+           detail::first_matching_tag<tags_list, MovedItemsTags>> and
+       ...),
+      "Can only move mutable creation items");
+  return tuples::TaggedTuple<MovedItemsTags...>{std::move(
+      get_item<detail::first_matching_tag<tags_list, MovedItemsTags>>()
+          .mutate())...};
+}
 /// \endcond
 
 /*!
@@ -1299,6 +1325,36 @@ SPECTRE_ALWAYS_INLINE auto copy_items(const DataBox<DbTagList>& box) {
   return box.copy_items(CopiedItemsTagList{});
 }
 
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Move the items from the DataBox into a TaggedTuple
+ *
+ * \details Unlike `db::copy_items`, which makes a deep copy of each item by
+ * serializing and deserializing it, this moves the items out of the DataBox,
+ * so large buffers (e.g. the data of `Variables`) are handed over without
+ * being copied. This is intended for elements that are about to be destroyed,
+ * such as the parent and children elements during adaptive mesh refinement.
+ *
+ * \return The objects corresponding to MovedItemsTagList
+ *
+ * \warning The moved-from items (and any compute items, reference items or
+ * subitems that depend on them) are left in a valid but unspecified state.
+ * The DataBox must not be used afterward, except to be destroyed.
+ *
+ * \note The tags in MovedItemsTagList must be a subset of
+ * the mutable_item_creation_tags of the DataBox
+ *
+ * \note Moving only saves the copy made before the items are sent. The items
+ * are still serialized when they are passed to a simple action. Elements that
+ * the load balancer migrates are serialized as a whole with their `pup`
+ * function, so no items are copied before that and this doesn't apply.
+ */
+template <typename MovedItemsTagList, typename DbTagList>
+SPECTRE_ALWAYS_INLINE auto move_items(
+    const gsl::not_null<DataBox<DbTagList>*> box) {
+  return box->move_items(MovedItemsTagList{});
+}
+
 ////////////////////////////////////////////////////////////////
 // Get mutable reference from the DataBox
 /// \cond
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/SliceLayout.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <numeric>
+
+#include "DataStructures/Index.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Literals.hpp"
+
+template <size_t Dim>
+SliceLayout::SliceLayout(const Index<Dim>& extents, const size_t fixed_dim,
+                         const size_t fixed_index)
+    : run_length_(std::accumulate(extents.begin(),
+                                  extents.begin() + fixed_dim, 1_st,
+                                  std::multiplies<size_t>())),
+      number_of_runs_(std::accumulate(extents.begin() + fixed_dim + 1,
+                                      extents.end(), 1_st,
+                                      std::multiplies<size_t>())),
+      run_stride_(run_length_ * extents[fixed_dim]),
+      initial_offset_(fixed_index * run_length_) {
+  ASSERT(fixed_dim < Dim, "Cannot slice dimension " << fixed_dim << " of a "
+                                                    << Dim << "D mesh.");
+  ASSERT(fixed_index < extents[fixed_dim],
+         "Cannot slice at index " << fixed_index << " of dimension "
+                                  << fixed_dim << " with extents " << extents);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define INSTANTIATION(r, data)                                             \
+  template SliceLayout::SliceLayout(const Index<DIM(data)>&, const size_t, \
+                                    const size_t);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATION
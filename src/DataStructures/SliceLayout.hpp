@@ -0,0 +1,126 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+template <size_t>
+class Index;
+/// \endcond
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief The points of a (dim-1)-dimensional slice of volume data, and
+ * kernels to copy data between the volume and the slice
+ *
+ * \details The points of the slice at `fixed_index` in dimension `fixed_dim`
+ * are `number_of_runs()` runs of `run_length()` consecutive volume points, with
+ * the runs `run_stride()` volume points apart. The slice points are stored in
+ * the same order, so a run is also contiguous in the slice. This replaces the
+ * index table built by `SliceIterator` or `volume_and_slice_indices()` by four
+ * integers, which are cheap enough to compute for every slice.
+ *
+ * The kernels loop over the tensor components in the outer loop and over the
+ * runs in the inner loop, so every run is a contiguous (vectorizable) copy.
+ * For `fixed_dim` 0 the runs are single points, so the volume data is read
+ * with a constant stride while the slice is still written contiguously.
+ *
+ * The `component_stride` arguments are the distances between consecutive
+ * components in memory, i.e. the number of grid points for a `Variables`.
+ */
+class SliceLayout {
+ public:
+  /*!
+   * @param extents the number of grid points in each dimension
+   * @param fixed_dim the dimension to slice in
+   * @param fixed_index the index of the `fixed_dim` to slice at
+   */
+  template <size_t Dim>
+  SliceLayout(const Index<Dim>& extents, size_t fixed_dim, size_t fixed_index);
+
+  size_t run_length() const { return run_length_; }
+  size_t number_of_runs() const { return number_of_runs_; }
+  size_t run_stride() const { return run_stride_; }
+  /// Offset of the first point of the slice in the volume data
+  size_t initial_offset() const { return initial_offset_; }
+  size_t number_of_slice_points() const {
+    return run_length_ * number_of_runs_;
+  }
+
+  /// Copies `number_of_components` components of the volume data onto the
+  /// slice
+  template <typename T>
+  void gather(gsl::not_null<T*> slice_data, size_t slice_component_stride,
+              const T* volume_data, size_t volume_component_stride,
+              size_t number_of_components) const;
+
+  /// Adds `number_of_components` components of the slice data to the volume
+  /// data on the slice
+  template <typename T>
+  void add_to_volume(gsl::not_null<T*> volume_data,
+                     size_t volume_component_stride, const T* slice_data,
+                     size_t slice_component_stride,
+                     size_t number_of_components) const;
+
+ private:
+  size_t run_length_ = std::numeric_limits<size_t>::max();
+  size_t number_of_runs_ = std::numeric_limits<size_t>::max();
+  size_t run_stride_ = std::numeric_limits<size_t>::max();
+  size_t initial_offset_ = std::numeric_limits<size_t>::max();
+};
+
+template <typename T>
+void SliceLayout::gather(const gsl::not_null<T*> slice_data,
+                         const size_t slice_component_stride,
+                         const T* const volume_data,
+                         const size_t volume_component_stride,
+                         const size_t number_of_components) const {
+  // clang-tidy: do not use pointer arithmetic
+  for (size_t i = 0; i < number_of_components; ++i) {
+    T* const slice_component =
+        slice_data.get() + i * slice_component_stride;  // NOLINT
+    const T* const volume_component =
+        volume_data + i * volume_component_stride + initial_offset_;  // NOLINT
+    if (run_length_ == 1) {
+      for (size_t run = 0; run < number_of_runs_; ++run) {
+        slice_component[run] = volume_component[run * run_stride_];  // NOLINT
+      }
+    } else {
+      for (size_t run = 0; run < number_of_runs_; ++run) {
+        std::copy_n(volume_component + run * run_stride_,  // NOLINT
+                    run_length_,
+                    slice_component + run * run_length_);  // NOLINT
+      }
+    }
+  }
+}
+
+template <typename T>
+void SliceLayout::add_to_volume(const gsl::not_null<T*> volume_data,
+                                const size_t volume_component_stride,
+                                const T* const slice_data,
+                                const size_t slice_component_stride,
+                                const size_t number_of_components) const {
+  // clang-tidy: do not use pointer arithmetic
+  for (size_t i = 0; i < number_of_components; ++i) {
+    T* const volume_component = volume_data.get() +
+                                i * volume_component_stride +  // NOLINT
+                                initial_offset_;
+    const T* const slice_component =
+        slice_data + i * slice_component_stride;  // NOLINT
+    for (size_t run = 0; run < number_of_runs_; ++run) {
+      T* const volume_run = volume_component + run * run_stride_;  // NOLINT
+      const T* const slice_run =
+          slice_component + run * run_length_;  // NOLINT
+      for (size_t j = 0; j < run_length_; ++j) {
+        volume_run[j] += slice_run[j];  // NOLINT
+      }
+    }
+  }
+}
@@ -8,7 +8,7 @@
 #include <cstddef>
 
 #include "DataStructures/Index.hpp"
-#include "DataStructures/SliceIterator.hpp"
+#include "DataStructures/SliceLayout.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/Gsl.hpp"
@@ -30,26 +30,28 @@ void data_on_slice(
     const gsl::not_null<Variables<tmpl::list<TagsToSlice...>>*> interface_vars,
     const Index<VolumeDim>& element_extents, const size_t sliced_dim,
     const size_t fixed_index, const typename TagsToSlice::type&... tensors) {
-  const size_t interface_grid_points =
-      element_extents.slice_away(sliced_dim).product();
+  const SliceLayout slice_layout(element_extents, sliced_dim, fixed_index);
+  const size_t interface_grid_points = slice_layout.number_of_slice_points();
   if (interface_vars->number_of_grid_points() != interface_grid_points) {
     *interface_vars =
         Variables<tmpl::list<TagsToSlice...>>(interface_grid_points);
   }
-  for (SliceIterator si(element_extents, sliced_dim, fixed_index); si; ++si) {
-    const auto lambda = [&si](auto& interface_tensor,
-                              const auto& volume_tensor) {
-      for (decltype(auto) interface_and_volume_tensor_components :
-           boost::combine(interface_tensor, volume_tensor)) {
-        boost::get<0>(
-            interface_and_volume_tensor_components)[si.slice_offset()] =
-            boost::get<1>(
-                interface_and_volume_tensor_components)[si.volume_offset()];
-      }
-      return '0';
-    };
-    expand_pack(lambda(get<TagsToSlice>(*interface_vars), tensors)...);
-  }
+  // The volume tensor components need not be contiguous, so slice them one at
+  // a time.
+  const auto lambda = [&slice_layout](auto& interface_tensor,
+                                      const auto& volume_tensor) {
+    for (decltype(auto) interface_and_volume_tensor_components :
+         boost::combine(interface_tensor, volume_tensor)) {
+      const auto& volume_component =
+          boost::get<1>(interface_and_volume_tensor_components);
+      slice_layout.gather(
+          make_not_null(
+              boost::get<0>(interface_and_volume_tensor_components).data()),
+          0, volume_component.data(), 0, 1);
+    }
+    return '0';
+  };
+  expand_pack(lambda(get<TagsToSlice>(*interface_vars), tensors)...);
 }
 
 template <typename... TagsToSlice, size_t VolumeDim>
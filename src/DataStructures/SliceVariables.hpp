@@ -7,7 +7,7 @@
 #include <ostream>
 
 #include "DataStructures/Index.hpp"
-#include "DataStructures/SliceIterator.hpp"
+#include "DataStructures/SliceLayout.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -32,26 +32,18 @@ void data_on_slice(const gsl::not_null<Variables<TagsList>*> interface_vars,
                    const Variables<TagsList>& vars,
                    const Index<VolumeDim>& element_extents,
                    const size_t sliced_dim, const size_t fixed_index) {
-  const size_t interface_grid_points =
-      element_extents.slice_away(sliced_dim).product();
-  const size_t volume_grid_points = vars.number_of_grid_points();
+  const SliceLayout slice_layout(element_extents, sliced_dim, fixed_index);
+  const size_t interface_grid_points = slice_layout.number_of_slice_points();
   constexpr const size_t number_of_independent_components =
       Variables<TagsList>::number_of_independent_components;
 
   if (interface_vars->number_of_grid_points() != interface_grid_points) {
     *interface_vars = Variables<TagsList>(interface_grid_points);
   }
-  using value_type = typename Variables<TagsList>::value_type;
-  const value_type* vars_data = vars.data();
-  value_type* interface_vars_data = interface_vars->data();
-  for (SliceIterator si(element_extents, sliced_dim, fixed_index); si; ++si) {
-    for (size_t i = 0; i < number_of_independent_components; ++i) {
-      // clang-tidy: do not use pointer arithmetic
-      interface_vars_data[si.slice_offset() +                      // NOLINT
-                          i * interface_grid_points] =             // NOLINT
-          vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
-    }
-  }
+  slice_layout.gather(make_not_null(interface_vars->data()),
+                      interface_vars->number_of_grid_points(), vars.data(),
+                      vars.number_of_grid_points(),
+                      number_of_independent_components);
 }
 
 template <std::size_t VolumeDim, typename TagsList>
@@ -103,14 +95,9 @@ void add_slice_to_data(
          "vars_on_slice has wrong number of grid points.  Expected "
              << slice_grid_points << ", got "
              << vars_on_slice.number_of_grid_points());
-  using value_type = typename Variables<tmpl::list<VolumeTags...>>::value_type;
-  value_type* const volume_data = volume_vars->data();
-  const value_type* const slice_data = vars_on_slice.data();
-  for (SliceIterator si(extents, sliced_dim, fixed_index); si; ++si) {
-    for (size_t i = 0; i < number_of_independent_components; ++i) {
-      // clang-tidy: do not use pointer arithmetic
-      volume_data[si.volume_offset() + i * volume_grid_points] +=  // NOLINT
-          slice_data[si.slice_offset() + i * slice_grid_points];   // NOLINT
-    }
-  }
+  SliceLayout(extents, sliced_dim, fixed_index)
+      .add_to_volume(make_not_null(volume_vars->data()),
+                     volume_vars->number_of_grid_points(), vars_on_slice.data(),
+                     vars_on_slice.number_of_grid_points(),
+                     number_of_independent_components);
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -17,6 +18,7 @@
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace determinant_and_inverse_detail {
@@ -338,6 +340,82 @@ struct DetAndInverseImpl<Symmetry<1, 1>, Index0, Index0,
     get(*det) *= det_inv_x;
   }
 };
+
+// For `DataVector`s of 3x3 and 4x4 tensors, the expressions above create a
+// `DataVector` temporary for every cofactor and partitioned block, so the
+// computation is limited by memory traffic rather than by floating point
+// operations. Instead, we load the independent components of a SIMD batch of
+// points (or of a single point for the remainder) into a stack-allocated
+// `Tensor`, run the same algorithm on it in registers, and write the
+// determinant and inverse directly into the output.
+template <typename Symm, typename Index0, typename Index1>
+struct PointwiseDetAndInverseImpl {
+  static void apply(
+      const gsl::not_null<Scalar<DataVector>*> det,
+      const gsl::not_null<
+          Tensor<DataVector, Symm, inverse_indices<Index0, Index1>>*>
+          inv,
+      const Tensor<DataVector, Symm, tmpl::list<Index0, Index1>>& tensor) {
+    const size_t number_of_points = get<0, 0>(tensor).size();
+    const auto kernel = [&det, &inv, &tensor](const size_t grid_index,
+                                              auto use_simd) {
+      (void)use_simd;
+      constexpr bool is_simd = std::decay_t<decltype(use_simd)>::value;
+      using SimdType =
+          tmpl::conditional_t<is_simd, simd::batch<double>, double>;
+      Tensor<SimdType, Symm, tmpl::list<Index0, Index1>> local_tensor{};
+      for (size_t i = 0; i < tensor.size(); ++i) {
+        if constexpr (is_simd) {
+          local_tensor[i] = simd::load_unaligned(&tensor[i][grid_index]);
+        } else {
+          local_tensor[i] = tensor[i][grid_index];
+        }
+      }
+      Scalar<SimdType> local_det{};
+      Tensor<SimdType, Symm, inverse_indices<Index0, Index1>> local_inv{};
+      DetAndInverseImpl<Symm, Index0, Index1>::apply(
+          make_not_null(&local_det), make_not_null(&local_inv), local_tensor);
+      if constexpr (is_simd) {
+        simd::store_unaligned(&get(*det)[grid_index], get(local_det));
+        for (size_t i = 0; i < local_inv.size(); ++i) {
+          simd::store_unaligned(&(*inv)[i][grid_index], local_inv[i]);
+        }
+      } else {
+        get(*det)[grid_index] = get(local_det);
+        for (size_t i = 0; i < local_inv.size(); ++i) {
+          (*inv)[i][grid_index] = local_inv[i];
+        }
+      }
+    };
+
+    size_t grid_index = 0;
+#ifdef SPECTRE_USE_XSIMD
+    constexpr size_t simd_width = simd::size<simd::batch<double>>();
+    for (; grid_index + simd_width <= number_of_points;
+         grid_index += simd_width) {
+      kernel(grid_index, std::true_type{});
+    }
+#endif  // SPECTRE_USE_XSIMD
+    for (; grid_index < number_of_points; ++grid_index) {
+      kernel(grid_index, std::false_type{});
+    }
+  }
+};
+
+// Selects the pointwise kernel for `DataVector`s of 3x3 and 4x4 tensors and
+// the expression-based implementation otherwise. The outputs must already have
+// the size of the input.
+template <typename T, typename Symm, typename Index0, typename Index1>
+void det_and_inverse_impl(
+    const gsl::not_null<Scalar<T>*> det,
+    const gsl::not_null<Tensor<T, Symm, inverse_indices<Index0, Index1>>*> inv,
+    const Tensor<T, Symm, tmpl::list<Index0, Index1>>& tensor) {
+  if constexpr (std::is_same_v<T, DataVector> and Index0::dim > 2) {
+    PointwiseDetAndInverseImpl<Symm, Index0, Index1>::apply(det, inv, tensor);
+  } else {
+    DetAndInverseImpl<Symm, Index0, Index1>::apply(det, inv, tensor);
+  }
+}
 }  // namespace determinant_and_inverse_detail
 
 /// @{
@@ -379,9 +457,7 @@ void determinant_and_inverse(
 
   set_number_of_grid_points(det, tensor);
   set_number_of_grid_points(inv, tensor);
-  determinant_and_inverse_detail::DetAndInverseImpl<Symm, Index0,
-                                                    Index1>::apply(det, inv,
-                                                                   tensor);
+  determinant_and_inverse_detail::det_and_inverse_impl(det, inv, tensor);
 }
 
 template <typename T, typename Symm, typename Index0, typename Index1>
@@ -394,9 +470,10 @@ auto determinant_and_inverse(
                               tmpl::list<change_index_up_lo<Index1>,
                                          change_index_up_lo<Index0>>>>
       result{};
-  determinant_and_inverse_detail::DetAndInverseImpl<
-      Symm, Index0, Index1>::apply(make_not_null(&result.first),
-                                   make_not_null(&result.second), tensor);
+  set_number_of_grid_points(make_not_null(&result.first), tensor);
+  set_number_of_grid_points(make_not_null(&result.second), tensor);
+  determinant_and_inverse_detail::det_and_inverse_impl(
+      make_not_null(&result.first), make_not_null(&result.second), tensor);
   return result;
 }
 /// @}
@@ -433,10 +510,9 @@ void determinant_and_inverse(
   if (UNLIKELY(number_of_grid_points != det_and_inv->number_of_grid_points())) {
     det_and_inv->initialize(number_of_grid_points);
   }
-  determinant_and_inverse_detail::DetAndInverseImpl<
-      Symm, Index0, Index1>::apply(make_not_null(&get<DetTag>(*det_and_inv)),
-                                   make_not_null(&get<InvTag>(*det_and_inv)),
-                                   tensor);
+  determinant_and_inverse_detail::det_and_inverse_impl(
+      make_not_null(&get<DetTag>(*det_and_inv)),
+      make_not_null(&get<InvTag>(*det_and_inv)), tensor);
 }
 
 template <typename DetTag, typename InvTag, typename T, typename Symm,
@@ -454,9 +530,9 @@ auto determinant_and_inverse(
                 "Type of second return tag must correspond to that of input's "
                 "inverse.");
   Variables<tmpl::list<DetTag, InvTag>> result(get<0, 0>(tensor).size());
-  determinant_and_inverse_detail::DetAndInverseImpl<
-      Symm, Index0, Index1>::apply(make_not_null(&get<DetTag>(result)),
-                                   make_not_null(&get<InvTag>(result)), tensor);
+  determinant_and_inverse_detail::det_and_inverse_impl(
+      make_not_null(&get<DetTag>(result)), make_not_null(&get<InvTag>(result)),
+      tensor);
   return result;
 }
 /// @}
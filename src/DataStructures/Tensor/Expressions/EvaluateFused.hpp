@@ -0,0 +1,186 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines a function for evaluating several `TensorExpression`s together over
+/// blocks of grid points
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/Tensor/Expressions/DataTypeSupport.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "DataStructures/VectorImpl.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace tenex {
+/// The default number of grid points processed per block by
+/// `tenex::evaluate_fused`
+///
+/// \details Chosen so that the inputs and outputs of a typical GR pointwise
+/// function (a few dozen components) fit in L1/L2 cache for one block.
+constexpr size_t default_fused_block_size = 128;
+
+namespace detail {
+// Point the components of `view` at the grid points
+// `[offset, offset + size)` of `tensor`
+template <typename DataType, typename Symm, typename IndexList>
+void make_tensor_block_view(
+    const gsl::not_null<Tensor<DataType, Symm, IndexList>*> view,
+    const gsl::not_null<Tensor<DataType, Symm, IndexList>*> tensor,
+    const size_t offset, const size_t size) {
+  for (size_t i = 0; i < tensor->size(); ++i) {
+    (*view)[i].set_data_ref((*tensor)[i].data() + offset, size);  // NOLINT
+  }
+}
+
+template <typename DataType, typename Symm, typename IndexList>
+void make_tensor_block_view(
+    const gsl::not_null<const Tensor<DataType, Symm, IndexList>*> view,
+    const Tensor<DataType, Symm, IndexList>& tensor, const size_t offset,
+    const size_t size) {
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    make_const_view(make_not_null(&(*view)[i]), tensor[i], offset, size);
+  }
+}
+
+template <typename ViewTuple, typename TensorTuple, size_t... Is>
+void make_block_views(const gsl::not_null<ViewTuple*> views,
+                      const TensorTuple& tensors, const size_t offset,
+                      const size_t size,
+                      std::index_sequence<Is...> /*meta*/) {
+  (make_tensor_block_view(make_not_null(&std::get<Is>(*views)),
+                          std::get<Is>(tensors), offset, size),
+   ...);
+}
+
+template <typename TensorType>
+size_t number_of_points(const TensorType& tensor) {
+  return tensor[0].size();
+}
+}  // namespace detail
+
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Evaluate several tensor equations that share their inputs in a single
+ * pass over the grid points
+ *
+ * \details Calling `tenex::evaluate` once per LHS tensor traverses every input
+ * component once per equation. When the equations are limited by memory
+ * bandwidth rather than by floating point operations, it is cheaper to split
+ * the grid points into blocks of `BlockSize` points and evaluate all the
+ * equations on one block before moving on to the next, so that the inputs are
+ * read from main memory only once and are served from cache afterward.
+ *
+ * `invocable` is called once per block with the signature
+ * \code
+ * void(gsl::not_null<Variables<TemporaryTags>*> temporaries,
+ *      gsl::not_null<LhsTensors*>... lhs_views,
+ *      const RhsTensors&... rhs_views)
+ * \endcode
+ * where each `lhs_view` and `rhs_view` is a non-owning `Tensor` that refers to
+ * the points of the current block of the corresponding argument. The body
+ * should simply call `tenex::evaluate` (or `tenex::update`) for each LHS
+ * tensor on the views. Subexpressions that appear in more than one equation
+ * should be evaluated once into one of the `temporaries`, which only hold a
+ * single block of points and are allocated once for the whole evaluation, and
+ * then reused in the remaining equations.
+ *
+ * All `Tensor`s must hold `DataVector` or `ComplexDataVector` components, and
+ * all RHS tensors must have the same number of grid points. LHS tensors whose
+ * components do not have that size are resized.
+ *
+ * ### Example usage
+ * \snippet Test_EvaluateFused.cpp use_evaluate_fused
+ *
+ * @tparam TemporaryTags the tags of the block-sized temporary tensors handed to
+ * `invocable`
+ * @tparam BlockSize the number of grid points per block
+ * @param invocable the function evaluating the equations on one block
+ * @param lhs_tensors the resultant LHS `Tensor`s to fill
+ * @param rhs_tensors the `Tensor`s used in the RHS of the equations
+ */
+template <typename TemporaryTags = tmpl::list<>,
+          size_t BlockSize = default_fused_block_size, typename Invocable,
+          typename... LhsTensors, typename... RhsTensors>
+void evaluate_fused(const Invocable& invocable,
+                    const std::tuple<gsl::not_null<LhsTensors*>...>& lhs_tensors,
+                    const RhsTensors&... rhs_tensors) {
+  static_assert(BlockSize > 0, "The block size must be positive.");
+  static_assert(sizeof...(LhsTensors) > 0 and sizeof...(RhsTensors) > 0,
+                "At least one LHS and one RHS tensor must be passed to "
+                "tenex::evaluate_fused.");
+  static_assert(
+      (... and is_derived_of_vector_impl_v<typename LhsTensors::type>) and
+          (... and is_derived_of_vector_impl_v<typename RhsTensors::type>),
+      "tenex::evaluate_fused only supports Tensors holding vector types, such "
+      "as DataVector and ComplexDataVector. For Tensors holding fundamental "
+      "types, call tenex::evaluate for each equation instead.");
+
+  const size_t number_of_points =
+      detail::number_of_points(std::get<0>(std::forward_as_tuple(
+          rhs_tensors...)));
+#ifdef SPECTRE_DEBUG
+  const auto check_size = [&number_of_points](const auto& tensor) {
+    for (const auto& component : tensor) {
+      ASSERT(component.size() == number_of_points,
+             "All RHS tensors passed to tenex::evaluate_fused must have the "
+             "same number of grid points. Expected "
+             << number_of_points << " but got " << component.size());
+    }
+  };
+  (check_size(rhs_tensors), ...);
+#endif  // SPECTRE_DEBUG
+  std::apply(
+      [&number_of_points](const auto&... lhs_tensor) {
+        const auto resize = [&number_of_points](const auto tensor) {
+          for (auto& component : *tensor) {
+            if (component.size() != number_of_points) {
+              component.destructive_resize(number_of_points);
+            }
+          }
+        };
+        (resize(lhs_tensor), ...);
+      },
+      lhs_tensors);
+
+  Variables<TemporaryTags> temporaries{std::min(BlockSize, number_of_points)};
+  std::tuple<LhsTensors...> lhs_views{};
+  std::tuple<const RhsTensors...> rhs_views{};
+
+  for (size_t offset = 0; offset < number_of_points; offset += BlockSize) {
+    const size_t block_size = std::min(BlockSize, number_of_points - offset);
+    if constexpr (not std::is_same_v<TemporaryTags, tmpl::list<>>) {
+      if (temporaries.number_of_grid_points() != block_size) {
+        temporaries.initialize(block_size);
+      }
+    }
+    detail::make_block_views(make_not_null(&lhs_views), lhs_tensors, offset,
+                             block_size,
+                             std::make_index_sequence<sizeof...(LhsTensors)>{});
+    detail::make_block_views(make_not_null(&rhs_views),
+                             std::forward_as_tuple(rhs_tensors...), offset,
+                             block_size,
+                             std::make_index_sequence<sizeof...(RhsTensors)>{});
+    std::apply(
+        [&invocable, &temporaries, &rhs_views](auto&... lhs_view) {
+          std::apply(
+              [&invocable, &temporaries, &lhs_view...](
+                  const auto&... rhs_view) {
+                invocable(make_not_null(&temporaries),
+                          make_not_null(&lhs_view)..., rhs_view...);
+              },
+              rhs_views);
+        },
+        lhs_views);
+  }
+}
+}  // namespace tenex
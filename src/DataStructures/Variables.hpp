@@ -17,6 +17,7 @@
 #include <blaze/math/Vector.h>
 #include <limits>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <pup.h>
 #include <string>
@@ -59,6 +60,20 @@ class Variables;
 }  // namespace Tags
 /// \endcond
 
+namespace Variables_detail {
+/// Alignment in bytes of the memory owned by a `Variables`. This is a cache
+/// line on current CPUs, which is also a multiple of the SIMD register width.
+constexpr size_t alignment = 64;
+
+// Frees the aligned memory owned by a `Variables`
+struct AlignedArrayDeleter {
+  template <typename T>
+  void operator()(T* const pointer) const {
+    ::operator delete[](pointer, std::align_val_t{alignment});
+  }
+};
+}  // namespace Variables_detail
+
 /*!
  * \ingroup DataStructuresGroup
  * \brief A Variables holds a contiguous memory block with Tensors pointing
@@ -87,7 +102,7 @@ class Variables;
  *
  * `Variables` stores the data it owns in a `std::unique_ptr<double[]>`
  * instead of a `std::vector` because `std::vector` value-initializes its
- * contents, which is very slow.
+ * contents, which is very slow. The allocation is aligned to a cache line.
  */
 template <typename... Tags>
 class Variables<tmpl::list<Tags...>> {
@@ -549,7 +564,8 @@ class Variables<tmpl::list<Tags...>> {
 
   std::array<value_type, number_of_independent_components>
       variable_data_impl_static_;
-  std::unique_ptr<value_type[]> variable_data_impl_dynamic_{};
+  std::unique_ptr<value_type[], Variables_detail::AlignedArrayDeleter>
+      variable_data_impl_dynamic_{};
   bool owning_{true};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
@@ -645,8 +661,10 @@ void Variables<tmpl::list<Tags...>>::initialize(
     if (number_of_grid_points_ == 1) {
       variable_data_impl_dynamic_.reset();
     } else {
-      variable_data_impl_dynamic_ =
-          cpp20::make_unique_for_overwrite<value_type[]>(size_);
+      // value_type is trivial, so the memory needs no construction
+      variable_data_impl_dynamic_.reset(static_cast<value_type*>(
+          ::operator new[](size_ * sizeof(value_type),
+                           std::align_val_t{Variables_detail::alignment})));
     }
     add_reference_variable_data();
 #if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
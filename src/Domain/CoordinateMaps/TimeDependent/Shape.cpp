@@ -11,10 +11,10 @@
 #include <pup.h>
 #include <pup_stl.h>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
@@ -23,6 +23,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/StdHelpers.hpp"
 
@@ -34,6 +35,25 @@ std::array<T, 2> cartesian_to_spherical(const std::array<T, 3>& cartesian) {
   return {atan2(hypot(x, y), z), atan2(y, x)};
 }
 
+namespace {
+// The interpolation info at the last source coordinates evaluated on this
+// thread, see the documentation of `Shape`
+struct InterpolationInfoCache {
+  size_t l_max = 0;
+  size_t m_max = 0;
+  std::array<DataVector, 3> centered_coords{};
+  std::optional<ylm::Spherepack::InterpolationInfo<DataVector>>
+      interpolation_info{};
+  std::optional<ylm::Spherepack::InterpolationInfo<DataVector>>
+      extended_interpolation_info{};
+};
+
+InterpolationInfoCache& thread_interpolation_info_cache() {
+  thread_local InterpolationInfoCache cache{};
+  return cache;
+}
+}  // namespace
+
 Shape::Shape(
     const std::array<double, 3>& center, const size_t l_max, const size_t m_max,
     std::unique_ptr<ShapeMapTransitionFunctions::ShapeMapTransitionFunction>
@@ -46,6 +66,7 @@ Shape::Shape(
       l_max_(l_max),
       m_max_(m_max),
       ylm_(l_max, m_max),
+      extended_ylm_(l_max + 1, m_max + 1),
       transition_func_(std::move(transition_func)) {
   f_of_t_names_.insert(shape_f_of_t_name_);
   if (size_f_of_t_name_.has_value()) {
@@ -66,6 +87,7 @@ Shape& Shape::operator=(const Shape& rhs) {
     l_max_ = rhs.l_max_;
     m_max_ = rhs.m_max_;
     ylm_ = rhs.ylm_;
+    extended_ylm_ = rhs.extended_ylm_;
     transition_func_ = rhs.transition_func_->get_clone();
   }
   return *this;
@@ -77,14 +99,15 @@ template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::operator()(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const auto centered_coords = center_coordinates(source_coords);
-  auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
+  std::optional<ylm::Spherepack::InterpolationInfo<ReturnType>> buffer{};
+  const auto& interpolation_info =
+      interpolation_info_at(make_not_null(&buffer), centered_coords, false);
   DataVector coefs = functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
   check_size(make_not_null(&coefs), functions_of_time, time, false);
   check_coefficients(coefs);
-  // re-use allocation
-  auto& distorted_radii = get<0>(theta_phis);
+  auto distorted_radii = make_with_value<ReturnType>(centered_coords[0], 0.);
   // evaluate the spherical harmonic expansion at the angles of `source_coords`
   ylm_.interpolate_from_coefs(make_not_null(&distorted_radii), coefs,
                               interpolation_info);
@@ -92,7 +115,6 @@ std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::operator()(
   // this should be taken care of by the control system but is very hard to
   // debug
 #ifdef SPECTRE_DEBUG
-  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const ReturnType shift_radii =
       distorted_radii * transition_func_->operator()(centered_coords) *
       check_and_compute_one_over_radius(centered_coords);
@@ -136,15 +158,16 @@ template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::frame_velocity(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const auto centered_coords = center_coordinates(source_coords);
-  auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
+  std::optional<ylm::Spherepack::InterpolationInfo<ReturnType>> buffer{};
+  const auto& interpolation_info =
+      interpolation_info_at(make_not_null(&buffer), centered_coords, false);
   DataVector coef_derivs =
       functions_of_time.at(shape_f_of_t_name_)->func_and_deriv(time)[1];
   check_size(make_not_null(&coef_derivs), functions_of_time, time, true);
   check_coefficients(coef_derivs);
-  // re-use allocation
-  auto& radii_velocities = get<0>(theta_phis);
+  auto radii_velocities = make_with_value<ReturnType>(centered_coords[0], 0.);
   ylm_.interpolate_from_coefs(make_not_null(&radii_velocities), coef_derivs,
                               interpolation_info);
   return -centered_coords * radii_velocities *
@@ -153,26 +176,57 @@ std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::frame_velocity(
 }
 
 template <typename T>
-tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
-    const std::array<T, 3>& source_coords, const double time,
-    const FunctionsOfTimeMap& functions_of_time) const {
-  const auto centered_coords = center_coordinates(source_coords);
-
-  // The distorted radii are calculated analogously to the call operator
-  auto theta_phis = cartesian_to_spherical(centered_coords);
+const ylm::Spherepack::InterpolationInfo<T>& Shape::interpolation_info_at(
+    [[maybe_unused]] const gsl::not_null<
+        std::optional<ylm::Spherepack::InterpolationInfo<T>>*>
+        buffer,
+    const std::array<T, 3>& centered_coords, const bool extended) const {
+  const ylm::Spherepack& ylm = extended ? extended_ylm_ : ylm_;
+  if constexpr (std::is_same_v<T, DataVector>) {
+    // The map is shared between the threads of a node, so the cache is per
+    // thread. The interpolation info only depends on the expansion order and
+    // the angles, so the cache can be shared between all shape maps.
+    auto& cache = thread_interpolation_info_cache();
+    if (cache.l_max != l_max_ or cache.m_max != m_max_ or
+        cache.centered_coords != centered_coords) {
+      cache.l_max = l_max_;
+      cache.m_max = m_max_;
+      cache.centered_coords = centered_coords;
+      cache.interpolation_info.reset();
+      cache.extended_interpolation_info.reset();
+    }
+    auto& cached_info = extended ? cache.extended_interpolation_info
+                                 : cache.interpolation_info;
+    if (not cached_info.has_value()) {
+      cached_info.emplace(ylm.set_up_interpolation_info(
+          cartesian_to_spherical(centered_coords)));
+    }
+    return cached_info.value();
+  } else {
+    buffer->emplace(
+        ylm.set_up_interpolation_info(cartesian_to_spherical(centered_coords)));
+    return buffer->value();
+  }
+}
 
+template <typename T>
+void Shape::jacobian_terms(const gsl::not_null<T*> diagonal,
+                           const gsl::not_null<std::array<T, 3>*> gradient,
+                           const std::array<T, 3>& centered_coords,
+                           const double time,
+                           const FunctionsOfTimeMap& functions_of_time) const {
   // The Cartesian gradient cannot be represented exactly by `l_max_` and
   // `m_max_` which causes an aliasing error. We need an additional order to
   // represent it. This is in theory not needed for the distorted_radii
   // calculation but saves calculating the `interpolation_info` twice.
-  const ylm::Spherepack extended_ylm(l_max_ + 1, m_max_ + 1);
-  const auto interpolation_info =
-      extended_ylm.set_up_interpolation_info(theta_phis);
+  std::optional<ylm::Spherepack::InterpolationInfo<T>> buffer{};
+  const auto& interpolation_info =
+      interpolation_info_at(make_not_null(&buffer), centered_coords, true);
 
   const DataVector coefs =
       functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
   check_coefficients(coefs);
-  DataVector extended_coefs(extended_ylm.spectral_size(), 0.);
+  DataVector extended_coefs(extended_ylm_.spectral_size(), 0.);
 
   // Copy over the coefficients. The additional coefficients of order `l_max_
   // +1` are zero and will only have an effect in the interpolation of the
@@ -191,24 +245,25 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
   check_size(make_not_null(&extended_coefs), functions_of_time, time, false);
 
   // Re-use allocation
-  auto& distorted_radii = get<0>(theta_phis);
-  extended_ylm.interpolate_from_coefs(make_not_null(&distorted_radii),
-                                      extended_coefs, interpolation_info);
+  auto& distorted_radii = *diagonal;
+  distorted_radii = make_with_value<T>(centered_coords[0], 0.);
+  extended_ylm_.interpolate_from_coefs(make_not_null(&distorted_radii),
+                                       extended_coefs, interpolation_info);
   // Calculates the Pfaffian derivative at the internal collocation points of
   // YlmSpherePack. We can't interpolate these directly as they are not smooth
   // across the poles, so we convert them to the Cartesian gradients first,
   // which are smooth.
   const auto angular_gradient =
-      extended_ylm.gradient_from_coefs(extended_coefs);
+      extended_ylm_.gradient_from_coefs(extended_coefs);
 
   tnsr::i<DataVector, 3, Frame::Inertial> cartesian_gradient(
-      extended_ylm.physical_size());
+      extended_ylm_.physical_size());
 
   // Re-use allocations
   std::array<DataVector, 2> collocation_theta_phis{};
   collocation_theta_phis[0].set_data_ref(&get<2>(cartesian_gradient));
   collocation_theta_phis[1].set_data_ref(&get<1>(cartesian_gradient));
-  collocation_theta_phis = extended_ylm.theta_phi_points();
+  collocation_theta_phis = extended_ylm_.theta_phi_points();
 
   const auto& col_thetas = collocation_theta_phis[0];
   const auto& col_phis = collocation_theta_phis[1];
@@ -227,103 +282,60 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
 
   get<2>(cartesian_gradient) = -sin(col_thetas) * get<0>(angular_gradient);
 
-  tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> result(
-      get_size(centered_coords[0]));
-
-  // re-use allocation
-  auto& target_gradient_x = get<2, 0>(result);
-  auto& target_gradient_y = get<2, 1>(result);
-  auto& target_gradient_z = get<2, 2>(result);
-
   // interpolate the cartesian gradient to the thetas and phis of the
   // `source_coords`
-  extended_ylm.interpolate(make_not_null(&target_gradient_x),
-                           get<0>(cartesian_gradient).data(),
-                           interpolation_info);
-  extended_ylm.interpolate(make_not_null(&target_gradient_y),
-                           get<1>(cartesian_gradient).data(),
-                           interpolation_info);
-  extended_ylm.interpolate(make_not_null(&target_gradient_z),
-                           get<2>(cartesian_gradient).data(),
-                           interpolation_info);
+  for (size_t j = 0; j < 3; ++j) {
+    gsl::at(*gradient, j) = make_with_value<T>(centered_coords[0], 0.);
+    extended_ylm_.interpolate(make_not_null(&gsl::at(*gradient, j)),
+                              cartesian_gradient.get(j).data(),
+                              interpolation_info);
+  }
 
-  // No auto here to avoid DVExpressions
-  using ReturnType = tt::remove_cvref_wrap_t<T>;
-  const ReturnType one_over_radius =
-      check_and_compute_one_over_radius(centered_coords);
-  const ReturnType transition_func_over_radius =
+  const T one_over_radius = check_and_compute_one_over_radius(centered_coords);
+  const T transition_func_over_radius =
       transition_func_->operator()(centered_coords) * one_over_radius;
-  const ReturnType transition_func_over_square_radius =
+  const T transition_func_over_square_radius =
       transition_func_over_radius * one_over_radius;
-  const ReturnType transition_func_over_cube_radius =
+  const T transition_func_over_cube_radius =
       transition_func_over_square_radius * one_over_radius;
-  const std::array<ReturnType, 3> transition_func_gradient_over_radius =
+  const std::array<T, 3> transition_func_gradient_over_radius =
       transition_func_->gradient(centered_coords) * one_over_radius;
 
-  // re-use allocation
-  auto& target_gradient_x_times_spatial_part = target_gradient_x;
-  auto& target_gradient_y_times_spatial_part = target_gradient_y;
-  auto& target_gradient_z_times_spatial_part = target_gradient_z;
-  target_gradient_x_times_spatial_part *= transition_func_over_square_radius;
-  target_gradient_y_times_spatial_part *= transition_func_over_square_radius;
-  target_gradient_z_times_spatial_part *= transition_func_over_square_radius;
-
-  const auto& [x_transition_gradient_over_radius,
-               y_transition_gradient_over_radius,
-               z_transition_gradient_over_radius] =
-      transition_func_gradient_over_radius;
-  const auto& [x_centered, y_centered, z_centered] = centered_coords;
-
-  get<0, 0>(result) =
-      -x_centered * ((x_transition_gradient_over_radius -
-                      x_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_x_times_spatial_part);
-  get<0, 1>(result) =
-      -x_centered * ((y_transition_gradient_over_radius -
-                      y_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_y_times_spatial_part);
-  get<0, 2>(result) =
-      -x_centered * ((z_transition_gradient_over_radius -
-                      z_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_z_times_spatial_part);
-  get<1, 0>(result) =
-      -y_centered * ((x_transition_gradient_over_radius -
-                      x_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_x_times_spatial_part);
-  get<1, 1>(result) =
-      -y_centered * ((y_transition_gradient_over_radius -
-                      y_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_y_times_spatial_part);
-  get<1, 2>(result) =
-      -y_centered * ((z_transition_gradient_over_radius -
-                      z_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_z_times_spatial_part);
-  get<2, 0>(result) =
-      -z_centered * ((x_transition_gradient_over_radius -
-                      x_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_x_times_spatial_part);
-  get<2, 1>(result) =
-      -z_centered * ((y_transition_gradient_over_radius -
-                      y_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_y_times_spatial_part);
-  get<2, 2>(result) =
-      -z_centered * ((z_transition_gradient_over_radius -
-                      z_centered * transition_func_over_cube_radius) *
-                         distorted_radii +
-                     target_gradient_z_times_spatial_part);
-
-  get<0, 0>(result) += 1. - distorted_radii * transition_func_over_radius;
-  get<1, 1>(result) += 1. - distorted_radii * transition_func_over_radius;
-  get<2, 2>(result) += 1. - distorted_radii * transition_func_over_radius;
+  for (size_t j = 0; j < 3; ++j) {
+    // Holds the interpolated Cartesian gradient of the distorted radii
+    auto& gradient_j = gsl::at(*gradient, j);
+    gradient_j *= transition_func_over_square_radius;
+    gradient_j +=
+        (gsl::at(transition_func_gradient_over_radius, j) -
+         gsl::at(centered_coords, j) * transition_func_over_cube_radius) *
+        distorted_radii;
+  }
+
+  // Overwrites the distorted radii
+  *diagonal = 1. - distorted_radii * transition_func_over_radius;
+}
 
+template <typename T>
+tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
+    const std::array<T, 3>& source_coords, const double time,
+    const FunctionsOfTimeMap& functions_of_time) const {
+  // No auto here to avoid DVExpressions
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
+  const std::array<ReturnType, 3> centered_coords =
+      center_coordinates(source_coords);
+  ReturnType diagonal{};
+  std::array<ReturnType, 3> gradient{};
+  jacobian_terms(make_not_null(&diagonal), make_not_null(&gradient),
+                 centered_coords, time, functions_of_time);
+
+  tnsr::Ij<ReturnType, 3, Frame::NoFrame> result(
+      get_size(centered_coords[0]));
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      result.get(i, j) = -gsl::at(centered_coords, i) * gsl::at(gradient, j);
+    }
+    result.get(i, i) += diagonal;
+  }
   return result;
 }
 
@@ -331,9 +343,31 @@ template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::inv_jacobian(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
-  return determinant_and_inverse(
-             jacobian(source_coords, time, functions_of_time))
-      .second;
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
+  const std::array<ReturnType, 3> centered_coords =
+      center_coordinates(source_coords);
+  ReturnType diagonal{};
+  std::array<ReturnType, 3> gradient{};
+  jacobian_terms(make_not_null(&diagonal), make_not_null(&gradient),
+                 centered_coords, time, functions_of_time);
+
+  // Sherman-Morrison formula for the inverse of
+  // diagonal * delta^i_j - centered_coords^i gradient_j
+  const ReturnType one_over_diagonal = 1. / diagonal;
+  const ReturnType outer_product_factor =
+      one_over_diagonal /
+      (diagonal - centered_coords[0] * gradient[0] -
+       centered_coords[1] * gradient[1] - centered_coords[2] * gradient[2]);
+  tnsr::Ij<ReturnType, 3, Frame::NoFrame> result(
+      get_size(centered_coords[0]));
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      result.get(i, j) = gsl::at(centered_coords, i) * gsl::at(gradient, j) *
+                         outer_product_factor;
+    }
+    result.get(i, i) += one_over_diagonal;
+  }
+  return result;
 }
 
 void Shape::check_coefficients([[maybe_unused]] const DataVector& coefs) const {
@@ -427,6 +461,7 @@ void Shape::pup(PUP::er& p) {
   // No need to pup these because they are uniquely determined by other members
   if (p.isUnpacking()) {
     ylm_ = ylm::Spherepack(l_max_, m_max_);
+    extended_ylm_ = ylm::Spherepack(l_max_ + 1, m_max_ + 1);
     f_of_t_names_.clear();
     f_of_t_names_.insert(shape_f_of_t_name_);
     if (size_f_of_t_name_.has_value()) {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <optional>
@@ -188,15 +189,36 @@ namespace domain::CoordinateMaps::TimeDependent {
  *
  * ### Inverse Jacobian
  *
- * The inverse Jacobian is computed by numerically inverting the Jacobian.
+ * The Jacobian has the form
  *
- * For future optimization, the `interpolation_info` objects calculated in all
- * functions of this class could be cached. Since every element should evaluate
- * the same grid coordinates most time steps, this might greatly decrease
- * computation. Every element has their own clone of the shape map so the
- * caching could be done with member variables. Care must be taken that
- * `jacobian` currently calculates the `interpolation_info` with an order
- * higher.
+ * \f{equation}{
+ * \frac{\partial x^i}{\partial \xi^j} = a \delta^i_j - \xi^i g_j,
+ * \f}
+ *
+ * where \f$a = 1 - f(r, \theta, \phi) \sum_{lm} \lambda_{lm}(t)
+ * Y_{lm}(\theta, \phi) / r\f$ and \f$g_j\f$ is the bracketed term in the
+ * Jacobian above. Its inverse therefore follows from the Sherman-Morrison
+ * formula:
+ *
+ * \f{equation}{
+ * \frac{\partial \xi^i}{\partial x^j} = \frac{1}{a} \left(\delta^i_j +
+ * \frac{\xi^i g_j}{a - \xi^k g_k}\right).
+ * \f}
+ *
+ * ### Caching of interpolation information
+ *
+ * All functions of this class interpolate spherical harmonic expansions to the
+ * angles of the source coordinates, which requires an `interpolation_info`
+ * object. For `DataVector` arguments the map is evaluated at the grid
+ * coordinates of an element several times in a row, e.g. by `operator()`,
+ * `frame_velocity`, `jacobian` and `inv_jacobian` for the same time step, so
+ * the `interpolation_info` objects are cached, keyed on `l_max`, `m_max` and
+ * the (centered) source coordinates. Note that `jacobian` needs the
+ * `interpolation_info` for one order higher than the other functions, so two
+ * objects are cached. The map is shared by all elements of a block and all
+ * threads of a node, so the cache is not a member of the map but is
+ * `thread_local`, like the memory pool of `ylm::Spherepack`. The map can
+ * therefore be evaluated from multiple threads at once.
  */
 class Shape {
  public:
@@ -258,9 +280,31 @@ class Shape {
   size_t l_max_ = 2;
   size_t m_max_ = 2;
   ylm::Spherepack ylm_{2, 2};
+  // One order higher than `ylm_` to represent the Cartesian gradient
+  ylm::Spherepack extended_ylm_{3, 3};
   std::unique_ptr<ShapeMapTransitionFunctions::ShapeMapTransitionFunction>
       transition_func_;
 
+  // Returns the interpolation info of `ylm_` (or `extended_ylm_` if `extended`
+  // is true) at the angles of `centered_coords`. For `DataVector`s this is the
+  // interpolation info cached on the calling thread, which is recomputed only
+  // if `centered_coords` changed. It stays valid until the next call on the
+  // same thread. Otherwise, the interpolation info is computed and stored in
+  // `buffer`.
+  template <typename T>
+  const ylm::Spherepack::InterpolationInfo<T>& interpolation_info_at(
+      gsl::not_null<std::optional<ylm::Spherepack::InterpolationInfo<T>>*>
+          buffer,
+      const std::array<T, 3>& centered_coords, bool extended) const;
+
+  // Computes the terms `diagonal` = a and `gradient` = g_j of the Jacobian
+  // a delta^i_j - centered_coords^i g_j, see the class documentation.
+  template <typename T>
+  void jacobian_terms(gsl::not_null<T*> diagonal,
+                      gsl::not_null<std::array<T, 3>*> gradient,
+                      const std::array<T, 3>& centered_coords, double time,
+                      const FunctionsOfTimeMap& functions_of_time) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, 3> center_coordinates(
       const std::array<T, 3>& coords) const {
@@ -16,11 +16,9 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "Domain/Block.hpp"
-#include "Domain/CreateInitialElement.hpp"
 #include "Domain/ElementMap.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Domain/Structure/CreateInitialMesh.hpp"
-#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/Structure/ZCurve.hpp"
@@ -39,32 +37,13 @@
 #include "Utilities/Numeric.hpp"
 
 namespace domain {
-namespace {
-// \brief Get the cost of an `Element` computed as
-// `(number of grid points) / sqrt(minimum grid spacing in Frame::Grid)`
-//
-// \details As grid points in an `Element` increase, we expect the
-// computational cost of an `Element` to scale proportionally (if the minimum
-// grid spacing is held constant). In addition, the minimum grid spacing
-// between two points in an `Element` informs the time step that we take, where
-// the smaller the minimum spacing, the smaller time step we must take, which
-// means we expect computational work to scale inversely with the minimum grid
-// spacing.
-//
-// The reason that we use the square root of the spacing as opposed to just the
-// spacing in the denominator of the cost is that it was found experimentally
-// that using the square root yielded faster BBH simulation runtimes when using
-// local time stepping.
 template <size_t Dim>
 double get_num_points_and_grid_spacing_cost(
     const ElementId<Dim>& element_id, const Block<Dim>& block,
-    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
     const Spectral::Quadrature quadrature) {
   Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
       initial_extents, element_id, quadrature);
-  Element<Dim> element = ::domain::Initialization::create_initial_element(
-      element_id, block, initial_refinement_levels);
   ElementMap<Dim, Frame::Grid> element_map{element_id, block};
   const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
       logical_coordinates(mesh);
@@ -75,7 +54,6 @@ double get_num_points_and_grid_spacing_cost(
 
   return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
 }
-}  //  namespace
 
 std::ostream& operator<<(std::ostream& os, ElementWeight weight) {
   switch (weight) {
@@ -121,9 +99,9 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
                "have a value");
 
         element_costs.insert(
-            {element_id, get_num_points_and_grid_spacing_cost(
-                             element_id, block, initial_refinement_levels,
-                             initial_extents, quadrature.value())});
+            {element_id,
+             get_num_points_and_grid_spacing_cost(
+                 element_id, block, initial_extents, quadrature.value())});
       }
     }
   }
@@ -335,7 +313,12 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
           initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       ElementWeight element_weight,                                          \
-      const std::optional<Spectral::Quadrature>& quadrature);
+      const std::optional<Spectral::Quadrature>& quadrature);                \
+  template double get_num_points_and_grid_spacing_cost(                      \
+      const ElementId<GET_DIM(data)>& element_id,                            \
+      const Block<GET_DIM(data)>& block,                                     \
+      const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
+      Spectral::Quadrature quadrature);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
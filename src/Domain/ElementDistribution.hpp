@@ -63,6 +63,32 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
     ElementWeight element_weight,
     const std::optional<Spectral::Quadrature>& quadrature);
 
+/// \brief Get the cost of an `Element` computed as
+/// `(number of grid points) / sqrt(minimum grid spacing in Frame::Grid)`
+///
+/// \details As grid points in an `Element` increase, we expect the
+/// computational cost of an `Element` to scale proportionally (if the minimum
+/// grid spacing is held constant). In addition, the minimum grid spacing
+/// between two points in an `Element` informs the time step that we take,
+/// where the smaller the minimum spacing, the smaller time step we must take,
+/// which means we expect computational work to scale inversely with the
+/// minimum grid spacing.
+///
+/// The reason that we use the square root of the spacing as opposed to just
+/// the spacing in the denominator of the cost is that it was found
+/// experimentally that using the square root yielded faster BBH simulation
+/// runtimes when using local time stepping.
+///
+/// This maps the grid points of the `Element`, so it is by far the most
+/// expensive weight to compute. It only reads the `block`, so the costs of
+/// different elements can be computed concurrently (see
+/// `Parallel::create_elements_using_distribution`).
+template <size_t Dim>
+double get_num_points_and_grid_spacing_cost(
+    const ElementId<Dim>& element_id, const Block<Dim>& block,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    Spectral::Quadrature quadrature);
+
 /*!
  * \brief Distribution strategy for assigning elements to CPUs using a
  * Morton ('Z-order') space-filling curve to determine placement within each
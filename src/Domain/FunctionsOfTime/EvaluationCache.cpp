@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
+
+#include <array>
+#include <atomic>
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime::FunctionOfTimeHelpers {
+namespace {
+// Ids start at 1 so that an id of 0 marks an empty entry
+std::atomic<size_t> next_id{1};
+
+struct Entry {
+  size_t id = 0;
+  size_t generation = 0;
+  double time = std::numeric_limits<double>::signaling_NaN();
+  std::vector<DataVector> values{};
+};
+
+// A typical domain has a handful of functions of time, each evaluated with a
+// few different numbers of derivatives at the few times of the substeps that
+// are in progress on a core.
+constexpr size_t number_of_entries = 128;
+
+std::array<Entry, number_of_entries>& thread_entries() {
+  thread_local std::array<Entry, number_of_entries> entries{};
+  return entries;
+}
+
+Entry& entry_for(const size_t id, const double time,
+                 const size_t number_of_values) {
+  size_t hash = 0;
+  boost::hash_combine(hash, id);
+  boost::hash_combine(hash, time);
+  boost::hash_combine(hash, number_of_values);
+  return thread_entries()[hash % number_of_entries];
+}
+}  // namespace
+
+EvaluationCache::EvaluationCache() : id_(next_id.fetch_add(1)) {}
+
+EvaluationCache::EvaluationCache(const EvaluationCache& /*rhs*/)
+    : EvaluationCache() {}
+
+EvaluationCache::EvaluationCache(EvaluationCache&& /*rhs*/) noexcept
+    : EvaluationCache() {}
+
+EvaluationCache& EvaluationCache::operator=(const EvaluationCache& /*rhs*/) {
+  invalidate();
+  return *this;
+}
+
+EvaluationCache& EvaluationCache::operator=(
+    EvaluationCache&& /*rhs*/) noexcept {
+  invalidate();
+  return *this;
+}
+
+void EvaluationCache::invalidate() {
+  generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+bool EvaluationCache::lookup(const gsl::span<DataVector> result,
+                             const size_t generation,
+                             const double time) const {
+  const Entry& entry = entry_for(id_, time, result.size());
+  if (entry.id != id_ or entry.generation != generation or
+      entry.time != time or entry.values.size() != result.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i] = entry.values[i];
+  }
+  return true;
+}
+
+void EvaluationCache::store(const gsl::span<const DataVector> values,
+                            const size_t generation, const double time) const {
+  Entry& entry = entry_for(id_, time, values.size());
+  entry.id = id_;
+  entry.generation = generation;
+  entry.time = time;
+  entry.values.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    entry.values[i] = values[i];
+  }
+}
+}  // namespace domain::FunctionsOfTime::FunctionOfTimeHelpers
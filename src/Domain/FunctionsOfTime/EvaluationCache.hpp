@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime::FunctionOfTimeHelpers {
+/*!
+ * \brief Memoizes the evaluations of a function of time
+ *
+ * \details On every (sub)step all elements on a node evaluate the same
+ * functions of time at the same time, typically from several time-dependent
+ * maps per element. A function of time holds an `EvaluationCache` and wraps
+ * its evaluations in `get`, which returns a stored result if the function of
+ * time was already evaluated at the same time with the same number of
+ * derivatives, and otherwise evaluates and stores the result.
+ *
+ * Results are stored in a small table that every thread keeps for all
+ * functions of time, so neither lookups nor insertions need any
+ * synchronization between threads, and all elements on the same core share
+ * the stored results. An entry is identified by a unique id of the
+ * `EvaluationCache` (and therefore of the function of time holding it), a
+ * generation that is incremented by `invalidate()`, the time and the number
+ * of derivatives.
+ *
+ * Functions of time must call `invalidate()` whenever they are modified, e.g.
+ * when they are updated. Copies and moves get a new id, because the copy is a
+ * different function of time.
+ */
+class EvaluationCache {
+ public:
+  EvaluationCache();
+  EvaluationCache(const EvaluationCache& /*rhs*/);
+  EvaluationCache(EvaluationCache&& /*rhs*/) noexcept;
+  EvaluationCache& operator=(const EvaluationCache& /*rhs*/);
+  EvaluationCache& operator=(EvaluationCache&& /*rhs*/) noexcept;
+  ~EvaluationCache() = default;
+
+  /// Returns the stored result of `evaluate()` for `time` and
+  /// `NumberOfDerivs`, and calls and stores `evaluate()` if there is none.
+  template <size_t NumberOfDerivs, typename Evaluate>
+  std::array<DataVector, NumberOfDerivs + 1> get(
+      double time, const Evaluate& evaluate) const;
+
+  /// Discards all stored results of this cache on all threads
+  void invalidate();
+
+ private:
+  bool lookup(gsl::span<DataVector> result, size_t generation,
+              double time) const;
+  void store(gsl::span<const DataVector> values, size_t generation,
+             double time) const;
+
+  size_t id_;
+  std::atomic<size_t> generation_{0};
+};
+
+template <size_t NumberOfDerivs, typename Evaluate>
+std::array<DataVector, NumberOfDerivs + 1> EvaluationCache::get(
+    const double time, const Evaluate& evaluate) const {
+  // The generation is read before evaluating, so a result computed while the
+  // function of time is being updated is stored with the old generation.
+  const size_t generation = generation_.load(std::memory_order_acquire);
+  std::array<DataVector, NumberOfDerivs + 1> result{};
+  if (lookup(gsl::span<DataVector>(result.data(), result.size()), generation,
+             time)) {
+    return result;
+  }
+  result = evaluate();
+  store(gsl::span<const DataVector>(result.data(), result.size()), generation,
+        time);
+  return result;
+}
+}  // namespace domain::FunctionsOfTime::FunctionOfTimeHelpers
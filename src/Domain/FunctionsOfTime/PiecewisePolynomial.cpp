@@ -186,6 +186,7 @@ void PiecewisePolynomial<MaxDeriv>::update(const double time_of_update,
                 new_expiration_time);
     update_backlog_.erase(entry);
   }
+  evaluation_cache_.invalidate();
 }
 
 template <size_t MaxDeriv>
@@ -220,6 +221,9 @@ void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   if (version >= 4) {
     p | update_backlog_;
   }
+  if (p.isUnpacking()) {
+    evaluation_cache_.invalidate();
+  }
 }
 
 namespace {
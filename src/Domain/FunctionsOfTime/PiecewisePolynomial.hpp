@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
@@ -23,6 +24,9 @@ namespace FunctionsOfTime {
  * \ingroup ComputationalDomainGroup
  * \brief A function that has a piecewise-constant `MaxDeriv`th derivative.
  *
+ * \details The evaluations in `func`, `func_and_deriv` and `func_and_2_derivs`
+ * are memoized per time, see `FunctionOfTimeHelpers::EvaluationCache`.
+ *
  * \note This class conforms to the requirements of the
  * `Parallel::GlobalCache` for objects held by mutable global cache tags.
  */
@@ -52,19 +56,22 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// 0 and `update` has been called for time `t`, the updated value
   /// is ignored.
   std::array<DataVector, 1> func(double t) const override {
-    return func_and_derivs<0>(t);
+    return evaluation_cache_.get<0>(
+        t, [this, t]() { return func_and_derivs<0>(t); });
   }
   /// Returns the function and its first derivative at an arbitrary time `t`.
   /// If `MaxDeriv` is 1 and `update` has been called for time `t`, the updated
   /// value is ignored.
   std::array<DataVector, 2> func_and_deriv(double t) const override {
-    return func_and_derivs<1>(t);
+    return evaluation_cache_.get<1>(
+        t, [this, t]() { return func_and_derivs<1>(t); });
   }
   /// Returns the function and the first two derivatives at an arbitrary time
   /// `t`.  If `MaxDeriv` is 2 and `update` has been called for time `t`, the
   /// updated value is ignored.
   std::array<DataVector, 3> func_and_2_derivs(double t) const override {
-    return func_and_derivs<2>(t);
+    return evaluation_cache_.get<2>(
+        t, [this, t]() { return func_and_derivs<2>(t); });
   }
 
   /// Return the function and all derivs up to and including the `MaxDeriv` at
@@ -101,6 +108,11 @@ class PiecewisePolynomial : public FunctionOfTime {
       std::ostream& os,
       const PiecewisePolynomial<LocalMaxDeriv>& piecewise_polynomial);
 
+  // Integrates the angle without filling the evaluation cache with the
+  // intermediate times of the ODE solver.
+  template <size_t LocalMaxDeriv>
+  friend class QuaternionFunctionOfTime;
+
   void unpack_old_version(PUP::er& p, size_t version);
 
   /// Returns the function and `MaxDerivReturned` derivatives at
@@ -116,6 +128,7 @@ class PiecewisePolynomial : public FunctionOfTime {
   FunctionOfTimeHelpers::ThreadsafeList<std::array<DataVector, MaxDeriv + 1>>
       deriv_info_at_update_times_;
   std::map<double, std::pair<DataVector, double>> update_backlog_{};
+  FunctionOfTimeHelpers::EvaluationCache evaluation_cache_{};
 };
 
 template <size_t MaxDeriv>
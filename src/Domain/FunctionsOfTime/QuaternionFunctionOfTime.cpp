@@ -112,6 +112,9 @@ void QuaternionFunctionOfTime<MaxDeriv>::pup(PUP::er& p) {
   if (version >= 5) {
     p | update_backlog_;
   }
+  if (p.isUnpacking()) {
+    evaluation_cache_.invalidate();
+  }
 }
 
 namespace {
@@ -203,6 +206,7 @@ void QuaternionFunctionOfTime<MaxDeriv>::update(
   const double angle_expiration_time = angle_f_of_t_.time_bounds()[1];
   if (angle_expiration_time < next_expiration_time) {
     update_backlog_[time_of_update] = next_expiration_time;
+    evaluation_cache_.invalidate();
     return;
   }
 
@@ -230,6 +234,7 @@ void QuaternionFunctionOfTime<MaxDeriv>::update(
 
     update_backlog_.erase(entry);
   }
+  evaluation_cache_.invalidate();
 }
 
 template <size_t MaxDeriv>
@@ -253,7 +258,7 @@ void QuaternionFunctionOfTime<MaxDeriv>::solve_quaternion_ode(
                       const double time) {
         // multiply time and rhs by factor for reasons explained above
         const boost::math::quaternion<double> omega = datavector_to_quaternion(
-            angle_f_of_t_.func_and_deriv(time * factor)[1]);
+            angle_f_of_t_.template func_and_derivs<1>(time * factor)[1]);
         dt_state = factor * 0.5 * state * omega;
       };
 
@@ -292,13 +297,18 @@ boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
 template <size_t MaxDeriv>
 std::array<DataVector, 1> QuaternionFunctionOfTime<MaxDeriv>::quat_func(
     const double t) const {
-  return std::array<DataVector, 1>{quaternion_to_datavector(setup_func(t))};
+  // Solving the ODE dominates the cost of all evaluations, so only the
+  // quaternion itself is memoized. The angle is memoized by `angle_f_of_t_`.
+  return evaluation_cache_.get<0>(t, [this, t]() {
+    return std::array<DataVector, 1>{quaternion_to_datavector(setup_func(t))};
+  });
 }
 
 template <size_t MaxDeriv>
 std::array<DataVector, 2>
 QuaternionFunctionOfTime<MaxDeriv>::quat_func_and_deriv(const double t) const {
-  boost::math::quaternion<double> quat = setup_func(t);
+  boost::math::quaternion<double> quat =
+      datavector_to_quaternion(quat_func(t)[0]);
 
   // Get angle and however many derivatives we need
   std::array<DataVector, 2> angle_and_deriv = angle_f_of_t_.func_and_deriv(t);
@@ -316,7 +326,8 @@ template <size_t MaxDeriv>
 std::array<DataVector, 3>
 QuaternionFunctionOfTime<MaxDeriv>::quat_func_and_2_derivs(
     const double t) const {
-  boost::math::quaternion<double> quat = setup_func(t);
+  boost::math::quaternion<double> quat =
+      datavector_to_quaternion(quat_func(t)[0]);
 
   // Get angle and however many derivatives we need
   std::array<DataVector, 3> angle_and_2_derivs =
@@ -340,7 +351,8 @@ template <size_t MaxDeriv>
 std::array<DataVector, 4>
 QuaternionFunctionOfTime<MaxDeriv>::quat_func_and_3_derivs(
     const double t) const {
-  boost::math::quaternion<double> quat = setup_func(t);
+  boost::math::quaternion<double> quat =
+      datavector_to_quaternion(quat_func(t)[0]);
 
   // Get angle and however many derivatives we need
   std::vector<DataVector> angle_and_all_derivs =
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
@@ -55,6 +56,10 @@ namespace domain::FunctionsOfTime {
  * are needed for the map). This is all to keep the symmetry of naming
  * `angle_func` and `quat_func` so that function calls won't be ambiguous.
  *
+ * Since every evaluation of the quaternion solves an ODE from the last update
+ * time, the quaternion is memoized per time, see
+ * `FunctionOfTimeHelpers::EvaluationCache`.
+ *
  * \note This class conforms to the requirements of the
  * `Parallel::GlobalCache` for objects held by mutable global cache tags.
  */
@@ -169,6 +174,7 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
       stored_quaternions_and_times_{};
   domain::FunctionsOfTime::PiecewisePolynomial<MaxDeriv> angle_f_of_t_{};
   std::map<double, double> update_backlog_{};
+  FunctionOfTimeHelpers::EvaluationCache evaluation_cache_{};
 
   void unpack_old_version(PUP::er& p, size_t version);
 
@@ -10,6 +10,7 @@
 #include <pup.h>
 
 #include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 
@@ -27,6 +28,9 @@ namespace FunctionsOfTime {
 /// of \f$\tau\f$. The resultant
 /// function is \f[ g(t) = A + (B+C(t-t_0)) e^{-(t-t_0)/\tau} \f]
 /// where \f$\tau\f$=`decay_time` and \f$t_0\f$=`match_time`.
+///
+/// The evaluations are memoized per time, see
+/// `FunctionOfTimeHelpers::EvaluationCache`.
 class SettleToConstant : public FunctionOfTime {
  public:
   SettleToConstant() = default;
@@ -48,16 +52,19 @@ class SettleToConstant : public FunctionOfTime {
 
   /// Returns the function at an arbitrary time `t`.
   std::array<DataVector, 1> func(const double t) const override {
-    return func_and_derivs<0>(t);
+    return evaluation_cache_.get<0>(
+        t, [this, t]() { return func_and_derivs<0>(t); });
   }
   /// Returns the function and its first derivative at an arbitrary time `t`.
   std::array<DataVector, 2> func_and_deriv(const double t) const override {
-    return func_and_derivs<1>(t);
+    return evaluation_cache_.get<1>(
+        t, [this, t]() { return func_and_derivs<1>(t); });
   }
   /// Returns the function and the first two derivatives at an arbitrary time
   /// `t`.
   std::array<DataVector, 3> func_and_2_derivs(const double t) const override {
-    return func_and_derivs<2>(t);
+    return evaluation_cache_.get<2>(
+        t, [this, t]() { return func_and_derivs<2>(t); });
   }
 
   /// Returns the domain of validity of the function.
@@ -82,6 +89,7 @@ class SettleToConstant : public FunctionOfTime {
   DataVector coef_a_, coef_b_, coef_c_;
   double match_time_{std::numeric_limits<double>::signaling_NaN()};
   double inv_decay_time_{std::numeric_limits<double>::signaling_NaN()};
+  FunctionOfTimeHelpers::EvaluationCache evaluation_cache_{};
 };
 
 bool operator!=(const SettleToConstant& lhs, const SettleToConstant& rhs);
@@ -54,6 +54,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace Tags {
@@ -172,9 +173,13 @@ struct TciAndRollback {
     // by documentation, the switching back to DG TCI gets passed in the
     // exponent it should use, and to keep the interface between the TCIs
     // consistent, we also pass the exponent in separately here.
-    std::tuple<int, RdmpTciData> tci_result = db::mutate_apply<TciMutator>(
-        make_not_null(&box), subcell_options.persson_exponent(),
-        not subcell_allowed_in_element);
+    std::tuple<int, RdmpTciData> tci_result = [&box, &subcell_options,
+                                               subcell_allowed_in_element]() {
+      SPECTRE_TRACE_SCOPE(tracing::name<TciMutator>());
+      return db::mutate_apply<TciMutator>(make_not_null(&box),
+                                          subcell_options.persson_exponent(),
+                                          not subcell_allowed_in_element);
+    }();
 
     const int tci_decision = std::get<0>(tci_result);
     db::mutate<Tags::TciDecision>(
@@ -44,6 +44,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace Parallel {
@@ -210,9 +211,12 @@ struct TciAndSwitchToDg {
     }
 
     std::tuple<int, evolution::dg::subcell::RdmpTciData> tci_result =
-        db::mutate_apply<TciMutator>(make_not_null(&box),
-                                     subcell_options.persson_exponent() + 1.0,
-                                     only_need_rdmp_data);
+        [&box, &subcell_options, only_need_rdmp_data]() {
+          SPECTRE_TRACE_SCOPE(tracing::name<TciMutator>());
+          return db::mutate_apply<TciMutator>(
+              make_not_null(&box), subcell_options.persson_exponent() + 1.0,
+              only_need_rdmp_data);
+        }();
 
     db::mutate<evolution::dg::subcell::Tags::DataForRdmpTci,
                evolution::dg::subcell::Tags::TciCallsSinceRollback,
@@ -59,6 +59,7 @@
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace Tags {
@@ -667,6 +668,7 @@ struct ApplyBoundaryCorrections {
       const TimeDelta& time_step, const double dense_output_time,
       const Scalar<DataVector>& gts_det_inv_jacobian,
       const VolumeArgs&... volume_args) {
+    SPECTRE_TRACE_SCOPE("ApplyBoundaryCorrections");
     tuples::tagged_tuple_from_typelist<db::wrap_tags_in<
         detail::TemporaryReference, volume_tags_for_dg_boundary_terms>>
         volume_args_tuple{volume_args...};
@@ -60,6 +60,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace Tags {
@@ -111,6 +112,14 @@ struct get_primitive_tags_for_face {
  * interior contributions to the time derivatives (both nonconservative products
  * and source terms). The internal mortar data is also computed.
  *
+ * With global time stepping the mortar data is sent to the neighbors as soon
+ * as it is computed, i.e. right after the volume fluxes. The flux divergence
+ * and the external boundary conditions are computed afterwards, so that this
+ * work overlaps with the communication instead of delaying it. With local time
+ * stepping the data sent to the neighbors includes the next time step, so the
+ * data is only sent after the time derivative is complete and the step was
+ * taken.
+ *
  * The general first-order hyperbolic evolution equation solved for conservative
  * systems is:
  *
@@ -446,7 +455,9 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
           detail::OneOverNormalVectorMagnitude, detail::NormalVector<Dim>>>>;
   // To avoid additional allocations in internal_mortar_data, we provide a
   // buffer used to compute the packaged data before it has to be projected to
-  // the mortar. We get all mortar tags for similar reasons as described above
+  // the mortars. The buffer holds the packaged data of all faces so that the
+  // projections can be batched. We get all mortar tags for similar reasons as
+  // described above
   using all_mortar_tags = tmpl::remove_duplicates<tmpl::flatten<
       tmpl::transform<derived_boundary_corrections,
                       detail::get_dg_package_field_tags<tmpl::_1>>>>;
@@ -454,8 +465,10 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
   // We also don't use the number of volume mesh grid points. We instead use the
   // max number of grid points from each face. That way, our allocation will be
   // large enough to hold any face and we can reuse the allocation for each face
-  // without having to resize it.
+  // without having to resize it. The packaged data buffer instead holds all
+  // faces at once.
   size_t num_face_temporary_grid_points = 0;
+  size_t num_packaged_data_grid_points = 0;
   {
     for (const auto& [direction, neighbors_in_direction] :
          db::get<domain::Tags::Element<Dim>>(box).neighbors()) {
@@ -463,6 +476,7 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       const auto face_mesh = mesh.slice_away(direction.dimension());
       num_face_temporary_grid_points = std::max(
           num_face_temporary_grid_points, face_mesh.number_of_grid_points());
+      num_packaged_data_grid_points += face_mesh.number_of_grid_points();
     }
   }
 
@@ -498,9 +512,10 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
           number_of_grid_points +
       // Different number of grid points. See explanation above where
       // num_face_temporary_grid_points is defined
-      (VarsFaceTemporaries::number_of_independent_components +
-       DgPackagedDataVarsOnFace::number_of_independent_components) *
-          num_face_temporary_grid_points;
+      VarsFaceTemporaries::number_of_independent_components *
+          num_face_temporary_grid_points +
+      DgPackagedDataVarsOnFace::number_of_independent_components *
+          num_packaged_data_grid_points;
   auto buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
 #ifdef SPECTRE_DEBUG
   std::fill(&buffer[0], &buffer[buffer_size],
@@ -548,7 +563,7 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       // Different number of grid points. See explanation above where
       // num_face_temporary_grid_points is defined
       DgPackagedDataVarsOnFace::number_of_independent_components *
-          num_face_temporary_grid_points);
+          num_packaged_data_grid_points);
 
   const Scalar<DataVector>* det_inverse_jacobian = nullptr;
   if constexpr (tmpl::size<flux_variables>::value != 0) {
@@ -561,11 +576,8 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
   db::mutate_apply<
       tmpl::list<dt_variables_tag>,
       typename compute_volume_time_derivative_terms::argument_tags>(
-      [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
-       &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
+      [&div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
        &evolved_variables = db::get<variables_tag>(box),
-       &inertial_coordinates =
-           db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
        &logical_to_inertial_inv_jacobian =
            db::get<::domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
                                                    Frame::Inertial>>(box),
@@ -575,13 +587,12 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
               db::wrap_tags_in<::Tags::dt, typename variables_tag::tags_list>>*>
               dt_vars_ptr,
           const auto&... time_derivative_args) {
+        SPECTRE_TRACE_SCOPE("ComputeTimeDerivative::VolumeTerms");
         detail::volume_terms<compute_volume_time_derivative_terms>(
             dt_vars_ptr, make_not_null(&volume_fluxes),
             make_not_null(&partial_derivs), make_not_null(&temporaries),
-            make_not_null(&div_fluxes), evolved_variables, dg_formulation, mesh,
-            inertial_coordinates, logical_to_inertial_inv_jacobian,
-            det_inverse_jacobian, mesh_velocity, div_mesh_velocity,
-            time_derivative_args...);
+            evolved_variables, mesh, logical_to_inertial_inv_jacobian,
+            mesh_velocity, div_mesh_velocity, time_derivative_args...);
       },
       make_not_null(&box));
 
@@ -597,12 +608,13 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       "All createable classes for boundary corrections must be marked "
       "final.");
   tmpl::for_each<derived_boundary_corrections>(
-      [&boundary_correction, &box, &partial_derivs, &primitive_vars,
-       &temporaries, &volume_fluxes, &packaged_data_buffer,
+      [&boundary_correction, &box, &primitive_vars, &temporaries,
+       &volume_fluxes, &packaged_data_buffer,
        &face_temporaries](auto derived_correction_v) {
         using DerivedCorrection =
             tmpl::type_from<decltype(derived_correction_v)>;
         if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+          SPECTRE_TRACE_SCOPE("ComputeTimeDerivative::BoundaryTerms");
           // Compute internal boundary quantities on the mortar for sides
           // of the element that have neighbors, i.e. they are not an
           // external side.
@@ -616,7 +628,52 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
               db::get<variables_tag>(box), volume_fluxes, temporaries,
               primitive_vars,
               typename DerivedCorrection::dg_package_data_volume_tags{});
+        }
+      });
+
+  // With global time stepping the data sent to the neighbors only depends on
+  // the fluxes and the mortar data, so we send it before doing the rest of the
+  // work on the time derivative, which then overlaps with the communication.
+  // With local time stepping the time step must be taken, which requires the
+  // full time derivative, before sending the next time step id.
+  if constexpr (not LocalTimeStepping) {
+    send_data_for_fluxes<ParallelComponent>(
+        make_not_null(&cache), make_not_null(&box), volume_fluxes);
+  }
 
+  const Scalar<DataVector>* det_inverse_jacobian = nullptr;
+  if constexpr (tmpl::size<flux_variables>::value != 0) {
+    if (dg_formulation == ::dg::Formulation::WeakInertial) {
+      det_inverse_jacobian = &db::get<
+          domain::Tags::DetInvJacobian<Frame::ElementLogical, Frame::Inertial>>(
+          box);
+    }
+  }
+  db::mutate<dt_variables_tag>(
+      [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
+       &inertial_coordinates =
+           db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
+       &logical_to_inertial_inv_jacobian =
+           db::get<::domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                                   Frame::Inertial>>(box),
+       &mesh, &volume_fluxes](const auto dt_vars_ptr) {
+        SPECTRE_TRACE_SCOPE("ComputeTimeDerivative::FluxDivergence");
+        detail::add_flux_divergence(
+            dt_vars_ptr, make_not_null(&div_fluxes), volume_fluxes,
+            dg_formulation, mesh, inertial_coordinates,
+            logical_to_inertial_inv_jacobian, det_inverse_jacobian);
+      },
+      make_not_null(&box));
+
+  tmpl::for_each<derived_boundary_corrections>(
+      [&boundary_correction, &box, &partial_derivs, &primitive_vars,
+       &temporaries, &volume_fluxes](auto derived_correction_v) {
+        using DerivedCorrection =
+            tmpl::type_from<decltype(derived_correction_v)>;
+        if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+          SPECTRE_TRACE_SCOPE("ComputeTimeDerivative::BoundaryConditions");
+          // The boundary conditions may use the time derivatives, so they must
+          // be applied after the flux divergence was added.
           detail::apply_boundary_conditions_on_all_external_faces<
               EvolutionSystem, Dim>(
               make_not_null(&box),
@@ -628,10 +685,9 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
   if constexpr (LocalTimeStepping) {
     take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
         make_not_null(&box));
+    send_data_for_fluxes<ParallelComponent>(
+        make_not_null(&cache), make_not_null(&box), volume_fluxes);
   }
-
-  send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
-                                          make_not_null(&box), volume_fluxes);
   return {Parallel::AlgorithmExecution::Continue, std::nullopt};
 }
 
@@ -647,6 +703,7 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
         [[maybe_unused]] const Variables<db::wrap_tags_in<
             ::Tags::Flux, typename EvolutionSystem::flux_variables,
             tmpl::size_t<Dim>, Frame::Inertial>>& volume_fluxes) {
+  SPECTRE_TRACE_SCOPE("ComputeTimeDerivative::SendData");
   auto& receiver_proxy =
       Parallel::get_parallel_component<ParallelComponent>(*cache);
   const auto& element = db::get<domain::Tags::Element<Dim>>(*box);
@@ -7,6 +7,7 @@
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -94,6 +95,32 @@ void internal_mortar_data_impl(
       detail::OneOverNormalVectorMagnitude, detail::NormalVector<Dim>>>>;
   FieldsOnFace fields_on_face{};
   std::optional<tnsr::I<DataVector, Dim>> face_mesh_velocity{};
+  // The projections to the mortars are done after the packaged data was
+  // computed on all faces, so the faces that use the same projection matrices
+  // can be projected together. The packaged data of the faces that need a
+  // projection is stored one after the other in the packaged_data_buffer.
+  std::vector<::dg::MortarProjection<Dim - 1>> mortar_projections{};
+  size_t packaged_data_buffer_offset = 0;
+  const auto use_packaged_data_buffer =
+      [&packaged_data_buffer, &packaged_data_buffer_offset](
+          const gsl::not_null<Variables<mortar_tags_list>*> packaged_data,
+          const size_t total_face_size) {
+        // The buffer is guaranteed to be big enough because we allocated it
+        // in ComputeTimeDerivative with the number of grid points of all
+        // faces. We still check anyways in Debug mode to be safe
+        ASSERT(packaged_data_buffer->size() >=
+                   packaged_data_buffer_offset + total_face_size,
+               "The buffer for the packaged data which was allocated in "
+               "ComputeTimeDerivative is not large enough. It's size is "
+                   << packaged_data_buffer->size()
+                   << ", but needs to be at least "
+                   << packaged_data_buffer_offset + total_face_size);
+        packaged_data->set_data_ref(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            packaged_data_buffer->data() + packaged_data_buffer_offset,
+            total_face_size);
+        packaged_data_buffer_offset += total_face_size;
+      };
   for (const auto& [direction, neighbors_in_direction] : element.neighbors()) {
     const Mesh<Dim - 1> face_mesh =
         volume_mesh.slice_away(direction.dimension());
@@ -247,8 +274,8 @@ void internal_mortar_data_impl(
       if (Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)) {
         // The face mesh will be assigned below along with ensuring the size of
         // the mortar data is correct
-        packaged_data.set_data_ref(packaged_data_buffer->data(),
-                                   total_face_size);
+        use_packaged_data_buffer(make_not_null(&packaged_data),
+                                 total_face_size);
       } else {
         // Can use the local_mortar_data
         auto& local_mortar = mortar_data_ptr->at(mortar_id).local();
@@ -271,7 +298,7 @@ void internal_mortar_data_impl(
       // In this case, we have multiple neighbors in this direction so all will
       // need to project their data which means we use the
       // packaged_data_buffer to calculate the dg_package_data
-      packaged_data.set_data_ref(packaged_data_buffer->data(), total_face_size);
+      use_packaged_data_buffer(make_not_null(&packaged_data), total_face_size);
     }
 
     detail::dg_package_data<System>(
@@ -281,7 +308,7 @@ void internal_mortar_data_impl(
         face_mesh_velocity, dg_package_data_projected_tags{},
         package_data_volume_args...);
 
-    // Perform step 3
+    // Perform step 3, which is finished after the loop over the directions
     // This will only do something if
     //  a) we have multiple neighbors in this direction
     // or
@@ -307,14 +334,15 @@ void internal_mortar_data_impl(
             mortar_mesh.number_of_grid_points() *
             Variables<mortar_tags_list>::number_of_independent_components);
 
-        Variables<mortar_tags_list> projected_packaged_data{
-            local_mortar_data.data(), local_mortar_data.size()};
-        ::dg::project_to_mortar(make_not_null(&projected_packaged_data),
-                                packaged_data, face_mesh, mortar_mesh,
-                                mortar_size);
+        mortar_projections.push_back(::dg::MortarProjection<Dim - 1>{
+            packaged_data.data(), local_mortar_data.data(), face_mesh,
+            mortar_mesh, mortar_size});
       }
     }
   }
+  ::dg::project_to_mortars(
+      mortar_projections,
+      Variables<mortar_tags_list>::number_of_independent_components);
 }
 
 template <typename System, size_t Dim, typename BoundaryCorrection,
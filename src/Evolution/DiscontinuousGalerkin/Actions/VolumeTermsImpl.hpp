@@ -39,8 +39,8 @@ namespace evolution::dg::Actions::detail {
  *    The source terms and nonconservative products are contributed directly
  *    to the `dt_vars` arguments passed to the time derivative function, while
  *    the volume fluxes are computed into the `volume_fluxes` arguments. The
- *    divergence of the volume fluxes will be computed and added to the time
- *    derivatives later in the function.
+ *    divergence of the volume fluxes is added to the time derivatives by
+ *    `add_flux_divergence()`.
  *
  * 3. If the mesh is moving the appropriate mesh velocity terms are added to
  *    the equations.
@@ -50,14 +50,9 @@ namespace evolution::dg::Actions::detail {
  *    to the time derivatives. For equations without fluxes
  *    \f$v^i\partial_i u_\alpha\f$ is added to the time derivatives.
  *
- * 4. Compute flux divergence contribution and add it to the time derivatives.
- *
- *    Either the weak or strong form can be used. Currently only the strong
- *    form is coded, but adding the weak form is quite easy.
- *
- *    Note that the computation of the flux divergence and adding that to the
- *    time derivative must be done *after* the mesh velocity is subtracted
- *    from the fluxes.
+ * The divergence of the fluxes is added to the time derivatives separately by
+ * `add_flux_divergence()`, so that the face data, which only needs the fluxes,
+ * can be sent to the neighbors before the divergence is computed.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -75,20 +70,40 @@ void volume_terms(
     [[maybe_unused]] const gsl::not_null<
         Variables<tmpl::list<TemporaryTags...>>*>
         temporaries,
-    [[maybe_unused]] const gsl::not_null<
-        Variables<tmpl::list<::Tags::div<::Tags::Flux<
-            FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
-        div_fluxes,
     const Variables<tmpl::list<VariablesTags...>>& evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<Dim>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, Dim, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<Dim>& mesh,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
     const TimeDerivativeArguments&... time_derivative_args);
+/*
+ * Computes the divergence of the volume fluxes and adds it to the time
+ * derivatives.
+ *
+ * Either the strong or the weak form can be used. This must be done *after*
+ * the mesh velocity is subtracted from the fluxes by `volume_terms()`. It is
+ * a separate function so that `ComputeTimeDerivative` can send the face data
+ * to the neighbors, which only needs the fluxes, before doing this work.
+ *
+ * `det_inverse_jacobian` is only used for the weak form.
+ */
+template <size_t Dim, typename... VariablesTags, typename... FluxVariablesTags>
+void add_flux_divergence(
+    gsl::not_null<Variables<tmpl::list<::Tags::dt<VariablesTags>...>>*>
+        dt_vars_ptr,
+    gsl::not_null<Variables<tmpl::list<::Tags::div<::Tags::Flux<
+        FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
+        div_fluxes,
+    const Variables<tmpl::list<::Tags::Flux<
+        FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>...>>&
+        volume_fluxes,
+    ::dg::Formulation dg_formulation, const Mesh<Dim>& mesh,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coordinates,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          Frame::Inertial>&
+        logical_to_inertial_inverse_jacobian,
+    const Scalar<DataVector>* det_inverse_jacobian);
 }  // namespace evolution::dg::Actions::detail
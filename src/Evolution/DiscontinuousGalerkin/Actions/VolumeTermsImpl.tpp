@@ -49,8 +49,8 @@ namespace evolution::dg::Actions::detail {
  *    The source terms and nonconservative products are contributed directly
  *    to the `dt_vars` arguments passed to the time derivative function, while
  *    the volume fluxes are computed into the `volume_fluxes` arguments. The
- *    divergence of the volume fluxes will be computed and added to the time
- *    derivatives later in the function.
+ *    divergence of the volume fluxes is added to the time derivatives by
+ *    `add_flux_divergence()`.
  *
  * 3. If the mesh is moving the appropriate mesh velocity terms are added to
  *    the equations.
@@ -60,14 +60,9 @@ namespace evolution::dg::Actions::detail {
  *    to the time derivatives. For equations without fluxes
  *    \f$v^i\partial_i u_\alpha\f$ is added to the time derivatives.
  *
- * 4. Compute flux divergence contribution and add it to the time derivatives.
- *
- *    Either the weak or strong form can be used. Currently only the strong
- *    form is coded, but adding the weak form is quite easy.
- *
- *    Note that the computation of the flux divergence and adding that to the
- *    time derivative must be done *after* the mesh velocity is subtracted
- *    from the fluxes.
+ * The divergence of the fluxes is added to the time derivatives separately by
+ * `add_flux_divergence()`, so that the face data, which only needs the fluxes,
+ * can be sent to the neighbors before the divergence is computed.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -85,18 +80,11 @@ void volume_terms(
     [[maybe_unused]] const gsl::not_null<
         Variables<tmpl::list<TemporaryTags...>>*>
         temporaries,
-    [[maybe_unused]] const gsl::not_null<
-        Variables<tmpl::list<::Tags::div<::Tags::Flux<
-            FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
-        div_fluxes,
     const Variables<tmpl::list<VariablesTags...>>& evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<Dim>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, Dim, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<Dim>& mesh,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
@@ -233,18 +221,42 @@ void volume_terms(
       }
     });
   }
+}
+
+template <size_t Dim, typename... VariablesTags, typename... FluxVariablesTags>
+void add_flux_divergence(
+    [[maybe_unused]] const gsl::not_null<
+        Variables<tmpl::list<::Tags::dt<VariablesTags>...>>*>
+        dt_vars_ptr,
+    [[maybe_unused]] const gsl::not_null<
+        Variables<tmpl::list<::Tags::div<::Tags::Flux<
+            FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>>...>>*>
+        div_fluxes,
+    [[maybe_unused]] const Variables<tmpl::list<::Tags::Flux<
+        FluxVariablesTags, tmpl::size_t<Dim>, Frame::Inertial>...>>&
+        volume_fluxes,
+    const ::dg::Formulation dg_formulation,
+    [[maybe_unused]] const Mesh<Dim>& mesh,
+    [[maybe_unused]] const tnsr::I<DataVector, Dim, Frame::Inertial>&
+        inertial_coordinates,
+    [[maybe_unused]] const InverseJacobian<DataVector, Dim,
+                                           Frame::ElementLogical,
+                                           Frame::Inertial>&
+        logical_to_inertial_inverse_jacobian,
+    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian) {
+  using flux_variables = tmpl::list<FluxVariablesTags...>;
 
   // Add the flux divergence term to du_\alpha/dt, which must be done
   // after the corrections for the moving mesh are made.
-  if constexpr (has_fluxes) {
+  if constexpr (sizeof...(FluxVariablesTags) != 0) {
     if (dg_formulation == ::dg::Formulation::StrongInertial) {
-      divergence(div_fluxes, *volume_fluxes, mesh,
+      divergence(div_fluxes, volume_fluxes, mesh,
                  logical_to_inertial_inverse_jacobian);
     } else if (dg_formulation == ::dg::Formulation::WeakInertial) {
       // We should ideally not recompute the
       // det_jac_times_inverse_jacobian for non-moving meshes.
       if constexpr (Dim == 1) {
-        weak_divergence(div_fluxes, *volume_fluxes, mesh, {});
+        weak_divergence(div_fluxes, volume_fluxes, mesh, {});
       } else {
         // The Jacobian should be computed as a compute tag
         const auto jacobian =
@@ -255,7 +267,7 @@ void volume_terms(
         ::dg::metric_identity_det_jac_times_inv_jac(
             make_not_null(&det_jac_times_inverse_jacobian), mesh,
             inertial_coordinates, jacobian);
-        weak_divergence(div_fluxes, *volume_fluxes, mesh,
+        weak_divergence(div_fluxes, volume_fluxes, mesh,
                         det_jac_times_inverse_jacobian);
       }
       ASSERT(det_inverse_jacobian != nullptr,
@@ -289,3 +301,24 @@ void volume_terms(
   }
 }
 }  // namespace evolution::dg::Actions::detail
+
+#define INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(SYSTEM, DIM)               \
+  template void evolution::dg::Actions::detail::add_flux_divergence(           \
+      gsl::not_null<Variables<db::wrap_tags_in<                                \
+          ::Tags::dt, typename SYSTEM::variables_tag::tags_list>>*>            \
+          dt_vars_ptr,                                                         \
+      gsl::not_null<Variables<db::wrap_tags_in<                                \
+          ::Tags::div,                                                         \
+          db::wrap_tags_in<::Tags::Flux, typename SYSTEM::flux_variables,      \
+                           tmpl::size_t<DIM>, Frame::Inertial>>>*>             \
+          div_fluxes,                                                          \
+      const Variables<                                                         \
+          db::wrap_tags_in<::Tags::Flux, typename SYSTEM::flux_variables,      \
+                           tmpl::size_t<DIM>, Frame::Inertial>>&               \
+          volume_fluxes,                                                       \
+      ::dg::Formulation dg_formulation, const Mesh<DIM>& mesh,                 \
+      const tnsr::I<DataVector, DIM, Frame::Inertial>& inertial_coordinates,   \
+      const InverseJacobian<DataVector, DIM, Frame::ElementLogical,            \
+                            Frame::Inertial>&                                  \
+          logical_to_inertial_inverse_jacobian,                                \
+      const Scalar<DataVector>* det_inverse_jacobian);
@@ -7,6 +7,7 @@
 #include <bitset>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <ostream>
 #include <vector>
 
@@ -216,6 +217,11 @@ ConstrainedFitCache<VolumeDim>::ConstrainedFitCache(
           mesh, element, quadrature_weights, interpolation_matrices,
           quadrature_weights_dot_interpolation_matrices, primary_dir,
           nothing_to_exclude);
+      inverse_a_times_quadrature_weights[primary_dir][primary_dir] =
+          apply_matrices(std::array<std::reference_wrapper<const Matrix>, 1>{
+                             {inverse_a_matrices[primary_dir][primary_dir]}},
+                         quadrature_weights,
+                         Index<1>(quadrature_weights.size()));
     } else {
       // Cache only handles the case of 1 neighbor to exclude.
       for (const auto& dir_to_exclude : directions_with_neighbors) {
@@ -228,6 +234,11 @@ ConstrainedFitCache<VolumeDim>::ConstrainedFitCache(
             mesh, element, quadrature_weights, interpolation_matrices,
             quadrature_weights_dot_interpolation_matrices, primary_dir,
             {{dir_to_exclude}});
+        inverse_a_times_quadrature_weights[primary_dir][dir_to_exclude] =
+            apply_matrices(
+                std::array<std::reference_wrapper<const Matrix>, 1>{
+                    {inverse_a_matrices[primary_dir][dir_to_exclude]}},
+                quadrature_weights, Index<1>(quadrature_weights.size()));
       }
     }
   }
@@ -253,6 +264,28 @@ const Matrix& ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_matrix(
   }
 }
 
+template <size_t VolumeDim>
+const DataVector&
+ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_times_quadrature_weights(
+    const Direction<VolumeDim>& primary_direction,
+    const std::vector<Direction<VolumeDim>>& directions_to_exclude) const {
+  if (LIKELY(directions_to_exclude.size() == 1)) {
+    return inverse_a_times_quadrature_weights.at(primary_direction)
+        .at(directions_to_exclude[0]);
+  } else if (directions_to_exclude.empty()) {
+    return inverse_a_times_quadrature_weights.at(primary_direction)
+        .at(primary_direction);
+  } else {
+    ERROR(
+        "Cache misuse error: asked to retrieve a cached A^{-1} w vector for a\n"
+        "configuration where multiple neighboring elements are excluded from\n"
+        "the HWENO fit. Because this case is so rare, it is not handled by\n"
+        "the cache. The caller should check for multiple neighbors being\n"
+        "excluded, and, if this occurs, should bypass the cache and compute\n"
+        "A^{-1} w directly.");
+  }
+}
+
 namespace {
 
 template <size_t VolumeDim, size_t DummyIndex>
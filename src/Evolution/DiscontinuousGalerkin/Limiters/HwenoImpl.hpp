@@ -28,6 +28,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -97,6 +98,13 @@ class ConstrainedFitCache {
       const Direction<VolumeDim>& primary_direction,
       const std::vector<Direction<VolumeDim>>& directions_to_exclude) const;
 
+  // The product A^{-1} w of the cached A^{-1} matrix with the quadrature
+  // weights. This term is needed by every constrained fit, but doesn't depend
+  // on the data being fit. Same constraints on directions_to_exclude as above.
+  const DataVector& retrieve_inverse_a_times_quadrature_weights(
+      const Direction<VolumeDim>& primary_direction,
+      const std::vector<Direction<VolumeDim>>& directions_to_exclude) const;
+
   DataVector quadrature_weights;
   DirectionMap<VolumeDim, Matrix> interpolation_matrices;
   DirectionMap<VolumeDim, DataVector>
@@ -110,6 +118,9 @@ class ConstrainedFitCache {
   // the data in the normally-nonsensical slot where
   // excluded_neighbor == primary_neighbor.
   DirectionMap<VolumeDim, DirectionMap<VolumeDim, Matrix>> inverse_a_matrices;
+  // A^{-1} w for each A^{-1} in inverse_a_matrices, stored in the same slots.
+  DirectionMap<VolumeDim, DirectionMap<VolumeDim, DataVector>>
+      inverse_a_times_quadrature_weights;
 };
 
 // Return the appropriate cache for the given mesh and element.
@@ -245,14 +256,13 @@ DataVector b_vector(
     const auto& neighbor_tensor_component =
         get<Tag>(neighbor_and_data.second.volume_data)[tensor_index];
 
-    // Add terms from the primary neighbor
+    // Add terms from the primary neighbor: b += I^T (w * u)
     if (neighbor_and_data.first == primary_neighbor) {
-      for (size_t r = 0; r < neighbor_mesh.number_of_grid_points(); ++r) {
-        for (size_t s = 0; s < number_of_grid_points; ++s) {
-          b[s] += neighbor_tensor_component[r] *
-                  neighbor_quadrature_weights[r] * interpolation_matrix(r, s);
-        }
-      }
+      const DataVector weighted_neighbor_tensor_component =
+          neighbor_tensor_component * neighbor_quadrature_weights;
+      dgemv_('T', neighbor_mesh.number_of_grid_points(), number_of_grid_points,
+             1., interpolation_matrix.data(), interpolation_matrix.spacing(),
+             weighted_neighbor_tensor_component.data(), 1, 1., b.data(), 1);
     }
     // Add terms from the secondary neighbors
     else {
@@ -313,14 +323,30 @@ void solve_constrained_fit(
   const DirectionMap<VolumeDim, DataVector>& w_dot_interp_matrices =
       cache.quadrature_weights_dot_interpolation_matrices;
 
-  // Use cache if possible, or compute matrix if we are in edge case
+  // Use cache if possible, or compute A^{-1} and A^{-1} w if we are in the
+  // edge case. The uncached terms are held in local variables so the cached
+  // terms are only referenced, never copied.
+  const bool use_cache = LIKELY(directions_to_exclude.size() < 2);
+  Matrix uncached_inverse_a{};
+  DataVector uncached_inverse_a_times_w{};
+  if (UNLIKELY(not use_cache)) {
+    uncached_inverse_a = inverse_a_matrix(mesh, element, w, interp_matrices,
+                                          w_dot_interp_matrices,
+                                          primary_direction,
+                                          directions_to_exclude);
+    uncached_inverse_a_times_w = apply_matrices(
+        std::array<std::reference_wrapper<const Matrix>, 1>{
+            {uncached_inverse_a}},
+        w, Index<1>(w.size()));
+  }
   const Matrix& inverse_a =
-      LIKELY(directions_to_exclude.size() < 2)
-          ? cache.retrieve_inverse_a_matrix(primary_direction,
-                                            directions_to_exclude)
-          : inverse_a_matrix(mesh, element, w, interp_matrices,
-                             w_dot_interp_matrices, primary_direction,
-                             directions_to_exclude);
+      use_cache ? cache.retrieve_inverse_a_matrix(primary_direction,
+                                                  directions_to_exclude)
+                : uncached_inverse_a;
+  const DataVector& inverse_a_times_w =
+      use_cache ? cache.retrieve_inverse_a_times_quadrature_weights(
+                      primary_direction, directions_to_exclude)
+                : uncached_inverse_a_times_w;
 
   const DataVector b = b_vector<Tag>(tensor_index, mesh, w, interp_matrices,
                                      w_dot_interp_matrices, neighbor_data,
@@ -330,9 +356,6 @@ void solve_constrained_fit(
   const DataVector inverse_a_times_b = apply_matrices(
       std::array<std::reference_wrapper<const Matrix>, 1>{{inverse_a}}, b,
       Index<1>(number_of_points));
-  const DataVector inverse_a_times_w = apply_matrices(
-      std::array<std::reference_wrapper<const Matrix>, 1>{{inverse_a}}, w,
-      Index<1>(number_of_points));
 
   // Compute Lagrange multiplier:
   // Note: we take w as an argument (instead of as a lambda capture), because
@@ -3,8 +3,10 @@
 
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoHelpers.hpp"
 
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <cstddef>
+#include <iterator>
 #include <unordered_map>
 #include <utility>
 
@@ -69,17 +71,39 @@ void reconstruct_from_weighted_sum(
     neighbor_weights[kv.first] = neighbor_linear_weight;
   }
 
+  // Compute the oscillation indicators of the local and all neighbor
+  // polynomials at once: the polynomials are packed into one buffer (local
+  // first, then the neighbors in the iteration order of
+  // `neighbor_polynomials`) so their modal coefficients and indicators are
+  // computed by a few large matrix multiplications.
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  DataVector polynomials((1 + neighbor_polynomials.size()) *
+                         number_of_grid_points);
+  std::copy(local_polynomial->begin(), local_polynomial->end(),
+            polynomials.begin());
+  size_t offset = number_of_grid_points;
+  for (const auto& kv : neighbor_polynomials) {
+    ASSERT(kv.second.size() == number_of_grid_points,
+           "The neighbor polynomial has " << kv.second.size()
+                                          << " points, but expected "
+                                          << number_of_grid_points);
+    std::copy(kv.second.begin(), kv.second.end(),
+              std::next(polynomials.begin(), static_cast<ptrdiff_t>(offset)));
+    offset += number_of_grid_points;
+  }
+  DataVector indicators{};
+  oscillation_indicators(make_not_null(&indicators), derivative_weight,
+                         polynomials, mesh);
+
   // Update `local_weights` and `neighbor_weights` to hold the unnormalized
   // nonlinear weights.
-  local_weight = unnormalized_nonlinear_weight(
-      local_weight,
-      oscillation_indicator(derivative_weight, *local_polynomial, mesh));
+  local_weight = unnormalized_nonlinear_weight(local_weight, indicators[0]);
+  size_t indicator_index = 1;
   for (const auto& kv : neighbor_polynomials) {
     const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
     neighbor_weights[key] = unnormalized_nonlinear_weight(
-        neighbor_weights[key],
-        oscillation_indicator(derivative_weight, neighbor_polynomial, mesh));
+        neighbor_weights[key], indicators[indicator_index]);
+    ++indicator_index;
   }
 
   // Update `local_weights` and `neighbor_weights` to hold the normalized
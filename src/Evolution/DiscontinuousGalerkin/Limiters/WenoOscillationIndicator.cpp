@@ -17,6 +17,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -232,9 +233,10 @@ std::ostream& operator<<(std::ostream& os, DerivativeWeight derivative_weight) {
 }
 
 template <size_t VolumeDim>
-double oscillation_indicator(const DerivativeWeight derivative_weight,
-                             const DataVector& data,
-                             const Mesh<VolumeDim>& mesh) {
+void oscillation_indicators(const gsl::not_null<DataVector*> indicators,
+                            const DerivativeWeight derivative_weight,
+                            const DataVector& data,
+                            const Mesh<VolumeDim>& mesh) {
   ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
          "Unsupported basis: " << mesh);
   ASSERT(mesh.quadrature() ==
@@ -246,30 +248,71 @@ double oscillation_indicator(const DerivativeWeight derivative_weight,
   // input data, so we need at least two modes => at least two grid points.
   ASSERT(*alg::min_element(mesh.extents().indices()) > 1,
          "Unsupported extents: " << mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  ASSERT(data.size() % number_of_grid_points == 0,
+         "The size of the data (" << data.size()
+                                  << ") is not a multiple of the number of "
+                                     "grid points of the mesh ("
+                                  << number_of_grid_points << ")");
+  const size_t number_of_sets = data.size() / number_of_grid_points;
+  indicators->destructive_resize(number_of_sets);
+  if (UNLIKELY(number_of_sets == 0)) {
+    return;
+  }
 
   const Matrix& indicator_matrix = cached_indicator_matrix_from_mesh_index(
       derivative_weight, mesh.extents());
+  // `apply_matrices` treats each set of data as one component, so this
+  // transforms all sets at once.
   const ModalVector coeffs = to_modal_coefficients(data, mesh);
 
-  double result = 0.;
   // Note: because the 0'th modal coefficient encodes the mean of the data and
   // does not contribute to the oscillation, it is safe to exclude it from the
-  // sum and start summing at m == 1, n == 1. Note also that the indicator
-  // matrix is computed excluding the m == 0, n == 0 elements, so the indexing
-  // is offset by 1.
-  for (size_t m = 1; m < mesh.number_of_grid_points(); ++m) {
-    for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
-      result += coeffs[m] * coeffs[n] * indicator_matrix(m - 1, n - 1);
+  // sum and start summing at m == 1, n == 1. The indicator matrix is computed
+  // excluding the m == 0, n == 0 elements, so we multiply it with the
+  // (N-1) x number_of_sets matrix of coefficients that starts at the m == 1
+  // coefficient of the first set and has a leading dimension of N.
+  const size_t number_of_modes = number_of_grid_points - 1;
+  DataVector matrix_times_coeffs(number_of_modes * number_of_sets);
+  dgemm_<true>('N', 'N', number_of_modes, number_of_sets, number_of_modes, 1.,
+               indicator_matrix.data(), indicator_matrix.spacing(),
+               coeffs.data() + 1, number_of_grid_points, 0.,
+               matrix_times_coeffs.data(), number_of_modes);
+  for (size_t k = 0; k < number_of_sets; ++k) {
+    const double* const set_coeffs = coeffs.data() + k * number_of_grid_points;
+    const double* const set_matrix_times_coeffs =
+        matrix_times_coeffs.data() + k * number_of_modes;
+    double result = 0.;
+    for (size_t m = 1; m < number_of_grid_points; ++m) {
+      result += set_coeffs[m] * set_matrix_times_coeffs[m - 1];
     }
+    (*indicators)[k] = result;
   }
-  return result;
+}
+
+template <size_t VolumeDim>
+double oscillation_indicator(const DerivativeWeight derivative_weight,
+                             const DataVector& data,
+                             const Mesh<VolumeDim>& mesh) {
+  ASSERT(data.size() == mesh.number_of_grid_points(),
+         "The size of the data (" << data.size()
+                                  << ") does not match the number of grid "
+                                     "points of the mesh ("
+                                  << mesh.number_of_grid_points() << ")");
+  DataVector indicator(1);
+  oscillation_indicators(make_not_null(&indicator), derivative_weight, data,
+                         mesh);
+  return indicator[0];
 }
 
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                        \
-  template double oscillation_indicator<DIM(data)>( \
+#define INSTANTIATE(_, data)                                            \
+  template void oscillation_indicators<DIM(data)>(                      \
+      gsl::not_null<DataVector*>, DerivativeWeight, const DataVector&,  \
+      const Mesh<DIM(data)>&);                                          \
+  template double oscillation_indicator<DIM(data)>(                     \
       DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
@@ -10,6 +10,10 @@
 class DataVector;
 template <size_t>
 class Mesh;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
 /// \endcond
 
 namespace Limiters::Weno_detail {
@@ -42,4 +46,22 @@ double oscillation_indicator(DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh);
 
+// Compute the WENO oscillation indicators of several sets of data at once
+//
+// `data` holds the values of `data.size() / mesh.number_of_grid_points()` sets
+// of data on `mesh`, stored one after the other (e.g., the local and all the
+// neighbor polynomials of a WENO reconstruction, or all components of a
+// tensor). The indicator of the k'th set of data is stored in
+// `(*indicators)[k]`.
+//
+// All sets of data are transformed to their modal coefficients with a single
+// call to `apply_matrices`, and the quadratic forms with the (cached) indicator
+// matrix are evaluated with a single matrix-matrix multiplication, so this is
+// considerably faster than calling `oscillation_indicator` for each set.
+template <size_t VolumeDim>
+void oscillation_indicators(gsl::not_null<DataVector*> indicators,
+                            DerivativeWeight derivative_weight,
+                            const DataVector& data,
+                            const Mesh<VolumeDim>& mesh);
+
 }  // namespace Limiters::Weno_detail
@@ -385,6 +385,8 @@ struct EvolutionMetavars<tmpl::list<InterpolationTargetTags...>,
 
     static constexpr bool subcell_enabled = use_dg_subcell;
     static constexpr bool subcell_enabled_at_external_boundary = true;
+    // See grmhd::ValenciaDivClean::subcell::TimeDerivative
+    static constexpr bool fused_dimension_sweeps = false;
 
     // We send `ghost_zone_size` cell-centered grid points for variable
     // reconstruction, of which we need `ghost_zone_size-1` for reconstruction
@@ -15,8 +15,11 @@ imex::Mode Options::create_from_yaml<imex::Mode>::create<void>(
     return imex::Mode::Implicit;
   } else if (mode == "SemiImplicit") {
     return imex::Mode::SemiImplicit;
+  } else if (mode == "BatchedImplicit") {
+    return imex::Mode::BatchedImplicit;
   } else {
     PARSE_ERROR(options.context(),
-                "Invalid IMEX mode.  Must be Implicit or SemiImplicit.");
+                "Invalid IMEX mode.  Must be Implicit, SemiImplicit, or "
+                "BatchedImplicit.");
   }
 }
@@ -12,6 +12,10 @@ enum class Mode {
   Implicit,
   /// Solve a linearized version of the implicit equation.
   SemiImplicit,
+  /// Solve the implicit equation with a damped Newton iteration
+  /// performed on all points at once, falling back to the pointwise
+  /// nonlinear solver of `Implicit` for points that fail.
+  BatchedImplicit,
 };
 }  // namespace imex
 
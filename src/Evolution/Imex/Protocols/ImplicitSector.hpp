@@ -87,6 +87,14 @@ namespace imex::protocols {
 /// All `Variables` in the DataBox, including the sources and source
 /// jacobian, will be initialized to zero with a single grid point.
 ///
+/// When using `imex::Mode::BatchedImplicit`, the DataBox instead
+/// holds all the points of the element at once: the `Variables` are
+/// initialized with the number of grid points of the element and the
+/// `tags_from_evolution` are not reduced to a single point.  The
+/// mutators for sectors used with that mode must therefore work for
+/// any number of grid points.  Points where the batched solve fails
+/// are retried with the pointwise DataBox described above.
+///
 /// \snippet DoImplicitStepSector.hpp simple_sector
 ///
 /// Examples of definitions of a complicated implicit source and
@@ -6,9 +6,11 @@
 #include "Evolution/Imex/SolveImplicitSector.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -122,6 +124,125 @@ class ImplicitEquation {
   std::vector<GuessResult> initial_guess_types_{};
 };
 
+// All the mutators a SolveAttempt may apply to a solve DataBox.
+template <typename SolveAttempt>
+using solve_attempt_mutators = tmpl::remove_duplicates<
+    tmpl::append<tmpl::list<typename SolveAttempt::source,
+                            typename SolveAttempt::jacobian>,
+                 typename SolveAttempt::source_prep,
+                 typename SolveAttempt::jacobian_prep>>;
+
+// Tracks the sector variables in a solve DataBox and which mutators
+// have been applied to them, so that calculations can be shared
+// between the source and jacobian evaluations.
+template <typename SectorVariablesTag, typename Mutators>
+class MutatorTracker {
+  using SectorVariables = typename SectorVariablesTag::type;
+
+  template <typename Mutator>
+  struct RanMutator {
+    using type = bool;
+  };
+
+ public:
+  // Forgets which mutators have been applied, e.g., because the
+  // arguments from the evolution DataBox changed.
+  void clear_completed_mutators() {
+    completed_mutators_ = decltype(completed_mutators_){};
+  }
+
+  template <typename DbTagsList>
+  void set_sector_variables(
+      const gsl::not_null<db::DataBox<DbTagsList>*> solve_box,
+      const SectorVariables& sector_variables) {
+    if (sector_variables == most_recent_sector_variables_) {
+      return;
+    }
+    most_recent_sector_variables_ = sector_variables;
+    db::mutate<SectorVariablesTag>(
+        [&sector_variables](const gsl::not_null<SectorVariables*> vars) {
+          *vars = sector_variables;
+        },
+        solve_box);
+    clear_completed_mutators();
+  }
+
+  template <typename MutatorsToRun, typename DbTagsList>
+  void run_mutators(const gsl::not_null<db::DataBox<DbTagsList>*> solve_box) {
+    tmpl::for_each<MutatorsToRun>([this, &solve_box](auto mutator_v) {
+      using mutator = tmpl::type_from<decltype(mutator_v)>;
+      if (not get<RanMutator<mutator>>(completed_mutators_)) {
+        db::mutate_apply<mutator>(solve_box);
+        get<RanMutator<mutator>>(completed_mutators_) = true;
+      }
+    });
+  }
+
+ private:
+  SectorVariables most_recent_sector_variables_{};
+  tuples::tagged_tuple_from_typelist<
+      tmpl::transform<Mutators, tmpl::bind<RanMutator, tmpl::_1>>>
+      completed_mutators_{};
+};
+
+// Calls `f(i, j, component)` for each component of the jacobian of
+// the source, where `component` is the derivative of the source of
+// the i-th independent component of the sector variables with
+// respect to the j-th one, counted in the storage order of the
+// SectorVariables.
+//
+// Despite repeated references to them, the result of this is
+// independent of the values of the *_for_offsets variables.  They
+// are only used for calculating offsets into the sector variables.
+template <typename SectorVariables, typename JacobianVariables,
+          typename Function>
+void for_each_jacobian_component(const SectorVariables& variables_for_offsets,
+                                 const JacobianVariables& jacobian,
+                                 Function&& f) {
+  const size_t number_of_grid_points =
+      variables_for_offsets.number_of_grid_points();
+  const auto offset = [&variables_for_offsets,
+                       &number_of_grid_points](const DataVector& component) {
+    return static_cast<size_t>(component.data() -
+                               variables_for_offsets.data()) /
+           number_of_grid_points;
+  };
+  tmpl::for_each<typename SectorVariables::tags_list>(
+      [&](auto dependent_tag_v) {
+        using dependent_tag = tmpl::type_from<decltype(dependent_tag_v)>;
+        const auto& dependent_for_offsets =
+            get<dependent_tag>(variables_for_offsets);
+        for (size_t dependent_component = 0;
+             dependent_component < dependent_for_offsets.size();
+             ++dependent_component) {
+          const auto dependent_index =
+              dependent_for_offsets.get_tensor_index(dependent_component);
+          const size_t row = offset(dependent_for_offsets[dependent_component]);
+          tmpl::for_each<typename SectorVariables::tags_list>(
+              [&](auto independent_tag_v) {
+                using independent_tag =
+                    tmpl::type_from<decltype(independent_tag_v)>;
+                using jacobian_component_tag =
+                    imex::Tags::Jacobian<independent_tag,
+                                         ::Tags::Source<dependent_tag>>;
+                const auto& independent_for_offsets =
+                    get<independent_tag>(variables_for_offsets);
+                for (size_t independent_component = 0;
+                     independent_component < independent_for_offsets.size();
+                     ++independent_component) {
+                  const auto independent_index =
+                      independent_for_offsets.get_tensor_index(
+                          independent_component);
+                  f(row,
+                    offset(independent_for_offsets[independent_component]),
+                    get<jacobian_component_tag>(jacobian).get(
+                        concatenate(independent_index, dependent_index)));
+                }
+              });
+        }
+      });
+}
+
 // Calculates the residual and jacobian for the ImplicitEquation
 // pointwise, using the source from the SolveAttempt.  This involved
 // setting up a local DataBox for the tags specified in the
@@ -203,12 +324,6 @@ class ImplicitSolver {
     }
   };
 
-  using all_mutators = tmpl::remove_duplicates<
-      tmpl::append<tmpl::list<typename SolveAttempt::source,
-                              typename SolveAttempt::jacobian>,
-                   typename SolveAttempt::source_prep,
-                   typename SolveAttempt::jacobian_prep>>;
-
   using source_tag = db::add_tag_prefix<::Tags::Source, sector_variables_tag>;
   using jacobian_tag =
       ::Tags::Variables<jacobian_tags<typename ImplicitSector::tensors,
@@ -263,7 +378,7 @@ class ImplicitSolver {
     extract_point(make_not_null(&inhomogeneous_terms_),
                   implicit_equation_->inhomogeneous_terms(), index);
 
-    completed_mutators_ = decltype(completed_mutators_){};
+    mutator_tracker_.clear_completed_mutators();
   }
 
   std::array<double, solve_dimension> operator()(
@@ -296,50 +411,12 @@ class ImplicitSolver {
     // The storage order for the tensors does not match the required
     // order for the returned array, so we have to copy components
     // individually.
-    //
-    // Despite repeated references to then, the result of this is
-    // independent of the *_for_offsets variables.  They are only used
-    // for calculating offsets into the returned array.
-    const auto& variables_for_offsets =
-        db::get<sector_variables_tag>(solve_box_);
-    tmpl::for_each<typename SectorVariables::tags_list>(
-        [&](auto dependent_tag_v) {
-          using dependent_tag = tmpl::type_from<decltype(dependent_tag_v)>;
-          const auto& dependent_for_offsets =
-              get<dependent_tag>(variables_for_offsets);
-          for (size_t dependent_component = 0;
-               dependent_component < dependent_for_offsets.size();
-               ++dependent_component) {
-            const auto dependent_index =
-                dependent_for_offsets.get_tensor_index(dependent_component);
-            auto& result_row = jacobian_array[static_cast<size_t>(
-                dependent_for_offsets[dependent_component].data() -
-                variables_for_offsets.data())];
-            tmpl::for_each<typename SectorVariables::tags_list>(
-                [&](auto independent_tag_v) {
-                  using independent_tag =
-                      tmpl::type_from<decltype(independent_tag_v)>;
-                  using jacobian_component_tag =
-                      imex::Tags::Jacobian<independent_tag,
-                                           ::Tags::Source<dependent_tag>>;
-                  const auto& independent_for_offsets =
-                      get<independent_tag>(variables_for_offsets);
-
-                  for (size_t independent_component = 0;
-                       independent_component < independent_for_offsets.size();
-                       ++independent_component) {
-                    const auto independent_index =
-                        independent_for_offsets.get_tensor_index(
-                            independent_component);
-                    result_row[static_cast<size_t>(
-                        independent_for_offsets[independent_component].data() -
-                        variables_for_offsets.data())] =
-                        get<jacobian_component_tag>(solve_box_)
-                            .get(concatenate(independent_index,
-                                             dependent_index))[0];
-                  }
-                });
-          }
+    for_each_jacobian_component(
+        db::get<sector_variables_tag>(solve_box_),
+        db::get<jacobian_tag>(solve_box_),
+        [&jacobian_array](const size_t i, const size_t j,
+                          const DataVector& component) {
+          gsl::at(gsl::at(jacobian_array, i), j) = component[0];
         });
 
     jacobian_array *= implicit_equation_->implicit_weight();
@@ -359,34 +436,16 @@ class ImplicitSolver {
   }
 
   void set_sector_variables(const SectorVariables& sector_variables) const {
-    if (sector_variables == most_recent_sector_variables_) {
-      return;
-    }
-    most_recent_sector_variables_ = sector_variables;
-    db::mutate<sector_variables_tag>(
-        [&sector_variables](const gsl::not_null<SectorVariables*> vars) {
-          *vars = sector_variables;
-        },
-        make_not_null(&solve_box_));
-    completed_mutators_ = decltype(completed_mutators_){};
+    mutator_tracker_.set_sector_variables(make_not_null(&solve_box_),
+                                          sector_variables);
   }
 
   template <typename Mutators>
   void run_mutators() const {
-    tmpl::for_each<Mutators>([this](auto mutator_v) {
-      using mutator = tmpl::type_from<decltype(mutator_v)>;
-      if (not get<RanMutator<mutator>>(completed_mutators_)) {
-        db::mutate_apply<mutator>(make_not_null(&solve_box_));
-        get<RanMutator<mutator>>(completed_mutators_) = true;
-      }
-    });
+    mutator_tracker_.template run_mutators<Mutators>(
+        make_not_null(&solve_box_));
   }
 
-  template <typename Mutator>
-  struct RanMutator {
-    using type = bool;
-  };
-
   // Re mutables: This struct is only used locally in serial
   // single-threaded implicit solves.  The gsl_multiroot interface
   // takes a const solver object, but we want to be able to share
@@ -396,11 +455,356 @@ class ImplicitSolver {
   SectorVariables inhomogeneous_terms_{1};
   gsl::not_null<const ImplicitEquation<SectorVariables>*> implicit_equation_;
   // NOLINTNEXTLINE(spectre-mutable)
-  mutable SectorVariables most_recent_sector_variables_{};
-  // NOLINTNEXTLINE(spectre-mutable)
-  mutable tuples::tagged_tuple_from_typelist<
-      tmpl::transform<all_mutators, tmpl::bind<RanMutator, tmpl::_1>>>
-      completed_mutators_{};
+  mutable MutatorTracker<sector_variables_tag,
+                         solve_attempt_mutators<SolveAttempt>>
+      mutator_tracker_{};
+};
+
+// Solves the small dense system `matrix * x = rhs` by Gaussian
+// elimination with partial pivoting, overwriting rhs with x.  Returns
+// false if the matrix is singular.  Used instead of LAPACK in the
+// batched solve because the systems are tiny and there is one per
+// grid point.
+template <size_t Dim>
+bool dense_solve_in_place(
+    const gsl::not_null<std::array<std::array<double, Dim>, Dim>*> matrix,
+    const gsl::not_null<std::array<double, Dim>*> rhs) {
+  auto& m = *matrix;
+  auto& b = *rhs;
+  for (size_t column = 0; column < Dim; ++column) {
+    size_t pivot_row = column;
+    for (size_t row = column + 1; row < Dim; ++row) {
+      if (std::abs(gsl::at(gsl::at(m, row), column)) >
+          std::abs(gsl::at(gsl::at(m, pivot_row), column))) {
+        pivot_row = row;
+      }
+    }
+    if (gsl::at(gsl::at(m, pivot_row), column) == 0.0) {
+      return false;
+    }
+    if (pivot_row != column) {
+      std::swap(gsl::at(m, pivot_row), gsl::at(m, column));
+      std::swap(gsl::at(b, pivot_row), gsl::at(b, column));
+    }
+    const auto& pivot_row_values = gsl::at(m, column);
+    for (size_t row = column + 1; row < Dim; ++row) {
+      auto& row_values = gsl::at(m, row);
+      const double factor =
+          gsl::at(row_values, column) / gsl::at(pivot_row_values, column);
+      for (size_t j = column + 1; j < Dim; ++j) {
+        gsl::at(row_values, j) -= factor * gsl::at(pivot_row_values, j);
+      }
+      gsl::at(b, row) -= factor * gsl::at(b, column);
+    }
+  }
+  for (size_t row = Dim; row-- > 0;) {
+    const auto& row_values = gsl::at(m, row);
+    double value = gsl::at(b, row);
+    for (size_t j = row + 1; j < Dim; ++j) {
+      value -= gsl::at(row_values, j) * gsl::at(b, j);
+    }
+    gsl::at(b, row) = value / gsl::at(row_values, row);
+  }
+  return true;
+}
+
+// Solves the ImplicitEquation on all requested points of an element
+// simultaneously using a damped Newton iteration.  The source and
+// jacobian mutators are called once per iteration on the full set of
+// points instead of once per point per iteration, and only the small
+// per-point linear solves are performed pointwise.  Converged points
+// are masked out of the iteration (but, as the mutators act on all
+// points, they are still evaluated for them).
+//
+// Points that do not converge are reported back to the caller, which
+// is expected to retry them with the pointwise ImplicitSolver.
+template <typename ImplicitSector, typename SolveAttempt>
+class BatchedImplicitSolver {
+  static_assert(
+      tt::assert_conforms_to_v<ImplicitSector, protocols::ImplicitSector>);
+
+  using sector_variables_tag =
+      ::Tags::Variables<typename ImplicitSector::tensors>;
+  using SectorVariables = typename sector_variables_tag::type;
+  static constexpr size_t solve_dimension =
+      SectorVariables::number_of_independent_components;
+
+  using tags_from_evolution = typename SolveAttempt::tags_from_evolution;
+  using EvolutionData = ForwardTuple<tags_from_evolution>;
+
+  struct EvolutionDataTag : db::SimpleTag {
+    using type = const EvolutionData*;
+  };
+
+  // All points are solved together, so the quantities from the
+  // evolution DataBox can be used directly without slicing.
+  template <typename Tag>
+  struct FromEvolution : Tag, db::ReferenceTag {
+    using base = Tag;
+    using parent_tag = EvolutionDataTag;
+    using argument_tags = tmpl::list<parent_tag>;
+    static const typename base::type& get(
+        const EvolutionData* const evolution_data) {
+      return std::get<tmpl::index_of<tags_from_evolution, Tag>::value>(
+          *evolution_data);
+    }
+  };
+
+  using source_tag = db::add_tag_prefix<::Tags::Source, sector_variables_tag>;
+  using jacobian_tag =
+      ::Tags::Variables<jacobian_tags<typename ImplicitSector::tensors,
+                                      typename source_tag::type::tags_list>>;
+
+  using internal_simple_tags = tmpl::list<EvolutionDataTag,
+                                          sector_variables_tag, source_tag,
+                                          jacobian_tag>;
+  using wrapped_tags_from_evolution =
+      tmpl::transform<tags_from_evolution, tmpl::bind<FromEvolution, tmpl::_1>>;
+
+  using simple_tags =
+      tmpl::append<internal_simple_tags, typename SolveAttempt::simple_tags>;
+  using compute_tags = tmpl::append<wrapped_tags_from_evolution,
+                                    typename SolveAttempt::compute_tags>;
+
+  using SolveBox =
+      db::compute_databox_type<tmpl::append<simple_tags, compute_tags>>;
+
+  // The number of times a Newton step is halved before giving up on
+  // a point.
+  static constexpr size_t max_step_halvings = 10;
+
+  enum class PointStatus { Skipped, Pending, Converged, Failed };
+
+ public:
+  template <typename PassedEvolutionData>
+  BatchedImplicitSolver(
+      const ImplicitEquation<SectorVariables>& implicit_equation,
+      PassedEvolutionData&& data_from_evolution,
+      const size_t number_of_grid_points)
+      : solve_box_(db::create<simple_tags, compute_tags>()),
+        implicit_equation_(&implicit_equation),
+        number_of_grid_points_(number_of_grid_points) {
+    static_assert(std::is_same_v<PassedEvolutionData, const EvolutionData&>,
+                  "BatchedImplicitSolver was passed a temporary.  "
+                  "This will lead to a dangling pointer.");
+    db::mutate_apply<
+        tmpl::push_front<
+            tmpl::filter<
+                simple_tags,
+                tt::is_a<Variables, tmpl::bind<tmpl::type_from, tmpl::_1>>>,
+            EvolutionDataTag>,
+        tmpl::list<>>(
+        [&data_from_evolution, &number_of_grid_points](
+            const gsl::not_null<const EvolutionData**> evolution_data_pointer,
+            const auto... vars) {
+          *evolution_data_pointer = &data_from_evolution;
+          expand_pack((vars->initialize(number_of_grid_points, 0.0), 0)...);
+        },
+        make_not_null(&solve_box_));
+  }
+
+  // Solves the points flagged in `points_to_solve`, starting from the
+  // values in `system_variables`.  Converged points are written into
+  // `system_variables`.  Returns, for each point, whether the solve
+  // succeeded.
+  template <typename SystemVariables>
+  std::vector<bool> solve(
+      const gsl::not_null<SystemVariables*> system_variables,
+      const std::vector<bool>& points_to_solve, const double tolerance,
+      const size_t max_iterations) {
+    ASSERT(implicit_equation_->implicit_weight() != 0.0,
+           "Should not be performing solves on explicit substeps");
+    const size_t n = number_of_grid_points_;
+    ASSERT(points_to_solve.size() == n,
+           "Expected " << n << " points, but got " << points_to_solve.size());
+
+    std::vector<PointStatus> status(n, PointStatus::Skipped);
+    for (size_t point = 0; point < n; ++point) {
+      if (points_to_solve[point]) {
+        status[point] = PointStatus::Pending;
+      }
+    }
+
+    SectorVariables current =
+        system_variables
+            ->template extract_subset<typename SectorVariables::tags_list>();
+    SectorVariables residual(n);
+    SectorVariables trial(n);
+    SectorVariables step(n);
+    DataVector residual_norm(n);
+    DataVector trial_norm(n);
+    DataVector step_fraction(n);
+    std::vector<size_t> line_search_points{};
+    line_search_points.reserve(n);
+
+    evaluate_residual(make_not_null(&residual), make_not_null(&residual_norm),
+                      current);
+    for (size_t iteration = 0;; ++iteration) {
+      bool any_pending = false;
+      for (size_t point = 0; point < n; ++point) {
+        if (status[point] == PointStatus::Pending) {
+          if (residual_norm[point] < tolerance) {
+            status[point] = PointStatus::Converged;
+          } else {
+            any_pending = true;
+          }
+        }
+      }
+      if (not any_pending or iteration == max_iterations) {
+        break;
+      }
+
+      evaluate_jacobian(current);
+      const auto jacobian_components = jacobian_component_pointers();
+      const double implicit_weight = implicit_equation_->implicit_weight();
+
+      // Newton step: solve J dx = -f pointwise.
+      step.initialize(n, 0.0);
+      line_search_points.clear();
+      for (size_t point = 0; point < n; ++point) {
+        if (status[point] != PointStatus::Pending) {
+          continue;
+        }
+        std::array<std::array<double, solve_dimension>, solve_dimension>
+            point_jacobian{};
+        std::array<double, solve_dimension> point_step{};
+        for (size_t i = 0; i < solve_dimension; ++i) {
+          for (size_t j = 0; j < solve_dimension; ++j) {
+            gsl::at(gsl::at(point_jacobian, i), j) =
+                implicit_weight *
+                gsl::at(gsl::at(jacobian_components, i), j)[point];
+          }
+          gsl::at(gsl::at(point_jacobian, i), i) -= 1.0;
+          gsl::at(point_step, i) = -residual.data()[i * n + point];
+        }
+        if (not dense_solve_in_place(make_not_null(&point_jacobian),
+                                     make_not_null(&point_step))) {
+          status[point] = PointStatus::Failed;
+          continue;
+        }
+        for (size_t i = 0; i < solve_dimension; ++i) {
+          step.data()[i * n + point] = gsl::at(point_step, i);
+        }
+        line_search_points.push_back(point);
+      }
+
+      // Backtracking line search, accepting the first step that
+      // reduces the residual at each point.
+      step_fraction = 1.0;
+      for (size_t halving = 0;
+           halving <= max_step_halvings and not line_search_points.empty();
+           ++halving) {
+        for (size_t i = 0; i < solve_dimension; ++i) {
+          const DataVector current_component(current.data() + i * n, n);
+          const DataVector step_component(step.data() + i * n, n);
+          DataVector trial_component(trial.data() + i * n, n);
+          trial_component =
+              current_component + step_fraction * step_component;
+        }
+        evaluate_residual(make_not_null(&residual),
+                          make_not_null(&trial_norm), trial);
+        size_t remaining = 0;
+        for (const size_t point : line_search_points) {
+          if (trial_norm[point] < residual_norm[point]) {
+            for (size_t i = 0; i < solve_dimension; ++i) {
+              current.data()[i * n + point] = trial.data()[i * n + point];
+            }
+            residual_norm[point] = trial_norm[point];
+            // Keep the point fixed for the rest of the line search.
+            for (size_t i = 0; i < solve_dimension; ++i) {
+              step.data()[i * n + point] = 0.0;
+            }
+          } else {
+            step_fraction[point] *= 0.5;
+            line_search_points[remaining++] = point;
+          }
+        }
+        line_search_points.resize(remaining);
+      }
+      for (const size_t point : line_search_points) {
+        status[point] = PointStatus::Failed;
+      }
+
+      // The stored residual corresponds to the last trial values,
+      // which differ from the current values at rejected points.
+      evaluate_residual(make_not_null(&residual),
+                        make_not_null(&residual_norm), current);
+    }
+
+    std::vector<bool> converged(n, false);
+    auto sector_reference = system_variables->template reference_subset<
+        typename SectorVariables::tags_list>();
+    for (size_t point = 0; point < n; ++point) {
+      if (status[point] == PointStatus::Converged) {
+        converged[point] = true;
+        for (size_t i = 0; i < solve_dimension; ++i) {
+          sector_reference.data()[i * n + point] =
+              current.data()[i * n + point];
+        }
+      }
+    }
+    return converged;
+  }
+
+ private:
+  // Residual of the implicit equation, X - u + w S, and its pointwise
+  // L1 norm, matching the GSL residual stopping condition used by the
+  // pointwise solver.
+  void evaluate_residual(const gsl::not_null<SectorVariables*> residual,
+                         const gsl::not_null<DataVector*> residual_norm,
+                         const SectorVariables& sector_variables) {
+    set_sector_variables(sector_variables);
+    run_mutators<tmpl::push_back<typename SolveAttempt::source_prep,
+                                 typename SolveAttempt::source>>();
+    *residual = implicit_equation_->inhomogeneous_terms() - sector_variables +
+                implicit_equation_->implicit_weight() *
+                    db::get<source_tag>(solve_box_);
+    const size_t n = number_of_grid_points_;
+    *residual_norm = 0.0;
+    for (size_t i = 0; i < solve_dimension; ++i) {
+      *residual_norm += abs(DataVector(residual->data() + i * n, n));
+    }
+  }
+
+  void evaluate_jacobian(const SectorVariables& sector_variables) {
+    set_sector_variables(sector_variables);
+    run_mutators<tmpl::push_back<typename SolveAttempt::jacobian_prep,
+                                 typename SolveAttempt::jacobian>>();
+  }
+
+  // Pointers to the data of the jacobian components, indexed as
+  // result[i][j] = dS_i/du_j with i and j the storage order in
+  // SectorVariables, as in ImplicitSolver::jacobian.
+  std::array<std::array<const double*, solve_dimension>, solve_dimension>
+  jacobian_component_pointers() const {
+    std::array<std::array<const double*, solve_dimension>, solve_dimension>
+        result{};
+    for_each_jacobian_component(
+        db::get<sector_variables_tag>(solve_box_),
+        db::get<jacobian_tag>(solve_box_),
+        [&result](const size_t i, const size_t j,
+                  const DataVector& component) {
+          gsl::at(gsl::at(result, i), j) = component.data();
+        });
+    return result;
+  }
+
+  void set_sector_variables(const SectorVariables& sector_variables) {
+    mutator_tracker_.set_sector_variables(make_not_null(&solve_box_),
+                                          sector_variables);
+  }
+
+  template <typename Mutators>
+  void run_mutators() {
+    mutator_tracker_.template run_mutators<Mutators>(
+        make_not_null(&solve_box_));
+  }
+
+  SolveBox solve_box_;
+  gsl::not_null<const ImplicitEquation<SectorVariables>*> implicit_equation_;
+  size_t number_of_grid_points_;
+  MutatorTracker<sector_variables_tag, solve_attempt_mutators<SolveAttempt>>
+      mutator_tracker_{};
 };
 }  // namespace solve_implicit_sector_detail
 
@@ -451,6 +855,30 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
         std::get<attempt_number + 1>(evolution_data);
     solve_implicit_sector_detail::ImplicitSolver<ImplicitSector, solve_attempt>
         solver(equation, attempt_evolution_data);
+    const size_t max_iterations = 100;
+
+    // Points that have already been solved by the batched solver.
+    // Empty unless using Mode::BatchedImplicit.
+    std::vector<bool> solved_by_batch{};
+    if (implicit_solve_mode == Mode::BatchedImplicit) {
+      std::vector<bool> points_to_solve(number_of_grid_points, false);
+      bool have_points_to_solve = false;
+      for (size_t point = 0; point < number_of_grid_points; ++point) {
+        points_to_solve[point] =
+            get(*solve_failures)[point] >= attempt_number and
+            equation.initial_guess_result(point) != GuessResult::ExactSolution;
+        have_points_to_solve = have_points_to_solve or points_to_solve[point];
+      }
+      if (have_points_to_solve) {
+        solve_implicit_sector_detail::BatchedImplicitSolver<ImplicitSector,
+                                                            solve_attempt>
+            batched_solver(equation, attempt_evolution_data,
+                           number_of_grid_points);
+        solved_by_batch =
+            batched_solver.solve(system_variables, points_to_solve,
+                                 implicit_solve_tolerance, max_iterations);
+      }
+    }
 
     for (size_t point = 0; point < number_of_grid_points; ++point) {
       if (get(*solve_failures)[point] < attempt_number) {
@@ -461,6 +889,9 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
         // when it was computed.
         continue;
       }
+      if (not solved_by_batch.empty() and solved_by_batch[point]) {
+        continue;
+      }
 
       // Dimension of the vector space the (non)linear solve is performed in.
       constexpr size_t solve_dimension =
@@ -478,8 +909,9 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
                       point);
       }
       switch (implicit_solve_mode) {
+        // Points the batched solve failed on are retried pointwise.
+        case Mode::BatchedImplicit:
         case Mode::Implicit: {
-          const size_t max_iterations = 100;
           try {
             pointwise_vars_array = RootFinder::gsl_multiroot(
                 solver, initial_guess,
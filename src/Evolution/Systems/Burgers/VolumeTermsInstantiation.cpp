@@ -24,22 +24,15 @@ template void volume_terms<::Burgers::TimeDerivativeTerms>(
         Variables<typename ::Burgers::System::
                       compute_volume_time_derivative_terms::temporary_tags>*>
         temporaries,
-    const gsl::not_null<Variables<db::wrap_tags_in<
-        ::Tags::div,
-        db::wrap_tags_in<::Tags::Flux,
-                         typename ::Burgers::System::flux_variables,
-                         tmpl::size_t<1>, Frame::Inertial>>>*>
-        div_fluxes,
     const Variables<typename ::Burgers::System::variables_tag::tags_list>&
         evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<1>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, 1, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<1>& mesh,
     const InverseJacobian<DataVector, 1, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 1, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
     const Scalar<DataVector>& u);
+
+INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(::Burgers::System, 1)
 }  // namespace evolution::dg::Actions::detail
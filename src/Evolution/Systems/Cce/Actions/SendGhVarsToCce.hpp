@@ -5,20 +5,35 @@
 
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
 #include "ParallelAlgorithms/Interpolation/Events/InterpolateWithoutInterpComponent.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationStencil.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
+namespace intrp {
+template <typename Metavariables, typename Tag>
+struct InterpolationTarget;
+}  // namespace intrp
 namespace tuples {
 template <typename... Tags>
 class TaggedTuple;
@@ -35,8 +50,40 @@ namespace Actions {
 /// is an unfortunate hack needed by the contradictory constraints
 /// of a locally-stepped CCE system and the events and dense triggers
 /// during the self start procedure.
+///
+/// The worldtube points are fixed in the frame of the target, so if the
+/// elements don't move in that frame (see
+/// `intrp::interpolation_stencil_is_reusable`) the points are located in the
+/// element and the interpolation weights are computed only once, and are
+/// reused at every step as a single matrix multiplication (see
+/// `intrp::InterpolationStencil`). The data at all worldtube radii in the
+/// element is sent in one message. Otherwise the points are located anew at
+/// every step by `intrp::Events::InterpolateWithoutInterpComponent`.
+///
+/// DataBox changes:
+/// - Adds:
+///   - `intrp::Tags::InterpolationStencil<CceWorltubeTargetTag, 3>`
+/// - Removes: nothing
+/// - Modifies:
+///   - `intrp::Tags::InterpolationStencil<CceWorltubeTargetTag, 3>`
 template <typename CceWorltubeTargetTag>
 struct SendGhVarsToCce {
+ private:
+  static constexpr size_t volume_dim = 3;
+  using stencil_tag =
+      intrp::Tags::InterpolationStencil<CceWorltubeTargetTag, volume_dim>;
+  using vars_to_interpolate =
+      typename CceWorltubeTargetTag::vars_to_interpolate_to_target;
+  using frame = typename CceWorltubeTargetTag::compute_target_points::frame;
+  static constexpr bool can_use_stencil =
+      not intrp::InterpolationTarget_detail::points_are_time_dependent_v<
+          CceWorltubeTargetTag> and
+      not intrp::InterpolationTarget_detail::
+          has_compute_vars_to_interpolate_v<CceWorltubeTargetTag>;
+
+ public:
+  using simple_tags = tmpl::list<stencil_tag>;
+
   template <typename DbTags, typename Metavariables, typename... InboxTags,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -46,18 +93,74 @@ struct SendGhVarsToCce {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const component) {
+    static_assert(Metavariables::volume_dim == volume_dim);
+    SPECTRE_TRACE_SCOPE("Cce::Actions::SendGhVarsToCce");
+    if constexpr (can_use_stencil) {
+      if (intrp::interpolation_stencil_is_reusable<CceWorltubeTargetTag>(
+              Parallel::get<domain::Tags::Domain<volume_dim>>(cache))) {
+        send_with_stencil(make_not_null(&box), cache, array_index);
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+    }
     // not used by interpolation
     const Event::ObservationValue observation_value{};
     auto interpolate_event = intrp::Events::InterpolateWithoutInterpComponent<
-        Metavariables::volume_dim, CceWorltubeTargetTag,
-        typename CceWorltubeTargetTag::vars_to_interpolate_to_target>{};
+        volume_dim, CceWorltubeTargetTag, vars_to_interpolate>{};
     ::apply(interpolate_event,
             make_observation_box<db::AddComputeTags<
-                Events::Tags::ObserverMeshCompute<Metavariables::volume_dim>>>(
+                Events::Tags::ObserverMeshCompute<volume_dim>>>(
                 make_not_null(&box)),
             cache, array_index, component, observation_value);
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
+
+ private:
+  template <typename DbTags, typename Metavariables>
+  static void send_with_stencil(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<volume_dim>& array_index) {
+    const auto& temporal_id =
+        db::get<typename CceWorltubeTargetTag::temporal_id>(*box);
+    const auto& mesh = db::get<domain::Tags::Mesh<volume_dim>>(*box);
+    const auto& cached_stencil = db::get<stencil_tag>(*box);
+    if (not cached_stencil.has_value() or cached_stencil->mesh != mesh) {
+      const auto& all_target_points =
+          get<intrp::Vars::PointInfoTag<CceWorltubeTargetTag, volume_dim>>(
+              db::get<intrp::Tags::InterpPointInfoBase>(*box));
+      db::mutate<stencil_tag>(
+          [&cache, &mesh, &all_target_points, &array_index, &temporal_id](
+              const gsl::not_null<typename stencil_tag::type*> stencil,
+              const tnsr::I<DataVector, volume_dim, frame>& coordinates) {
+            *stencil = intrp::make_interpolation_stencil<CceWorltubeTargetTag>(
+                cache, mesh, all_target_points, coordinates, array_index,
+                temporal_id);
+          },
+          box, db::get<domain::Tags::Coordinates<volume_dim, frame>>(*box));
+    }
+    const intrp::InterpolationStencil<volume_dim>& stencil =
+        *db::get<stencil_tag>(*box);
+    if (not stencil.has_target_points()) {
+      return;
+    }
+
+    Variables<vars_to_interpolate> interp_vars(mesh.number_of_grid_points());
+    tmpl::for_each<vars_to_interpolate>([&box, &interp_vars](auto tag_v) {
+      using var_tag = tmpl::type_from<decltype(tag_v)>;
+      get<var_tag>(interp_vars) = db::get<var_tag>(*box);
+    });
+
+    auto& receiver_proxy = Parallel::get_parallel_component<
+        intrp::InterpolationTarget<Metavariables, CceWorltubeTargetTag>>(
+        cache);
+    Parallel::simple_action<intrp::Actions::InterpolationTargetVarsFromElement<
+        CceWorltubeTargetTag>>(
+        receiver_proxy,
+        std::vector<Variables<vars_to_interpolate>>(
+            {stencil.interpolant.interpolate(interp_vars)}),
+        stencil.block_logical_coords,
+        std::vector<std::vector<size_t>>({stencil.offsets}), temporal_id);
+  }
 };
 }  // namespace Actions
 }  // namespace Cce
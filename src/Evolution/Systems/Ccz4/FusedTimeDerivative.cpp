@@ -0,0 +1,306 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Ccz4/FusedTimeDerivative.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Ccz4 {
+namespace {
+// The temporaries of `Ccz4::TimeDerivative::apply`, in the order of its
+// arguments
+template <size_t Dim>
+using temporary_tags = tmpl::list<
+    // quantities we need for computing eq 12 - 27
+    ::Tags::TempTensor<0, Scalar<DataVector>>,
+    ::Tags::TempTensor<1, Scalar<DataVector>>,
+    ::Tags::TempTensor<2, tnsr::II<DataVector, Dim>>,
+    ::Tags::TempTensor<3, tnsr::II<DataVector, Dim>>,
+    ::Tags::TempTensor<4, Scalar<DataVector>>,
+    ::Tags::TempTensor<5, Scalar<DataVector>>,
+    ::Tags::TempTensor<6, Scalar<DataVector>>,
+    ::Tags::TempTensor<7, tnsr::II<DataVector, Dim>>,
+    // temporary expressions
+    ::Tags::TempTensor<8, tnsr::ij<DataVector, Dim>>,
+    ::Tags::TempTensor<9, tnsr::ii<DataVector, Dim>>,
+    ::Tags::TempTensor<10, Scalar<DataVector>>,
+    ::Tags::TempTensor<11, tnsr::ijK<DataVector, Dim>>,
+    ::Tags::TempTensor<12, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<13, tnsr::ijk<DataVector, Dim>>,
+    ::Tags::TempTensor<14, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<15, tnsr::I<DataVector, Dim>>,
+    ::Tags::TempTensor<16, Scalar<DataVector>>,
+    ::Tags::TempTensor<17, tnsr::ij<DataVector, Dim>>,
+    ::Tags::TempTensor<18, tnsr::ijk<DataVector, Dim>>,
+    ::Tags::TempTensor<19, tnsr::ii<DataVector, Dim>>,
+    ::Tags::TempTensor<20, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<21, tnsr::I<DataVector, Dim>>,
+    ::Tags::TempTensor<22, tnsr::iJ<DataVector, Dim>>,
+    ::Tags::TempTensor<23, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<24, tnsr::ij<DataVector, Dim>>,
+    ::Tags::TempTensor<25, Scalar<DataVector>>,
+    ::Tags::TempTensor<26, Scalar<DataVector>>,
+    ::Tags::TempTensor<27, tnsr::ii<DataVector, Dim>>,
+    ::Tags::TempTensor<28, tnsr::ijj<DataVector, Dim>>,
+    ::Tags::TempTensor<29, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<30, tnsr::ii<DataVector, Dim>>,
+    ::Tags::TempTensor<31, Scalar<DataVector>>,
+    ::Tags::TempTensor<32, Scalar<DataVector>>,
+    ::Tags::TempTensor<33, tnsr::I<DataVector, Dim>>,
+    ::Tags::TempTensor<34, tnsr::ii<DataVector, Dim>>,
+    // expressions and identities needed for evolution equations: eq 13 - 27
+    ::Tags::TempTensor<35, Scalar<DataVector>>,
+    ::Tags::TempTensor<36, tnsr::iJJ<DataVector, Dim>>,
+    ::Tags::TempTensor<37, tnsr::Ijj<DataVector, Dim>>,
+    ::Tags::TempTensor<38, tnsr::iJkk<DataVector, Dim>>,
+    ::Tags::TempTensor<39, tnsr::Ijj<DataVector, Dim>>,
+    ::Tags::TempTensor<40, tnsr::ii<DataVector, Dim>>,
+    ::Tags::TempTensor<41, tnsr::ij<DataVector, Dim>>,
+    ::Tags::TempTensor<42, Scalar<DataVector>>,
+    ::Tags::TempTensor<43, tnsr::I<DataVector, Dim>>,
+    ::Tags::TempTensor<44, tnsr::iJ<DataVector, Dim>>,
+    ::Tags::TempTensor<45, tnsr::i<DataVector, Dim>>,
+    ::Tags::TempTensor<46, tnsr::I<DataVector, Dim>>,
+    ::Tags::TempTensor<47, tnsr::ij<DataVector, Dim>>,
+    ::Tags::TempTensor<48, Scalar<DataVector>>>;
+
+template <size_t N, size_t Dim>
+auto get_temp(const gsl::not_null<Variables<temporary_tags<Dim>>*> temps) {
+  return make_not_null(&get<tmpl::at_c<temporary_tags<Dim>, N>>(*temps));
+}
+
+// Point the components of `view` at `number_of_points` grid points of
+// `tensor`, starting at grid point `offset`
+template <typename TensorType>
+void make_block_view(const gsl::not_null<TensorType*> view,
+                     const gsl::not_null<TensorType*> tensor,
+                     const size_t offset, const size_t number_of_points) {
+  for (size_t i = 0; i < tensor->size(); ++i) {
+    (*view)[i].set_data_ref((*tensor)[i].data() + offset, number_of_points);
+  }
+}
+
+template <typename TensorType>
+void make_const_block_view(const gsl::not_null<const TensorType*> view,
+                           const TensorType& tensor, const size_t offset,
+                           const size_t number_of_points) {
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    make_const_view(make_not_null(&(*view)[i]), tensor[i], offset,
+                    number_of_points);
+  }
+}
+}  // namespace
+
+template <size_t Dim>
+size_t FusedTimeDerivative<Dim>::number_of_temporary_components() {
+  return Variables<temporary_tags<Dim>>::number_of_independent_components;
+}
+
+template <size_t Dim>
+void FusedTimeDerivative<Dim>::apply(
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*>
+        dt_conformal_spatial_metric,
+    const gsl::not_null<Scalar<DataVector>*> dt_ln_lapse,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_shift,
+    const gsl::not_null<Scalar<DataVector>*> dt_ln_conformal_factor,
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_a_tilde,
+    const gsl::not_null<Scalar<DataVector>*> dt_trace_extrinsic_curvature,
+    const gsl::not_null<Scalar<DataVector>*> dt_theta,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_gamma_hat,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_b,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_a,
+    const gsl::not_null<tnsr::iJ<DataVector, Dim>*> dt_field_b,
+    const gsl::not_null<tnsr::ijj<DataVector, Dim>*> dt_field_d,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_p, const double c,
+    const double cleaning_speed, const Scalar<DataVector>& eta, const double f,
+    const Scalar<DataVector>& k_0, const tnsr::i<DataVector, Dim>& d_k_0,
+    const double kappa_1, const double kappa_2, const double kappa_3,
+    const double mu, const double one_over_relaxation_time,
+    const EvolveShift evolve_shift,
+    const SlicingConditionType slicing_condition_type,
+    const tnsr::ii<DataVector, Dim>& conformal_spatial_metric,
+    const Scalar<DataVector>& ln_lapse, const tnsr::I<DataVector, Dim>& shift,
+    const Scalar<DataVector>& ln_conformal_factor,
+    const tnsr::ii<DataVector, Dim>& a_tilde,
+    const Scalar<DataVector>& trace_extrinsic_curvature,
+    const Scalar<DataVector>& theta, const tnsr::I<DataVector, Dim>& gamma_hat,
+    const tnsr::I<DataVector, Dim>& b, const tnsr::i<DataVector, Dim>& field_a,
+    const tnsr::iJ<DataVector, Dim>& field_b,
+    const tnsr::ijj<DataVector, Dim>& field_d,
+    const tnsr::i<DataVector, Dim>& field_p,
+    const tnsr::ijj<DataVector, Dim>& d_a_tilde,
+    const tnsr::i<DataVector, Dim>& d_trace_extrinsic_curvature,
+    const tnsr::i<DataVector, Dim>& d_theta,
+    const tnsr::iJ<DataVector, Dim>& d_gamma_hat,
+    const tnsr::iJ<DataVector, Dim>& d_b,
+    const tnsr::ij<DataVector, Dim>& d_field_a,
+    const tnsr::ijK<DataVector, Dim>& d_field_b,
+    const tnsr::ijkk<DataVector, Dim>& d_field_d,
+    const tnsr::ij<DataVector, Dim>& d_field_p, const size_t block_size) {
+  ASSERT(block_size > 0, "The block size must be positive.");
+  const size_t num_points = get(ln_lapse).size();
+  Variables<temporary_tags<Dim>> temps{std::min(block_size, num_points)};
+
+  // Views of the current block of the time derivatives
+  tnsr::ii<DataVector, Dim> dt_conformal_spatial_metric_block{};
+  Scalar<DataVector> dt_ln_lapse_block{};
+  tnsr::I<DataVector, Dim> dt_shift_block{};
+  Scalar<DataVector> dt_ln_conformal_factor_block{};
+  tnsr::ii<DataVector, Dim> dt_a_tilde_block{};
+  Scalar<DataVector> dt_trace_extrinsic_curvature_block{};
+  Scalar<DataVector> dt_theta_block{};
+  tnsr::I<DataVector, Dim> dt_gamma_hat_block{};
+  tnsr::I<DataVector, Dim> dt_b_block{};
+  tnsr::i<DataVector, Dim> dt_field_a_block{};
+  tnsr::iJ<DataVector, Dim> dt_field_b_block{};
+  tnsr::ijj<DataVector, Dim> dt_field_d_block{};
+  tnsr::i<DataVector, Dim> dt_field_p_block{};
+  // Views of the current block of the free parameters, evolved variables and
+  // their spatial derivatives
+  const Scalar<DataVector> eta_block{};
+  const Scalar<DataVector> k_0_block{};
+  const tnsr::i<DataVector, Dim> d_k_0_block{};
+  const tnsr::ii<DataVector, Dim> conformal_spatial_metric_block{};
+  const Scalar<DataVector> ln_lapse_block{};
+  const tnsr::I<DataVector, Dim> shift_block{};
+  const Scalar<DataVector> ln_conformal_factor_block{};
+  const tnsr::ii<DataVector, Dim> a_tilde_block{};
+  const Scalar<DataVector> trace_extrinsic_curvature_block{};
+  const Scalar<DataVector> theta_block{};
+  const tnsr::I<DataVector, Dim> gamma_hat_block{};
+  const tnsr::I<DataVector, Dim> b_block{};
+  const tnsr::i<DataVector, Dim> field_a_block{};
+  const tnsr::iJ<DataVector, Dim> field_b_block{};
+  const tnsr::ijj<DataVector, Dim> field_d_block{};
+  const tnsr::i<DataVector, Dim> field_p_block{};
+  const tnsr::ijj<DataVector, Dim> d_a_tilde_block{};
+  const tnsr::i<DataVector, Dim> d_trace_extrinsic_curvature_block{};
+  const tnsr::i<DataVector, Dim> d_theta_block{};
+  const tnsr::iJ<DataVector, Dim> d_gamma_hat_block{};
+  const tnsr::iJ<DataVector, Dim> d_b_block{};
+  const tnsr::ij<DataVector, Dim> d_field_a_block{};
+  const tnsr::ijK<DataVector, Dim> d_field_b_block{};
+  const tnsr::ijkk<DataVector, Dim> d_field_d_block{};
+  const tnsr::ij<DataVector, Dim> d_field_p_block{};
+
+  for (size_t offset = 0; offset < num_points; offset += block_size) {
+    const size_t points_in_block = std::min(block_size, num_points - offset);
+    if (temps.number_of_grid_points() != points_in_block) {
+      // Only happens for the last block
+      temps.initialize(points_in_block);
+    }
+    const auto view = [offset, points_in_block](const auto block,
+                                                const auto tensor) {
+      make_block_view(block, tensor, offset, points_in_block);
+    };
+    const auto const_view = [offset, points_in_block](const auto& block,
+                                                      const auto& tensor) {
+      make_const_block_view(make_not_null(&block), tensor, offset,
+                            points_in_block);
+    };
+    view(make_not_null(&dt_conformal_spatial_metric_block),
+         dt_conformal_spatial_metric);
+    view(make_not_null(&dt_ln_lapse_block), dt_ln_lapse);
+    view(make_not_null(&dt_shift_block), dt_shift);
+    view(make_not_null(&dt_ln_conformal_factor_block), dt_ln_conformal_factor);
+    view(make_not_null(&dt_a_tilde_block), dt_a_tilde);
+    view(make_not_null(&dt_trace_extrinsic_curvature_block),
+         dt_trace_extrinsic_curvature);
+    view(make_not_null(&dt_theta_block), dt_theta);
+    view(make_not_null(&dt_gamma_hat_block), dt_gamma_hat);
+    view(make_not_null(&dt_b_block), dt_b);
+    view(make_not_null(&dt_field_a_block), dt_field_a);
+    view(make_not_null(&dt_field_b_block), dt_field_b);
+    view(make_not_null(&dt_field_d_block), dt_field_d);
+    view(make_not_null(&dt_field_p_block), dt_field_p);
+    const_view(eta_block, eta);
+    const_view(k_0_block, k_0);
+    const_view(d_k_0_block, d_k_0);
+    const_view(conformal_spatial_metric_block, conformal_spatial_metric);
+    const_view(ln_lapse_block, ln_lapse);
+    const_view(shift_block, shift);
+    const_view(ln_conformal_factor_block, ln_conformal_factor);
+    const_view(a_tilde_block, a_tilde);
+    const_view(trace_extrinsic_curvature_block, trace_extrinsic_curvature);
+    const_view(theta_block, theta);
+    const_view(gamma_hat_block, gamma_hat);
+    const_view(b_block, b);
+    const_view(field_a_block, field_a);
+    const_view(field_b_block, field_b);
+    const_view(field_d_block, field_d);
+    const_view(field_p_block, field_p);
+    const_view(d_a_tilde_block, d_a_tilde);
+    const_view(d_trace_extrinsic_curvature_block, d_trace_extrinsic_curvature);
+    const_view(d_theta_block, d_theta);
+    const_view(d_gamma_hat_block, d_gamma_hat);
+    const_view(d_b_block, d_b);
+    const_view(d_field_a_block, d_field_a);
+    const_view(d_field_b_block, d_field_b);
+    const_view(d_field_d_block, d_field_d);
+    const_view(d_field_p_block, d_field_p);
+
+    const auto temps_ptr = make_not_null(&temps);
+    TimeDerivative<Dim>::apply(
+        make_not_null(&dt_conformal_spatial_metric_block),
+        make_not_null(&dt_ln_lapse_block), make_not_null(&dt_shift_block),
+        make_not_null(&dt_ln_conformal_factor_block),
+        make_not_null(&dt_a_tilde_block),
+        make_not_null(&dt_trace_extrinsic_curvature_block),
+        make_not_null(&dt_theta_block), make_not_null(&dt_gamma_hat_block),
+        make_not_null(&dt_b_block), make_not_null(&dt_field_a_block),
+        make_not_null(&dt_field_b_block), make_not_null(&dt_field_d_block),
+        make_not_null(&dt_field_p_block), get_temp<0>(temps_ptr),
+        get_temp<1>(temps_ptr), get_temp<2>(temps_ptr), get_temp<3>(temps_ptr),
+        get_temp<4>(temps_ptr), get_temp<5>(temps_ptr), get_temp<6>(temps_ptr),
+        get_temp<7>(temps_ptr), get_temp<8>(temps_ptr), get_temp<9>(temps_ptr),
+        get_temp<10>(temps_ptr), get_temp<11>(temps_ptr),
+        get_temp<12>(temps_ptr), get_temp<13>(temps_ptr),
+        get_temp<14>(temps_ptr), get_temp<15>(temps_ptr),
+        get_temp<16>(temps_ptr), get_temp<17>(temps_ptr),
+        get_temp<18>(temps_ptr), get_temp<19>(temps_ptr),
+        get_temp<20>(temps_ptr), get_temp<21>(temps_ptr),
+        get_temp<22>(temps_ptr), get_temp<23>(temps_ptr),
+        get_temp<24>(temps_ptr), get_temp<25>(temps_ptr),
+        get_temp<26>(temps_ptr), get_temp<27>(temps_ptr),
+        get_temp<28>(temps_ptr), get_temp<29>(temps_ptr),
+        get_temp<30>(temps_ptr), get_temp<31>(temps_ptr),
+        get_temp<32>(temps_ptr), get_temp<33>(temps_ptr),
+        get_temp<34>(temps_ptr), get_temp<35>(temps_ptr),
+        get_temp<36>(temps_ptr), get_temp<37>(temps_ptr),
+        get_temp<38>(temps_ptr), get_temp<39>(temps_ptr),
+        get_temp<40>(temps_ptr), get_temp<41>(temps_ptr),
+        get_temp<42>(temps_ptr), get_temp<43>(temps_ptr),
+        get_temp<44>(temps_ptr), get_temp<45>(temps_ptr),
+        get_temp<46>(temps_ptr), get_temp<47>(temps_ptr),
+        get_temp<48>(temps_ptr), c, cleaning_speed, eta_block, f, k_0_block,
+        d_k_0_block, kappa_1, kappa_2, kappa_3, mu, one_over_relaxation_time,
+        evolve_shift, slicing_condition_type, conformal_spatial_metric_block,
+        ln_lapse_block, shift_block, ln_conformal_factor_block, a_tilde_block,
+        trace_extrinsic_curvature_block, theta_block, gamma_hat_block, b_block,
+        field_a_block, field_b_block, field_d_block, field_p_block,
+        d_a_tilde_block, d_trace_extrinsic_curvature_block, d_theta_block,
+        d_gamma_hat_block, d_b_block, d_field_a_block, d_field_b_block,
+        d_field_d_block, d_field_p_block);
+  }
+}
+}  // namespace Ccz4
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define INSTANTIATE(_, data) \
+  template struct Ccz4::FusedTimeDerivative<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
+
+/// \cond
+class DataVector;
+
+namespace gsl {
+template <class T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+namespace Ccz4 {
+/*!
+ * \brief Compute the RHS of the first order CCZ4 formulation of Einstein's
+ * equations \cite Dumbser2017okk one block of grid points at a time
+ *
+ * \details `Ccz4::TimeDerivative` computes the RHS in several dozen passes over
+ * all grid points, each of which reads and writes full-size temporaries (the
+ * Christoffel symbols and their derivatives, the Ricci tensor, the Z4
+ * constraint, etc.). For typical element sizes these temporaries don't fit in
+ * cache, so the RHS computation is limited by memory bandwidth.
+ *
+ * This function computes the same RHS, but splits the grid points into blocks
+ * of `block_size` points and evaluates all equations of
+ * `Ccz4::TimeDerivative` for one block before moving on to the next. The
+ * temporaries are only allocated for one block and are reused for every
+ * block, so they stay in cache and the only memory traffic is reading the
+ * evolved variables and their derivatives and writing the time derivatives.
+ * The results are identical to `Ccz4::TimeDerivative`, which is what this
+ * function evaluates for each block.
+ *
+ * The arguments are the time derivatives, free parameters, evolved variables
+ * and their spatial derivatives of `Ccz4::TimeDerivative`. If `block_size` is
+ * at least the number of grid points, this is a single call to
+ * `Ccz4::TimeDerivative::apply`.
+ */
+template <size_t Dim>
+struct FusedTimeDerivative {
+  /// Default number of grid points per block. The temporaries of a block then
+  /// take about 100 kB in 3D, which fits in the L2 cache of current CPUs.
+  static constexpr size_t default_block_size = 32;
+
+  /// Number of `double`s per grid point in the temporaries of
+  /// `Ccz4::TimeDerivative`. `apply` keeps `block_size` times this many
+  /// `double`s in memory, whereas `Ccz4::TimeDerivative` reads and writes this
+  /// many `double`s for every grid point.
+  static size_t number_of_temporary_components();
+
+  static void apply(
+      gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_conformal_spatial_metric,
+      gsl::not_null<Scalar<DataVector>*> dt_ln_lapse,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> dt_shift,
+      gsl::not_null<Scalar<DataVector>*> dt_ln_conformal_factor,
+      gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_a_tilde,
+      gsl::not_null<Scalar<DataVector>*> dt_trace_extrinsic_curvature,
+      gsl::not_null<Scalar<DataVector>*> dt_theta,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> dt_gamma_hat,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> dt_b,
+      gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_a,
+      gsl::not_null<tnsr::iJ<DataVector, Dim>*> dt_field_b,
+      gsl::not_null<tnsr::ijj<DataVector, Dim>*> dt_field_d,
+      gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_p, double c,
+      double cleaning_speed, const Scalar<DataVector>& eta, double f,
+      const Scalar<DataVector>& k_0, const tnsr::i<DataVector, Dim>& d_k_0,
+      double kappa_1, double kappa_2, double kappa_3, double mu,
+      double one_over_relaxation_time, EvolveShift evolve_shift,
+      SlicingConditionType slicing_condition_type,
+      const tnsr::ii<DataVector, Dim>& conformal_spatial_metric,
+      const Scalar<DataVector>& ln_lapse, const tnsr::I<DataVector, Dim>& shift,
+      const Scalar<DataVector>& ln_conformal_factor,
+      const tnsr::ii<DataVector, Dim>& a_tilde,
+      const Scalar<DataVector>& trace_extrinsic_curvature,
+      const Scalar<DataVector>& theta,
+      const tnsr::I<DataVector, Dim>& gamma_hat,
+      const tnsr::I<DataVector, Dim>& b,
+      const tnsr::i<DataVector, Dim>& field_a,
+      const tnsr::iJ<DataVector, Dim>& field_b,
+      const tnsr::ijj<DataVector, Dim>& field_d,
+      const tnsr::i<DataVector, Dim>& field_p,
+      const tnsr::ijj<DataVector, Dim>& d_a_tilde,
+      const tnsr::i<DataVector, Dim>& d_trace_extrinsic_curvature,
+      const tnsr::i<DataVector, Dim>& d_theta,
+      const tnsr::iJ<DataVector, Dim>& d_gamma_hat,
+      const tnsr::iJ<DataVector, Dim>& d_b,
+      const tnsr::ij<DataVector, Dim>& d_field_a,
+      const tnsr::ijK<DataVector, Dim>& d_field_b,
+      const tnsr::ijkk<DataVector, Dim>& d_field_d,
+      const tnsr::ij<DataVector, Dim>& d_field_p,
+      size_t block_size = default_block_size);
+};
+}  // namespace Ccz4
@@ -4,13 +4,17 @@
 #include "Evolution/Systems/CurvedScalarWave/TimeDerivative.hpp"
 
 #include <array>
+#include <tuple>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/Expressions/EvaluateFused.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/CurvedScalarWave/System.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -44,24 +48,65 @@ void TimeDerivative<Dim>::apply(
   *result_gamma1 = gamma1;
   *result_gamma2 = gamma2;
 
-  tenex::evaluate(dt_psi,
-                  -lapse() * pi() + shift(ti::I) * d_psi(ti::i) +
-                      gamma1() * shift(ti::J) * (d_psi(ti::j) - phi(ti::j)));
-
-  tenex::evaluate(
-      dt_pi,
-      lapse() * pi() * trace_extrinsic_curvature() +
-          shift(ti::I) * d_pi(ti::i) +
-          lapse() * trace_spatial_christoffel(ti::I) * phi(ti::i) +
-          gamma1() * gamma2() * shift(ti::I) * (d_psi(ti::i) - phi(ti::i)) -
-          lapse() * upper_spatial_metric(ti::I, ti::J) * d_phi(ti::i, ti::j) -
-          upper_spatial_metric(ti::I, ti::J) * phi(ti::i) * deriv_lapse(ti::j));
-
-  tenex::evaluate<ti::i>(
-      dt_phi, -lapse() * d_pi(ti::i) + shift(ti::J) * d_phi(ti::j, ti::i) +
-                  gamma2() * lapse() * (d_psi(ti::i) - phi(ti::i)) -
-                  pi() * deriv_lapse(ti::i) +
-                  phi(ti::j) * deriv_shift(ti::i, ti::J));
+  // The three equations read mostly the same inputs, so they are evaluated
+  // together on blocks of grid points that stay in cache. The one-index
+  // constraint d_i psi - Phi_i appears in all of them and is computed once
+  // per block.
+  using OneIndexConstraint = ::Tags::TempTensor<0, tnsr::i<DataVector, Dim>>;
+  tenex::evaluate_fused<tmpl::list<OneIndexConstraint>>(
+      [](const gsl::not_null<Variables<tmpl::list<OneIndexConstraint>>*>
+             temporaries,
+         const gsl::not_null<Scalar<DataVector>*> local_dt_psi,
+         const gsl::not_null<Scalar<DataVector>*> local_dt_pi,
+         const gsl::not_null<tnsr::i<DataVector, Dim>*> local_dt_phi,
+         const tnsr::i<DataVector, Dim>& local_d_psi,
+         const tnsr::i<DataVector, Dim>& local_d_pi,
+         const tnsr::ij<DataVector, Dim>& local_d_phi,
+         const Scalar<DataVector>& local_pi,
+         const tnsr::i<DataVector, Dim>& local_phi,
+         const Scalar<DataVector>& local_lapse,
+         const tnsr::I<DataVector, Dim>& local_shift,
+         const tnsr::i<DataVector, Dim>& local_deriv_lapse,
+         const tnsr::iJ<DataVector, Dim>& local_deriv_shift,
+         const tnsr::II<DataVector, Dim>& local_upper_spatial_metric,
+         const tnsr::I<DataVector, Dim>& local_trace_spatial_christoffel,
+         const Scalar<DataVector>& local_trace_extrinsic_curvature,
+         const Scalar<DataVector>& local_gamma1,
+         const Scalar<DataVector>& local_gamma2) {
+        auto& one_index_constraint = get<OneIndexConstraint>(*temporaries);
+        tenex::evaluate<ti::i>(make_not_null(&one_index_constraint),
+                               local_d_psi(ti::i) - local_phi(ti::i));
+
+        tenex::evaluate(local_dt_psi,
+                        -local_lapse() * local_pi() +
+                            local_shift(ti::I) * local_d_psi(ti::i) +
+                            local_gamma1() * local_shift(ti::J) *
+                                one_index_constraint(ti::j));
+
+        tenex::evaluate(
+            local_dt_pi,
+            local_lapse() * local_pi() * local_trace_extrinsic_curvature() +
+                local_shift(ti::I) * local_d_pi(ti::i) +
+                local_lapse() * local_trace_spatial_christoffel(ti::I) *
+                    local_phi(ti::i) +
+                local_gamma1() * local_gamma2() * local_shift(ti::I) *
+                    one_index_constraint(ti::i) -
+                local_lapse() * local_upper_spatial_metric(ti::I, ti::J) *
+                    local_d_phi(ti::i, ti::j) -
+                local_upper_spatial_metric(ti::I, ti::J) * local_phi(ti::i) *
+                    local_deriv_lapse(ti::j));
+
+        tenex::evaluate<ti::i>(
+            local_dt_phi,
+            -local_lapse() * local_d_pi(ti::i) +
+                local_shift(ti::J) * local_d_phi(ti::j, ti::i) +
+                local_gamma2() * local_lapse() * one_index_constraint(ti::i) -
+                local_pi() * local_deriv_lapse(ti::i) +
+                local_phi(ti::j) * local_deriv_shift(ti::i, ti::J));
+      },
+      std::make_tuple(dt_psi, dt_pi, dt_phi), d_psi, d_pi, d_phi, pi, phi,
+      lapse, shift, deriv_lapse, deriv_shift, upper_spatial_metric,
+      trace_spatial_christoffel, trace_extrinsic_curvature, gamma1, gamma2);
 }
 }  // namespace CurvedScalarWave
 // Generate explicit instantiations of partial_derivatives function as well as
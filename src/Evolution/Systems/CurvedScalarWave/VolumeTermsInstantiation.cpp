@@ -31,22 +31,12 @@
       const gsl::not_null<Variables<typename ::CurvedScalarWave::System<DIM(  \
           data)>::compute_volume_time_derivative_terms::temporary_tags>*>     \
           temporaries,                                                        \
-      const gsl::not_null<Variables<db::wrap_tags_in<                         \
-          ::Tags::div,                                                        \
-          db::wrap_tags_in<                                                   \
-              ::Tags::Flux,                                                   \
-              typename ::CurvedScalarWave::System<DIM(data)>::flux_variables, \
-              tmpl::size_t<DIM(data)>, Frame::Inertial>>>*>                   \
-          div_fluxes,                                                         \
       const Variables<typename ::CurvedScalarWave::System<DIM(                \
           data)>::variables_tag::tags_list>& evolved_vars,                    \
-      const ::dg::Formulation dg_formulation, const Mesh<DIM(data)>& mesh,    \
-      [[maybe_unused]] const tnsr::I<DataVector, DIM(data), Frame::Inertial>& \
-          inertial_coordinates,                                               \
+      const Mesh<DIM(data)>& mesh,                                            \
       const InverseJacobian<DataVector, DIM(data), Frame::ElementLogical,     \
                             Frame::Inertial>&                                 \
           logical_to_inertial_inverse_jacobian,                               \
-      [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,  \
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
@@ -63,7 +53,9 @@
       const Scalar<DataVector>& trace_extrinsic_curvature,                    \
       const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2);    \
   INSTANTIATE_PARTIAL_DERIVATIVES_WITH_SYSTEM(                                \
-      CurvedScalarWave::System<DIM(data)>, DIM(data), Frame::Inertial)
+      CurvedScalarWave::System<DIM(data)>, DIM(data), Frame::Inertial)        \
+  INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(                                \
+      ::CurvedScalarWave::System<DIM(data)>, DIM(data))
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -24,21 +24,12 @@ template void volume_terms<::ForceFree::TimeDerivativeTerms>(
         Variables<typename ::ForceFree::System::
                       compute_volume_time_derivative_terms::temporary_tags>*>
         temporaries,
-    [[maybe_unused]] const gsl::not_null<Variables<db::wrap_tags_in<
-        ::Tags::div,
-        db::wrap_tags_in<::Tags::Flux,
-                         typename ::ForceFree::System::flux_variables,
-                         tmpl::size_t<3>, Frame::Inertial>>>*>
-        div_fluxes,
     const Variables<typename ::ForceFree::System::variables_tag::tags_list>&
         evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<3>& mesh,
     const InverseJacobian<DataVector, 3, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
 
@@ -59,4 +50,6 @@ template void volume_terms<::ForceFree::TimeDerivativeTerms>(
     const tnsr::i<DataVector, 3, Frame::Inertial>& d_lapse,
     const tnsr::iJ<DataVector, 3, Frame::Inertial>& d_shift,
     const tnsr::ijj<DataVector, 3, Frame::Inertial>& d_spatial_metric);
+
+INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(::ForceFree::System, 3)
 }  // namespace evolution::dg::Actions::detail
@@ -52,11 +52,33 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace grmhd::ValenciaDivClean::subcell {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(fused_dimension_sweeps)
+}  // namespace detail
+
 /*!
  * \brief Compute the time derivative on the subcell grid using FD
  * reconstruction.
+ *
+ * By default the primitive variables are first reconstructed to the faces in
+ * all three logical directions, then the fluxes and boundary corrections are
+ * computed on all faces, and finally the flux differences are added to the
+ * time derivative.
+ *
+ * If `Metavariables::SubcellOptions::fused_dimension_sweeps` is `true`, the
+ * primitive variables are still reconstructed to all faces in a single call,
+ * so that the reconstructor prepares its volume and ghost data (e.g.
+ * \f$Wv^i\f$) only once. The fluxes, packaged data, boundary correction and
+ * flux difference are then computed one logical direction at a time, adding
+ * each direction's contribution to the time derivative before moving on to
+ * the next. A single boundary-correction buffer is reused for all three
+ * directions and the face data of a direction is read back while it is more
+ * likely to still be in cache. High-order flux corrections need the boundary
+ * corrections in all directions at once and are not applied with fused
+ * sweeps, but they are not yet supported for this system anyway.
  */
 struct TimeDerivative {
   template <typename DbTagsList>
@@ -141,10 +163,25 @@ struct TimeDerivative {
       }
     }
 
+    if (UNLIKELY(fd_derivative_order != ::fd::DerivativeOrder::Two)) {
+      ERROR(
+          "We don't yet have high-order flux corrections for curved/moving "
+          "meshes and the implementation assumes curved/moving meshes. We need "
+          "to dot the Cartesian fluxes into the cell-centered "
+          "J inv(J)^{hat{i}}_j to get JF^{hat{i}} = J inv(J)^{hat{i}}_j F^j."
+          " Some care needs to be taken since we also get F^j from our "
+          "neighbors, which leaves the question as to whether to interpolate "
+          "the _inertial fluxes_ and then transform or whether to transform "
+          "and then interpolate the _densitized logical fluxes_.");
+    }
+    using subcell_options = typename std::decay_t<decltype(db::get<
+        Parallel::Tags::Metavariables>(*box))>::SubcellOptions;
     const bool element_is_interior = element.external_boundaries().empty();
     constexpr bool subcell_enabled_at_external_boundary =
-        std::decay_t<decltype(db::get<Parallel::Tags::Metavariables>(
-            *box))>::SubcellOptions::subcell_enabled_at_external_boundary;
+        subcell_options::subcell_enabled_at_external_boundary;
+    constexpr bool fused_dimension_sweeps =
+        detail::get_fused_dimension_sweeps_or_default_v<subcell_options,
+                                                         false>;
 
     ASSERT(element_is_interior or subcell_enabled_at_external_boundary,
            "Subcell time derivative is called at a boundary element while "
@@ -167,6 +204,85 @@ struct TimeDerivative {
       }
     }
 
+    // Now compute the actual time derivatives.
+    using variables_tag = typename System::variables_tag;
+    using dt_variables_tag = db::add_tag_prefix<::Tags::dt, variables_tag>;
+    const gsl::not_null<typename dt_variables_tag::type*> dt_vars_ptr =
+        db::mutate<dt_variables_tag>(
+            [](const auto local_dt_vars_ptr) { return local_dt_vars_ptr; },
+            box);
+    dt_vars_ptr->initialize(subcell_mesh.number_of_grid_points());
+
+    using grmhd_source_tags =
+        tmpl::transform<ValenciaDivClean::ComputeSources::return_tags,
+                        tmpl::bind<db::remove_tag_prefix, tmpl::_1>>;
+    sources_impl(
+        dt_vars_ptr, *box, grmhd_source_tags{},
+        typename grmhd::ValenciaDivClean::ComputeSources::argument_tags{});
+
+    // Zero GRMHD tags that don't have sources.
+    tmpl::for_each<typename variables_tag::tags_list>(
+        [&dt_vars_ptr](auto evolved_var_tag_v) {
+          using evolved_var_tag = tmpl::type_from<decltype(evolved_var_tag_v)>;
+          using dt_tag = ::Tags::dt<evolved_var_tag>;
+          auto& dt_var = get<dt_tag>(*dt_vars_ptr);
+          for (size_t i = 0; i < dt_var.size(); ++i) {
+            if constexpr (not tmpl::list_contains_v<grmhd_source_tags,
+                                                    evolved_var_tag>) {
+              dt_var[i] = 0.0;
+            }
+          }
+        });
+
+    // Correction to source terms due to moving mesh
+    if (div_mesh_velocity.has_value()) {
+      const DataVector div_mesh_velocity_subcell =
+          evolution::dg::subcell::fd::project(div_mesh_velocity.value().get(),
+                                              dg_mesh, subcell_mesh.extents());
+      const auto& evolved_vars = db::get<evolved_vars_tag>(*box);
+
+      tmpl::for_each<typename variables_tag::tags_list>(
+          [&dt_vars_ptr, &div_mesh_velocity_subcell,
+           &evolved_vars](auto evolved_var_tag_v) {
+            using evolved_var_tag =
+                tmpl::type_from<decltype(evolved_var_tag_v)>;
+            using dt_tag = ::Tags::dt<evolved_var_tag>;
+            auto& dt_var = get<dt_tag>(*dt_vars_ptr);
+            const auto& evolved_var = get<evolved_var_tag>(evolved_vars);
+            for (size_t i = 0; i < dt_var.size(); ++i) {
+              dt_var[i] -= div_mesh_velocity_subcell * evolved_var[i];
+            }
+          });
+    }
+
+    const auto& cell_centered_det_inv_jacobian = db::get<
+        evolution::dg::subcell::fd::Tags::DetInverseJacobianLogicalToInertial>(
+        *box);
+    const auto add_flux_divergence =
+        [&dt_vars_ptr, &cell_centered_det_inv_jacobian, &one_over_delta_xi,
+         &subcell_mesh](const size_t dim,
+                        const Variables<evolved_vars_tags>&
+                            boundary_correction_in_axis) {
+          const double inverse_delta = gsl::at(one_over_delta_xi, dim);
+          tmpl::for_each<typename variables_tag::tags_list>(
+              [&dt_vars_ptr, &boundary_correction_in_axis,
+               &cell_centered_det_inv_jacobian, dim, inverse_delta,
+               &subcell_mesh](auto evolved_var_tag_v) {
+                using evolved_var_tag =
+                    tmpl::type_from<decltype(evolved_var_tag_v)>;
+                using dt_tag = ::Tags::dt<evolved_var_tag>;
+                auto& dt_var = get<dt_tag>(*dt_vars_ptr);
+                const auto& var_correction =
+                    get<evolved_var_tag>(boundary_correction_in_axis);
+                for (size_t i = 0; i < dt_var.size(); ++i) {
+                  evolution::dg::subcell::add_cartesian_flux_divergence(
+                      make_not_null(&dt_var[i]), inverse_delta,
+                      get(cell_centered_det_inv_jacobian), var_correction[i],
+                      subcell_mesh.extents(), dim);
+                }
+              });
+        };
+
     call_with_dynamic_type<void, derived_boundary_corrections>(
         &boundary_correction, [&](const auto* derived_correction) {
           using DerivedCorrection = std::decay_t<decltype(*derived_correction)>;
@@ -379,122 +495,58 @@ struct TimeDerivative {
             // Compute the corrections on the faces. We only need to
             // compute this once because we can just flip the normal
             // vectors then
-            gsl::at(boundary_corrections, i).initialize(reconstructed_num_pts);
+            //
+            // With fused sweeps the correction is added to the time
+            // derivative right away, so one buffer is reused for all
+            // directions.
+            auto& boundary_correction_in_axis =
+                [&boundary_corrections, i]() -> Variables<evolved_vars_tags>& {
+                  if constexpr (fused_dimension_sweeps) {
+                    (void)i;
+                    return gsl::at(boundary_corrections, 0);
+                  } else {
+                    return gsl::at(boundary_corrections, i);
+                  }
+                }();
+            boundary_correction_in_axis.initialize(reconstructed_num_pts);
             evolution::dg::subcell::compute_boundary_terms(
-                make_not_null(&gsl::at(boundary_corrections, i)),
+                make_not_null(&boundary_correction_in_axis),
                 *derived_correction, upper_packaged_data, lower_packaged_data,
                 db::as_access(*box),
                 typename DerivedCorrection::dg_boundary_terms_volume_tags{});
             // We need to multiply by the normal vector normalization
-            gsl::at(boundary_corrections, i) *= get(normalization);
+            boundary_correction_in_axis *= get(normalization);
             // Also multiply by determinant of Jacobian, following Eq.(34)
             // of 2109.11645
-            gsl::at(boundary_corrections, i) *= 1.0 / det_inv_jacobian_face;
-          }
-        });
-
-    // Now compute the actual time derivatives.
-    using variables_tag = typename System::variables_tag;
-    using dt_variables_tag = db::add_tag_prefix<::Tags::dt, variables_tag>;
-    const gsl::not_null<typename dt_variables_tag::type*> dt_vars_ptr =
-        db::mutate<dt_variables_tag>(
-            [](const auto local_dt_vars_ptr) { return local_dt_vars_ptr; },
-            box);
-    dt_vars_ptr->initialize(subcell_mesh.number_of_grid_points());
-
-    using grmhd_source_tags =
-        tmpl::transform<ValenciaDivClean::ComputeSources::return_tags,
-                        tmpl::bind<db::remove_tag_prefix, tmpl::_1>>;
-    sources_impl(
-        dt_vars_ptr, *box, grmhd_source_tags{},
-        typename grmhd::ValenciaDivClean::ComputeSources::argument_tags{});
-
-    // Zero GRMHD tags that don't have sources.
-    tmpl::for_each<typename variables_tag::tags_list>(
-        [&dt_vars_ptr](auto evolved_var_tag_v) {
-          using evolved_var_tag = tmpl::type_from<decltype(evolved_var_tag_v)>;
-          using dt_tag = ::Tags::dt<evolved_var_tag>;
-          auto& dt_var = get<dt_tag>(*dt_vars_ptr);
-          for (size_t i = 0; i < dt_var.size(); ++i) {
-            if constexpr (not tmpl::list_contains_v<grmhd_source_tags,
-                                                    evolved_var_tag>) {
-              dt_var[i] = 0.0;
+            boundary_correction_in_axis *= 1.0 / det_inv_jacobian_face;
+            if constexpr (fused_dimension_sweeps) {
+              add_flux_divergence(i, boundary_correction_in_axis);
             }
           }
         });
 
-    // Correction to source terms due to moving mesh
-    if (div_mesh_velocity.has_value()) {
-      const DataVector div_mesh_velocity_subcell =
-          evolution::dg::subcell::fd::project(div_mesh_velocity.value().get(),
-                                              dg_mesh, subcell_mesh.extents());
-      const auto& evolved_vars = db::get<evolved_vars_tag>(*box);
-
-      tmpl::for_each<typename variables_tag::tags_list>(
-          [&dt_vars_ptr, &div_mesh_velocity_subcell,
-           &evolved_vars](auto evolved_var_tag_v) {
-            using evolved_var_tag =
-                tmpl::type_from<decltype(evolved_var_tag_v)>;
-            using dt_tag = ::Tags::dt<evolved_var_tag>;
-            auto& dt_var = get<dt_tag>(*dt_vars_ptr);
-            const auto& evolved_var = get<evolved_var_tag>(evolved_vars);
-            for (size_t i = 0; i < dt_var.size(); ++i) {
-              dt_var[i] -= div_mesh_velocity_subcell * evolved_var[i];
-            }
-          });
-    }
-
-    if (UNLIKELY(fd_derivative_order != ::fd::DerivativeOrder::Two)) {
-      ERROR(
-          "We don't yet have high-order flux corrections for curved/moving "
-          "meshes and the implementation assumes curved/moving meshes. We need "
-          "to dot the Cartesian fluxes into the cell-centered "
-          "J inv(J)^{hat{i}}_j to get JF^{hat{i}} = J inv(J)^{hat{i}}_j F^j."
-          " Some care needs to be taken since we also get F^j from our "
-          "neighbors, which leaves the question as to whether to interpolate "
-          "the _inertial fluxes_ and then transform or whether to transform "
-          "and then interpolate the _densitized logical fluxes_.");
-    }
-    std::optional<std::array<Variables<evolved_vars_tags>, 3>>
-        high_order_corrections{};
-    ::fd::cartesian_high_order_flux_corrections(
-        make_not_null(&high_order_corrections),
-
-        db::get<evolution::dg::subcell::Tags::CellCenteredFlux<
-            evolved_vars_tags, 3>>(*box),
-        boundary_corrections, fd_derivative_order,
-        db::get<evolution::dg::subcell::Tags::GhostDataForReconstruction<3>>(
-            *box),
-        subcell_mesh, recons.ghost_zone_size(),
-        reconstruction_order.value_or(
-            std::array<gsl::span<std::uint8_t>, 3>{}));
-
-    const auto& cell_centered_det_inv_jacobian = db::get<
-        evolution::dg::subcell::fd::Tags::DetInverseJacobianLogicalToInertial>(
-        *box);
-    for (size_t dim = 0; dim < 3; ++dim) {
-      const auto& boundary_correction_in_axis =
-          high_order_corrections.has_value()
-              ? gsl::at(high_order_corrections.value(), dim)
-              : gsl::at(boundary_corrections, dim);
-      const double inverse_delta = gsl::at(one_over_delta_xi, dim);
-      tmpl::for_each<typename variables_tag::tags_list>(
-          [&dt_vars_ptr, &boundary_correction_in_axis,
-           &cell_centered_det_inv_jacobian, dim, inverse_delta,
-           &subcell_mesh](auto evolved_var_tag_v) {
-            using evolved_var_tag =
-                tmpl::type_from<decltype(evolved_var_tag_v)>;
-            using dt_tag = ::Tags::dt<evolved_var_tag>;
-            auto& dt_var = get<dt_tag>(*dt_vars_ptr);
-            const auto& var_correction =
-                get<evolved_var_tag>(boundary_correction_in_axis);
-            for (size_t i = 0; i < dt_var.size(); ++i) {
-              evolution::dg::subcell::add_cartesian_flux_divergence(
-                  make_not_null(&dt_var[i]), inverse_delta,
-                  get(cell_centered_det_inv_jacobian), var_correction[i],
-                  subcell_mesh.extents(), dim);
-            }
-          });
+    if constexpr (not fused_dimension_sweeps) {
+      std::optional<std::array<Variables<evolved_vars_tags>, 3>>
+          high_order_corrections{};
+      ::fd::cartesian_high_order_flux_corrections(
+          make_not_null(&high_order_corrections),
+
+          db::get<evolution::dg::subcell::Tags::CellCenteredFlux<
+              evolved_vars_tags, 3>>(*box),
+          boundary_corrections, fd_derivative_order,
+          db::get<
+              evolution::dg::subcell::Tags::GhostDataForReconstruction<3>>(
+              *box),
+          subcell_mesh, recons.ghost_zone_size(),
+          reconstruction_order.value_or(
+              std::array<gsl::span<std::uint8_t>, 3>{}));
+
+      for (size_t dim = 0; dim < 3; ++dim) {
+        add_flux_divergence(dim,
+                            high_order_corrections.has_value()
+                                ? gsl::at(high_order_corrections.value(), dim)
+                                : gsl::at(boundary_corrections, dim));
+      }
     }
 
     evolution::dg::subcell::store_reconstruction_order_in_databox(
@@ -27,22 +27,13 @@ template void volume_terms<::grmhd::ValenciaDivClean::TimeDerivativeTerms>(
         Variables<typename ::grmhd::ValenciaDivClean::System::
                       compute_volume_time_derivative_terms::temporary_tags>*>
         temporaries,
-    [[maybe_unused]] const gsl::not_null<Variables<db::wrap_tags_in<
-        ::Tags::div, db::wrap_tags_in<::Tags::Flux,
-                                      typename ::grmhd::ValenciaDivClean::
-                                          System::flux_variables,
-                                      tmpl::size_t<3>, Frame::Inertial>>>*>
-        div_fluxes,
     const Variables<
         typename ::grmhd::ValenciaDivClean::System::variables_tag::tags_list>&
         evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<3>& mesh,
     const InverseJacobian<DataVector, 3, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
 
@@ -68,4 +59,7 @@ template void volume_terms<::grmhd::ValenciaDivClean::TimeDerivativeTerms>(
     const Scalar<DataVector>& specific_internal_energy,
     const tnsr::ii<DataVector, 3, Frame::Inertial>& extrinsic_curvature,
     const double& constraint_damping_parameter);
+
+INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(::grmhd::ValenciaDivClean::System,
+                                            3)
 }  // namespace evolution::dg::Actions::detail
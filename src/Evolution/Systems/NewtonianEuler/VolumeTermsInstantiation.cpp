@@ -32,22 +32,12 @@ namespace evolution::dg::Actions::detail {
       gsl::not_null<Variables<typename ::NewtonianEuler::System<DIM(          \
           data)>::compute_volume_time_derivative_terms::temporary_tags>*>     \
           temporaries,                                                        \
-      gsl::not_null<Variables<db::wrap_tags_in<                               \
-          ::Tags::div,                                                        \
-          db::wrap_tags_in<                                                   \
-              ::Tags::Flux,                                                   \
-              typename ::NewtonianEuler::System<DIM(data)>::flux_variables,   \
-              tmpl::size_t<DIM(data)>, Frame::Inertial>>>*>                   \
-          div_fluxes,                                                         \
       const Variables<typename ::NewtonianEuler::System<DIM(                  \
           data)>::variables_tag::tags_list>& evolved_vars,                    \
-      const ::dg::Formulation dg_formulation, const Mesh<DIM(data)>& mesh,    \
-      [[maybe_unused]] const tnsr::I<DataVector, DIM(data), Frame::Inertial>& \
-          inertial_coordinates,                                               \
+      const Mesh<DIM(data)>& mesh,                                            \
       const InverseJacobian<DataVector, DIM(data), Frame::ElementLogical,     \
                             Frame::Inertial>&                                 \
           logical_to_inertial_inverse_jacobian,                               \
-      [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,  \
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
@@ -59,7 +49,9 @@ namespace evolution::dg::Actions::detail {
       const Scalar<DataVector>& specific_internal_energy,                     \
       const EquationsOfState::EquationOfState<false, 2>& eos,                 \
       const tnsr::I<DataVector, DIM(data)>& coords, const double& time,       \
-      const ::NewtonianEuler::Sources::Source<DIM(data)>& source);
+      const ::NewtonianEuler::Sources::Source<DIM(data)>& source);            \
+  INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(                                \
+      ::NewtonianEuler::System<DIM(data)>, DIM(data))
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -28,21 +28,12 @@ evolution::dg::Actions::detail::volume_terms<::ScalarTensor::TimeDerivative>(
         Variables<typename ::ScalarTensor::System::
                       compute_volume_time_derivative_terms::temporary_tags>*>
         temporaries,
-    const gsl::not_null<Variables<db::wrap_tags_in<
-        ::Tags::div,
-        db::wrap_tags_in<::Tags::Flux,
-                         typename ::ScalarTensor::System::flux_variables,
-                         tmpl::size_t<3>, Frame::Inertial>>>*>
-        div_fluxes,
     const Variables<typename ::ScalarTensor::System::variables_tag::tags_list>&
         evolved_vars,
-    const ::dg::Formulation dg_formulation, const Mesh<3>& mesh,
-    [[maybe_unused]] const tnsr::I<DataVector, 3, Frame::Inertial>&
-        inertial_coordinates,
+    const Mesh<3>& mesh,
     const InverseJacobian<DataVector, 3, Frame::ElementLogical,
                           Frame::Inertial>&
         logical_to_inertial_inverse_jacobian,
-    [[maybe_unused]] const Scalar<DataVector>* const det_inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>& mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
     // GH argument variables
@@ -74,3 +65,4 @@ evolution::dg::Actions::detail::volume_terms<::ScalarTensor::TimeDerivative>(
 
 INSTANTIATE_PARTIAL_DERIVATIVES_WITH_SYSTEM(ScalarTensor::System, 3,
                                             Frame::Inertial)
+INSTANTIATE_ADD_FLUX_DIVERGENCE_WITH_SYSTEM(::ScalarTensor::System, 3)
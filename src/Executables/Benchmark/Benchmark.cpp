@@ -5,12 +5,20 @@
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
+#include <algorithm>
+#include <array>
 #include <charm++.h>
+#include <cmath>
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
@@ -18,12 +26,24 @@
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Evolution/Systems/Ccz4/FusedTimeDerivative.hpp"
+#include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
+#include "NumericalAlgorithms/FiniteDifference/AoWeno.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -108,6 +128,348 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);  // NOLINT
 }  // namespace
 
+namespace {
+// In this anonymous namespace are microbenchmarks of the finite-difference
+// reconstruction schemes used by the DG-subcell systems. Comparing builds with
+// and without `USE_XSIMD` gives the speedup from reconstructing several
+// stripes at once in SIMD lanes. The argument is the number of cells per
+// dimension, and `ghost_zone_size` is the number of ghost cells the
+// reconstructor needs (half its stencil width plus one).
+template <typename Reconstruct>
+void bench_fd_reconstruction(benchmark::State& state,  // NOLINT
+                             const size_t ghost_zone_size,
+                             const Reconstruct& reconstruct) {
+  constexpr size_t Dim = 3;
+  constexpr size_t number_of_variables = 5;
+  const auto points_per_dim = static_cast<size_t>(state.range(0));
+  const Index<Dim> extents{points_per_dim};
+  const size_t volume_size = extents.product() * number_of_variables;
+  const size_t ghost_size = ghost_zone_size * volume_size / points_per_dim;
+  const size_t face_size = volume_size / points_per_dim * (points_per_dim + 1);
+
+  DataVector volume_vars(volume_size);
+  for (size_t i = 0; i < volume_size; ++i) {
+    volume_vars[i] = 1.0 + 0.5 * std::sin(0.37 * static_cast<double>(i));
+  }
+  const DataVector ghost_vars(ghost_size, 1.2);
+  DirectionMap<Dim, gsl::span<const double>> ghost_cell_vars{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    ghost_cell_vars[direction] =
+        gsl::make_span(ghost_vars.data(), ghost_vars.size());
+  }
+  DataVector upper(Dim * face_size);
+  DataVector lower(Dim * face_size);
+  std::array<gsl::span<double>, Dim> upper_spans{};
+  std::array<gsl::span<double>, Dim> lower_spans{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(upper_spans, d) =
+        gsl::make_span(upper.data() + d * face_size, face_size);
+    gsl::at(lower_spans, d) =
+        gsl::make_span(lower.data() + d * face_size, face_size);
+  }
+
+  for (auto _ : state) {
+    reconstruct(make_not_null(&upper_spans), make_not_null(&lower_spans),
+                gsl::make_span(volume_vars.data(), volume_vars.size()),
+                ghost_cell_vars, extents, number_of_variables);
+    benchmark::DoNotOptimize(upper.data());
+    benchmark::DoNotOptimize(lower.data());
+  }
+}
+
+using ReconsSpans = gsl::not_null<std::array<gsl::span<double>, 3>*>;
+using GhostSpans = DirectionMap<3, gsl::span<const double>>;
+
+void bench_monotonised_central(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction(
+      state, 2, [](const ReconsSpans upper, const ReconsSpans lower,
+                   const gsl::span<const double>& volume,
+                   const GhostSpans& ghosts, const Index<3>& extents,
+                   const size_t number_of_variables) {
+        fd::reconstruction::monotonised_central(upper, lower, volume, ghosts,
+                                                extents, number_of_variables);
+      });
+}
+BENCHMARK(bench_monotonised_central)->Arg(6)->Arg(10)->Arg(13);  // NOLINT
+
+void bench_wcns5z(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction(
+      state, 3, [](const ReconsSpans upper, const ReconsSpans lower,
+                   const gsl::span<const double>& volume,
+                   const GhostSpans& ghosts, const Index<3>& extents,
+                   const size_t number_of_variables) {
+        fd::reconstruction::wcns5z<
+            2, fd::reconstruction::detail::MonotonisedCentralReconstructor>(
+            upper, lower, volume, ghosts, extents, number_of_variables,
+            2.0e-16, 1);
+      });
+}
+BENCHMARK(bench_wcns5z)->Arg(6)->Arg(10)->Arg(13);  // NOLINT
+
+void bench_aoweno_53(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction(
+      state, 3, [](const ReconsSpans upper, const ReconsSpans lower,
+                   const gsl::span<const double>& volume,
+                   const GhostSpans& ghosts, const Index<3>& extents,
+                   const size_t number_of_variables) {
+        fd::reconstruction::aoweno_53<8>(upper, lower, volume, ghosts, extents,
+                                         number_of_variables, 0.85, 0.999,
+                                         1.0e-12);
+      });
+}
+BENCHMARK(bench_aoweno_53)->Arg(6)->Arg(10)->Arg(13);  // NOLINT
+
+void bench_monotonicity_preserving_5(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction(
+      state, 3, [](const ReconsSpans upper, const ReconsSpans lower,
+                   const gsl::span<const double>& volume,
+                   const GhostSpans& ghosts, const Index<3>& extents,
+                   const size_t number_of_variables) {
+        fd::reconstruction::monotonicity_preserving_5(
+            upper, lower, volume, ghosts, extents, number_of_variables, 4.0,
+            1.0e-10);
+      });
+}
+BENCHMARK(bench_monotonicity_preserving_5)->Arg(6)->Arg(10)->Arg(13);  // NOLINT
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the CCZ4 RHS. The first
+// argument is the number of grid points per dimension and the second is the
+// number of grid points per block of `Ccz4::FusedTimeDerivative`, where 0
+// means all grid points are computed in one block, as
+// `Ccz4::TimeDerivative` does. The `TemporaryBytes` counter is the memory
+// held by the temporaries, and `TemporaryTraffic` is the number of bytes of
+// temporaries written per second, all of which go to main memory if the
+// temporaries don't fit in cache.
+void bench_ccz4_time_derivative(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const auto points_per_dim = static_cast<size_t>(state.range(0));
+  const size_t num_points = points_per_dim * points_per_dim * points_per_dim;
+  const size_t block_size =
+      state.range(1) == 0 ? num_points : static_cast<size_t>(state.range(1));
+
+  // A smooth perturbation of flat space
+  DataVector perturbation(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    perturbation[i] = 0.01 * std::sin(0.37 * static_cast<double>(i));
+  }
+  const auto make = [&perturbation](auto tensor) {
+    for (auto& component : tensor) {
+      component = perturbation;
+    }
+    return tensor;
+  };
+  const auto eta = make(Scalar<DataVector>{});
+  const auto k_0 = make(Scalar<DataVector>{});
+  const auto d_k_0 = make(tnsr::i<DataVector, Dim>{});
+  auto conformal_spatial_metric = make(tnsr::ii<DataVector, Dim>{});
+  for (size_t i = 0; i < Dim; ++i) {
+    conformal_spatial_metric.get(i, i) += 1.0;
+  }
+  const auto ln_lapse = make(Scalar<DataVector>{});
+  const auto shift = make(tnsr::I<DataVector, Dim>{});
+  const auto ln_conformal_factor = make(Scalar<DataVector>{});
+  const auto a_tilde = make(tnsr::ii<DataVector, Dim>{});
+  const auto trace_extrinsic_curvature = make(Scalar<DataVector>{});
+  const auto theta = make(Scalar<DataVector>{});
+  const auto gamma_hat = make(tnsr::I<DataVector, Dim>{});
+  const auto b = make(tnsr::I<DataVector, Dim>{});
+  const auto field_a = make(tnsr::i<DataVector, Dim>{});
+  const auto field_b = make(tnsr::iJ<DataVector, Dim>{});
+  const auto field_d = make(tnsr::ijj<DataVector, Dim>{});
+  const auto field_p = make(tnsr::i<DataVector, Dim>{});
+  const auto d_a_tilde = make(tnsr::ijj<DataVector, Dim>{});
+  const auto d_trace_extrinsic_curvature = make(tnsr::i<DataVector, Dim>{});
+  const auto d_theta = make(tnsr::i<DataVector, Dim>{});
+  const auto d_gamma_hat = make(tnsr::iJ<DataVector, Dim>{});
+  const auto d_b = make(tnsr::iJ<DataVector, Dim>{});
+  const auto d_field_a = make(tnsr::ij<DataVector, Dim>{});
+  const auto d_field_b = make(tnsr::ijK<DataVector, Dim>{});
+  const auto d_field_d = make(tnsr::ijkk<DataVector, Dim>{});
+  const auto d_field_p = make(tnsr::ij<DataVector, Dim>{});
+
+  tnsr::ii<DataVector, Dim> dt_conformal_spatial_metric(num_points);
+  Scalar<DataVector> dt_ln_lapse(num_points);
+  tnsr::I<DataVector, Dim> dt_shift(num_points);
+  Scalar<DataVector> dt_ln_conformal_factor(num_points);
+  tnsr::ii<DataVector, Dim> dt_a_tilde(num_points);
+  Scalar<DataVector> dt_trace_extrinsic_curvature(num_points);
+  Scalar<DataVector> dt_theta(num_points);
+  tnsr::I<DataVector, Dim> dt_gamma_hat(num_points);
+  tnsr::I<DataVector, Dim> dt_b(num_points);
+  tnsr::i<DataVector, Dim> dt_field_a(num_points);
+  tnsr::iJ<DataVector, Dim> dt_field_b(num_points);
+  tnsr::ijj<DataVector, Dim> dt_field_d(num_points);
+  tnsr::i<DataVector, Dim> dt_field_p(num_points);
+
+  for (auto _ : state) {
+    Ccz4::FusedTimeDerivative<Dim>::apply(
+        make_not_null(&dt_conformal_spatial_metric),
+        make_not_null(&dt_ln_lapse), make_not_null(&dt_shift),
+        make_not_null(&dt_ln_conformal_factor), make_not_null(&dt_a_tilde),
+        make_not_null(&dt_trace_extrinsic_curvature), make_not_null(&dt_theta),
+        make_not_null(&dt_gamma_hat), make_not_null(&dt_b),
+        make_not_null(&dt_field_a), make_not_null(&dt_field_b),
+        make_not_null(&dt_field_d), make_not_null(&dt_field_p), 1.0, 1.6, eta,
+        0.75, k_0, d_k_0, 0.1, 0.3, 0.4, 0.7, 10.0, Ccz4::EvolveShift::True,
+        Ccz4::SlicingConditionType::Log, conformal_spatial_metric, ln_lapse,
+        shift, ln_conformal_factor, a_tilde, trace_extrinsic_curvature, theta,
+        gamma_hat, b, field_a, field_b, field_d, field_p, d_a_tilde,
+        d_trace_extrinsic_curvature, d_theta, d_gamma_hat, d_b, d_field_a,
+        d_field_b, d_field_d, d_field_p, block_size);
+    benchmark::DoNotOptimize(get(dt_theta).data());
+  }
+
+  const double bytes_per_point =
+      static_cast<double>(
+          Ccz4::FusedTimeDerivative<Dim>::number_of_temporary_components()) *
+      sizeof(double);
+  state.counters["TemporaryBytes"] = benchmark::Counter(
+      bytes_per_point * static_cast<double>(std::min(block_size, num_points)),
+      benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["TemporaryTraffic"] = benchmark::Counter(
+      bytes_per_point * static_cast<double>(num_points),
+      benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1024);
+}
+BENCHMARK(bench_ccz4_time_derivative)  // NOLINT
+    ->Args({6, 0})
+    ->Args({6, 32})
+    ->Args({10, 0})
+    ->Args({10, 32})
+    ->Args({10, 128})
+    ->Args({14, 0})
+    ->Args({14, 32});
+}  // namespace
+
+namespace {
+// Projecting the packaged data of an element on an AMR-refined domain to its
+// mortars. Four faces of the 3D element border refined neighbors, so each has
+// four mortars of different mortar size, and the other two faces border
+// neighbors of higher polynomial order. The mortars of the same mortar size
+// on different faces share their projection matrices. The first argument is
+// the number of grid points per dimension and the second is 0 to project each
+// mortar separately, as `dg::project_to_mortar` does, and 1 to use
+// `dg::project_to_mortars`.
+// clang-tidy: don't pass be non-const reference
+void bench_project_to_mortars(benchmark::State& state) {  // NOLINT
+  using Spectral::MortarSize;
+  constexpr size_t number_of_components = 20;
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const bool batched = state.range(1) == 1;
+  const Mesh<2> face_mesh{pts_1d, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const Mesh<2> p_refined_mortar_mesh{pts_1d + 2, Spectral::Basis::Legendre,
+                                      Spectral::Quadrature::GaussLobatto};
+  std::vector<std::pair<Mesh<2>, dg::MortarSize<2>>> mortars{};
+  for (size_t face = 0; face < 4; ++face) {
+    for (const auto& mortar_size :
+         {dg::MortarSize<2>{{MortarSize::LowerHalf, MortarSize::LowerHalf}},
+          dg::MortarSize<2>{{MortarSize::UpperHalf, MortarSize::LowerHalf}},
+          dg::MortarSize<2>{{MortarSize::LowerHalf, MortarSize::UpperHalf}},
+          dg::MortarSize<2>{{MortarSize::UpperHalf, MortarSize::UpperHalf}}}) {
+      mortars.emplace_back(face_mesh, mortar_size);
+    }
+  }
+  for (size_t face = 0; face < 2; ++face) {
+    mortars.emplace_back(
+        p_refined_mortar_mesh,
+        dg::MortarSize<2>{{MortarSize::Full, MortarSize::Full}});
+  }
+
+  const DataVector face_data{
+      number_of_components * face_mesh.number_of_grid_points(), 1.0};
+  std::vector<DataVector> mortar_data{};
+  std::vector<dg::MortarProjection<2>> projections{};
+  mortar_data.reserve(mortars.size());
+  for (const auto& [mortar_mesh, mortar_size] : mortars) {
+    mortar_data.emplace_back(number_of_components *
+                             mortar_mesh.number_of_grid_points());
+    projections.push_back(dg::MortarProjection<2>{
+        face_data.data(), mortar_data.back().data(), face_mesh, mortar_mesh,
+        mortar_size});
+  }
+
+  for (auto _ : state) {
+    if (batched) {
+      dg::project_to_mortars(projections, number_of_components);
+    } else {
+      for (const auto& projection : projections) {
+        DataVector result{projection.mortar_data,
+                          number_of_components *
+                              projection.mortar_mesh.number_of_grid_points()};
+        apply_matrices(make_not_null(&result),
+                       Spectral::projection_matrix_parent_to_child(
+                           face_mesh, projection.mortar_mesh,
+                           projection.mortar_size),
+                       face_data, face_mesh.extents());
+      }
+    }
+    benchmark::DoNotOptimize(mortar_data.front().data());
+  }
+}
+BENCHMARK(bench_project_to_mortars)  // NOLINT
+    ->Args({4, 0})
+    ->Args({4, 1})
+    ->Args({6, 0})
+    ->Args({6, 1})
+    ->Args({8, 0})
+    ->Args({8, 1});
+}  // namespace
+
+namespace {
+// Handing the items of an element over to its children or parent during AMR.
+// The first argument is the number of grid points per dimension of the 3D
+// element, which holds 20 components, and the second is 0 to copy the items
+// with `db::copy_items` and 1 to move them with `db::move_items`. Both are
+// followed by the serialization that Charm++ applies to the arguments of the
+// simple action that sends the items, which moving doesn't avoid.
+struct AmrField : db::SimpleTag {
+  using type = tnsr::aa<DataVector, 3>;
+};
+struct AmrOtherField : db::SimpleTag {
+  using type = tnsr::ii<DataVector, 3>;
+};
+struct AmrLastField : db::SimpleTag {
+  using type = tnsr::a<DataVector, 3>;
+};
+struct AmrItem : db::SimpleTag {
+  using type = Variables<tmpl::list<AmrField, AmrOtherField, AmrLastField>>;
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_amr_item_transfer(benchmark::State& state) {  // NOLINT
+  const auto points_per_dim = static_cast<size_t>(state.range(0));
+  const bool move = state.range(1) == 1;
+  const AmrItem::type vars{points_per_dim * points_per_dim * points_per_dim,
+                           1.0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto box = db::create<db::AddSimpleTags<AmrItem>>(vars);
+    state.ResumeTiming();
+    if (move) {
+      const auto items =
+          db::move_items<tmpl::list<AmrItem>>(make_not_null(&box));
+      benchmark::DoNotOptimize(serialize(items).data());
+    } else {
+      const auto items = db::copy_items<tmpl::list<AmrItem>>(box);
+      benchmark::DoNotOptimize(serialize(items).data());
+    }
+  }
+  state.counters["ItemBytes"] = benchmark::Counter(
+      static_cast<double>(vars.size() * sizeof(double)),
+      benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+BENCHMARK(bench_amr_item_transfer)  // NOLINT
+    ->Args({6, 0})
+    ->Args({6, 1})
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({14, 0})
+    ->Args({14, 1});
+}  // namespace
+
 // Ignore the warning about an extra ';' because some versions of benchmark
 // require it
 #pragma GCC diagnostic push
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/BufferedReductionWriter.hpp"
+
+#include <cstddef>
+#include <map>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/StdHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers {
+BufferedReductionWriter::BufferedReductionWriter(
+    const size_t max_buffered_rows, const double max_seconds_between_flushes)
+    : max_buffered_rows_(max_buffered_rows),
+      max_seconds_between_flushes_(max_seconds_between_flushes) {}
+
+void BufferedReductionWriter::append(const std::string& file_prefix,
+                                     const std::string& subfile_name,
+                                     const std::string& input_source,
+                                     std::vector<std::string> legend,
+                                     std::vector<double> row) {
+  if (legend.size() != row.size()) {
+    ERROR("There must be one name provided for each piece of data. You provided "
+          << legend.size() << " names: '" << get_output(legend)
+          << "' but there are " << row.size()
+          << " pieces of data being reduced");
+  }
+  auto& file = files_[file_prefix];
+  if (file.subfiles.empty()) {
+    file.input_source = input_source;
+  }
+  auto& subfile = file.subfiles[subfile_name];
+  if (subfile.rows.empty()) {
+    subfile.legend = std::move(legend);
+  } else if (subfile.legend != legend) {
+    using ::operator<<;
+    ERROR("The legend for subfile '"
+          << subfile_name << "' of '" << file_prefix
+          << ".h5' changed from " << subfile.legend << " to " << legend);
+  }
+  subfile.rows.push_back(std::move(row));
+
+  const double now = sys::wall_time();
+  if (number_of_buffered_rows_ == 0) {
+    oldest_row_time_ = now;
+  }
+  ++number_of_buffered_rows_;
+  if (number_of_buffered_rows_ >= max_buffered_rows_ or
+      now - oldest_row_time_ >= max_seconds_between_flushes_) {
+    flush();
+  }
+}
+
+void BufferedReductionWriter::flush() {
+  if (number_of_buffered_rows_ == 0) {
+    return;
+  }
+  constexpr size_t version_number = 0;
+  for (auto& [file_prefix, file] : files_) {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
+                                                 file.input_source);
+    for (auto& [subfile_name, subfile] : file.subfiles) {
+      auto& time_series_file = h5file.try_insert<h5::Dat>(
+          subfile_name, std::move(subfile.legend), version_number);
+      time_series_file.append(subfile.rows);
+      h5file.close_current_object();
+    }
+  }
+  files_.clear();
+  number_of_buffered_rows_ = 0;
+}
+
+void BufferedReductionWriter::pup(PUP::er& p) {
+  p | max_buffered_rows_;
+  p | max_seconds_between_flushes_;
+  p | files_;
+  p | number_of_buffered_rows_;
+  if (p.isUnpacking()) {
+    // The wallclock is reset when restarting from a checkpoint
+    oldest_row_time_ = sys::wall_time();
+  }
+}
+
+void BufferedReductionWriter::SubfileBuffer::pup(PUP::er& p) {
+  p | legend;
+  p | rows;
+}
+
+void BufferedReductionWriter::FileBuffer::pup(PUP::er& p) {
+  p | input_source;
+  p | subfiles;
+}
+}  // namespace observers
@@ -0,0 +1,103 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Buffers rows of reduction data in memory and writes them to the
+ * `h5::Dat` subfiles of the reduction files in chunks.
+ *
+ * \details Writing every reduction row directly to disk opens the HDF5 file,
+ * opens (or inserts) the subfile, appends a single row, and closes everything
+ * again, so these operations and the metadata updates that come with them are
+ * repeated for every observed quantity at every observation. Instead, rows
+ * are collected per file and subfile and written together by `flush()`, which
+ * opens each file once and appends all buffered rows of a subfile in a single
+ * call.
+ *
+ * Buffered rows are written by `append()` once `max_buffered_rows()` rows are
+ * buffered or once the oldest buffered row has been held for more than
+ * `max_seconds_between_flushes()` of wallclock time. The
+ * `observers::ObserverWriter` additionally flushes at every phase change, so
+ * no data is buffered when checkpoints are written, and before the
+ * executable exits.
+ *
+ * \warning The age of the buffered rows is only checked when a row is
+ * appended; there is no timer. If no reduction data arrives, e.g. because
+ * nothing is observed for a long stretch of the evolution, buffered rows stay
+ * in memory until the next append or phase change, so
+ * `max_seconds_between_flushes()` is not a bound on how stale the files on
+ * disk can be. Use `observers::ThreadedActions::FlushReductionData` where the
+ * files must be current.
+ *
+ * This class is not thread-safe. Callers must hold the
+ * `observers::Tags::H5FileLock`.
+ */
+class BufferedReductionWriter {
+ public:
+  static constexpr size_t default_max_buffered_rows = 1000;
+  static constexpr double default_max_seconds_between_flushes = 60.0;
+
+  explicit BufferedReductionWriter(
+      size_t max_buffered_rows = default_max_buffered_rows,
+      double max_seconds_between_flushes = default_max_seconds_between_flushes);
+
+  /// Buffer a single row of data for the subfile `subfile_name` of the file
+  /// `file_prefix + ".h5"`, flushing all buffered data if the flush policy
+  /// requires it. This is the only place the age of the buffered rows is
+  /// checked.
+  void append(const std::string& file_prefix, const std::string& subfile_name,
+              const std::string& input_source,
+              std::vector<std::string> legend, std::vector<double> row);
+
+  /// Write all buffered rows to disk.
+  void flush();
+
+  size_t number_of_buffered_rows() const { return number_of_buffered_rows_; }
+  size_t max_buffered_rows() const { return max_buffered_rows_; }
+  double max_seconds_between_flushes() const {
+    return max_seconds_between_flushes_;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct SubfileBuffer {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  struct FileBuffer {
+    std::string input_source{};
+    // Ordered so subfiles are always created in the same order
+    std::map<std::string, SubfileBuffer> subfiles{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  size_t max_buffered_rows_{default_max_buffered_rows};
+  double max_seconds_between_flushes_{default_max_seconds_between_flushes};
+  std::map<std::string, FileBuffer> files_{};
+  size_t number_of_buffered_rows_{0};
+  // Wallclock time at which the oldest buffered row was appended
+  double oldest_row_time_{0.0};
+};
+}  // namespace observers
@@ -4,11 +4,14 @@
 #pragma once
 
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -64,5 +67,19 @@ struct ObserverWriter {
   static void execute_next_phase(
       const Parallel::Phase /*next_phase*/,
       Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+
+  /// Write out the reduction data buffered on node 0 before every phase
+  /// change, so that the data is on disk before checkpoints are written and
+  /// before the executable exits.
+  ///
+  /// Called synchronously by `Parallel::Main`, which lives on node 0, after
+  /// quiescence, so no threaded actions are running concurrently.
+  static void execute_before_phase_change(
+      const Parallel::Phase /*next_phase*/,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::local_synchronous_action<ThreadedActions::FlushReductionData>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+  }
 };
 }  // namespace observers
@@ -16,6 +16,7 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
@@ -230,11 +231,9 @@ void append_to_reduction_data(
     const std::vector<double>& t);
 
 template <typename... Ts, size_t... Is>
-void write_data(const std::string& subfile_name,
-                const std::string& input_source,
-                std::vector<std::string> legend, const std::tuple<Ts...>& data,
-                const std::string& file_prefix,
-                std::index_sequence<Is...> /*meta*/) {
+std::vector<double> flatten_data(const std::vector<std::string>& legend,
+                                 const std::tuple<Ts...>& data,
+                                 std::index_sequence<Is...> /*meta*/) {
   static_assert(sizeof...(Ts) > 0,
                 "Must be reducing at least one piece of data");
   std::vector<double> data_to_append{};
@@ -248,6 +247,16 @@ void write_data(const std::string& subfile_name,
         << "' but there are " << data_to_append.size()
         << " pieces of data being reduced");
   }
+  return data_to_append;
+}
+
+template <typename... Ts, size_t... Is>
+void write_data(const std::string& subfile_name,
+                const std::string& input_source,
+                std::vector<std::string> legend, const std::tuple<Ts...>& data,
+                const std::string& file_prefix,
+                std::index_sequence<Is...> meta) {
+  const std::vector<double> data_to_append = flatten_data(legend, data, meta);
 
   h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
                                                input_source);
@@ -256,6 +265,20 @@ void write_data(const std::string& subfile_name,
       subfile_name, std::move(legend), version_number);
   time_series_file.append(data_to_append);
 }
+
+// Same as `write_data`, but buffers the row in `writer` instead of writing it
+// to disk immediately. The caller must hold the `Tags::H5FileLock`.
+template <typename... Ts, size_t... Is>
+void buffer_data(const gsl::not_null<BufferedReductionWriter*> writer,
+                 const std::string& subfile_name,
+                 const std::string& input_source,
+                 std::vector<std::string> legend, const std::tuple<Ts...>& data,
+                 const std::string& file_prefix,
+                 std::index_sequence<Is...> meta) {
+  std::vector<double> data_to_append = flatten_data(legend, data, meta);
+  writer->append(file_prefix, subfile_name, input_source, std::move(legend),
+                 std::move(data_to_append));
+}
 }  // namespace ReductionActions_detail
 
 /*!
@@ -503,6 +526,7 @@ struct WriteReductionData {
         nodes_contributed = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
+    BufferedReductionWriter* reduction_writer = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     {
@@ -510,10 +534,11 @@ struct WriteReductionData {
       db::mutate<Tags::ReductionData<ReductionDatums...>,
                  Tags::ReductionDataNames<ReductionDatums...>,
                  Tags::NodesThatContributedReductions, Tags::ReductionDataLock,
-                 Tags::H5FileLock>(
+                 Tags::H5FileLock, Tags::ReductionWriteBuffer>(
           [&nodes_contributed, &reduction_data, &reduction_names_map,
-           &reduction_data_lock, &reduction_file_lock, &observation_id,
-           &observations_registered_with_id, &sender_node_number](
+           &reduction_data_lock, &reduction_file_lock, &reduction_writer,
+           &observation_id, &observations_registered_with_id,
+           &sender_node_number](
               const gsl::not_null<
                   typename Tags::ReductionData<ReductionDatums...>::type*>
                   reduction_data_ptr,
@@ -525,6 +550,8 @@ struct WriteReductionData {
                   nodes_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+              const gsl::not_null<BufferedReductionWriter*>
+                  reduction_writer_ptr,
               const std::unordered_map<ObservationKey, std::set<size_t>>&
                   nodes_registered_for_reductions) {
             const ObservationKey& key{observation_id.observation_key()};
@@ -547,6 +574,7 @@ struct WriteReductionData {
             nodes_contributed = &*nodes_contributed_ptr;
             reduction_data_lock = &*reduction_data_lock_ptr;
             reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_writer = &*reduction_writer_ptr;
             observations_registered_with_id =
                 nodes_registered_for_reductions.at(key).size();
           },
@@ -631,8 +659,9 @@ struct WriteReductionData {
               std::apply(*formatter, received_reduction_data.data()) + "\n");
         }
       }
-      ReductionActions_detail::write_data(
-          subfile_name, observers::input_source_from_cache(cache),
+      ReductionActions_detail::buffer_data(
+          make_not_null(reduction_writer), subfile_name,
+          observers::input_source_from_cache(cache),
           // NOLINTNEXTLINE(bugprone-use-after-move)
           std::move(reduction_names), std::move(received_reduction_data.data()),
           Parallel::get<Tags::ReductionFileName>(cache),
@@ -691,7 +720,9 @@ struct WriteReductionDataRow {
     auto& reduction_file_lock =
         db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
     const std::lock_guard hold_lock(reduction_file_lock);
-    ThreadedActions::ReductionActions_detail::write_data(
+    ThreadedActions::ReductionActions_detail::buffer_data(
+        make_not_null(&db::get_mutable_reference<Tags::ReductionWriteBuffer>(
+            make_not_null(&box))),
         subfile_name, observers::input_source_from_cache(cache),
         std::move(legend), std::move(reduction_data),
         Parallel::get<Tags::ReductionFileName>(cache),
@@ -699,5 +730,47 @@ struct WriteReductionDataRow {
   }
 };
 
+/*!
+ * \brief Write all reduction data buffered on this node to disk.
+ *
+ * Reduction data written by `WriteReductionData` and `WriteReductionDataRow`
+ * is buffered in `observers::Tags::ReductionWriteBuffer` (see
+ * `observers::BufferedReductionWriter`) and only written to disk when enough
+ * rows are buffered, when a row is appended after the oldest one has aged past
+ * the wallclock limit, or at a phase change. This action forces the buffered
+ * data to be written. The `ObserverWriter` invokes it at every phase change
+ * and before exiting, so it is only needed when the reduction file must be up
+ * to date at another point, e.g. in tests.
+ *
+ * Can be invoked either as a threaded action or as a local synchronous action
+ * on the observers::ObserverWriter component.
+ */
+struct FlushReductionData {
+  /// \brief The apply call for the threaded action
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    apply<ParallelComponent>(box, node_lock);
+  }
+
+  // The local synchronous action
+  using return_type = void;
+
+  /// \brief The apply call for the local synchronous action
+  template <typename ParallelComponent, typename DbTagList>
+  static return_type apply(
+      db::DataBox<DbTagList>& box,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/) {
+    auto& reduction_file_lock =
+        db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    const std::lock_guard hold_lock(reduction_file_lock);
+    db::get_mutable_reference<Tags::ReductionWriteBuffer>(make_not_null(&box))
+        .flush();
+  }
+};
+
 }  // namespace ThreadedActions
 }  // namespace observers
@@ -16,6 +16,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
@@ -151,6 +152,14 @@ struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// Buffered rows of reduction data waiting to be written to the reduction
+/// file on node 0.
+///
+/// Must only be accessed while holding the `H5FileLock`.
+struct ReductionWriteBuffer : db::SimpleTag {
+  using type = observers::BufferedReductionWriter;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -4,7 +4,11 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -72,6 +76,88 @@ std::array<Spectral::MortarSize, Dim - 1> mortar_size(
   return result;
 }
 
+namespace {
+template <size_t Dim>
+bool have_same_matrices(const MortarProjection<Dim>& lhs,
+                        const MortarProjection<Dim>& rhs) {
+  return lhs.face_mesh == rhs.face_mesh and
+         lhs.mortar_mesh == rhs.mortar_mesh and
+         lhs.mortar_size == rhs.mortar_size;
+}
+}  // namespace
+
+template <size_t Dim>
+void project_to_mortars(const std::vector<MortarProjection<Dim>>& projections,
+                        const size_t number_of_components) {
+  std::vector<bool> is_projected(projections.size(), false);
+  std::vector<size_t> group{};
+  DataVector buffer{};
+  for (size_t i = 0; i < projections.size(); ++i) {
+    if (is_projected[i]) {
+      continue;
+    }
+    const MortarProjection<Dim>& projection = projections[i];
+    ASSERT(Spectral::needs_projection(projection.face_mesh,
+                                      projection.mortar_mesh,
+                                      projection.mortar_size),
+           "project_to_mortars should not be called for a face mesh and "
+           "mortar mesh that are identical. Please elide the copy instead.");
+    const auto projection_matrices =
+        Spectral::projection_matrix_parent_to_child(projection.face_mesh,
+                                                    projection.mortar_mesh,
+                                                    projection.mortar_size);
+    const size_t face_data_size =
+        number_of_components * projection.face_mesh.number_of_grid_points();
+    const size_t mortar_data_size =
+        number_of_components * projection.mortar_mesh.number_of_grid_points();
+
+    // Find the other projections with the same matrices
+    group.clear();
+    for (size_t j = i + 1; j < projections.size(); ++j) {
+      if (not is_projected[j] and
+          have_same_matrices(projections[j], projection)) {
+        group.push_back(j);
+      }
+    }
+
+    if (group.empty()) {
+      // Project directly from the face to the mortar. This is the common case
+      // for h-refined faces, where every mortar of the face has a different
+      // mortar size, and batching would only add the copies.
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const DataVector face_data{const_cast<double*>(projection.face_data),
+                                 face_data_size};
+      DataVector mortar_data{projection.mortar_data, mortar_data_size};
+      apply_matrices(make_not_null(&mortar_data), projection_matrices,
+                     face_data, projection.face_mesh.extents());
+      continue;
+    }
+
+    group.insert(group.begin(), i);
+    for (const size_t index : group) {
+      is_projected[index] = true;
+    }
+    // The data of the group is stored one face after the other, which is
+    // the layout of a Variables with the components of all faces.
+    buffer.destructive_resize(group.size() *
+                              (face_data_size + mortar_data_size));
+    DataVector face_data{buffer.data(), group.size() * face_data_size};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    DataVector mortar_data{buffer.data() + group.size() * face_data_size,
+                           group.size() * mortar_data_size};
+    for (size_t k = 0; k < group.size(); ++k) {
+      std::copy_n(projections[group[k]].face_data, face_data_size,
+                  face_data.data() + k * face_data_size);  // NOLINT
+    }
+    apply_matrices(make_not_null(&mortar_data), projection_matrices, face_data,
+                   projection.face_mesh.extents());
+    for (size_t k = 0; k < group.size(); ++k) {
+      std::copy_n(mortar_data.data() + k * mortar_data_size,  // NOLINT
+                  mortar_data_size, projections[group[k]].mortar_data);
+    }
+  }
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define INSTANTIATE(_, data)                                               \
   template Mesh<DIM(data)> mortar_mesh(const Mesh<DIM(data)>& face_mesh1,  \
@@ -79,7 +165,10 @@ std::array<Spectral::MortarSize, Dim - 1> mortar_size(
   template std::array<Spectral::MortarSize, DIM(data)> mortar_size(        \
       const ElementId<DIM(data) + 1>& self,                                \
       const ElementId<DIM(data) + 1>& neighbor, size_t dimension,          \
-      const OrientationMap<DIM(data) + 1>& orientation);
+      const OrientationMap<DIM(data) + 1>& orientation);                  \
+  template void project_to_mortars(                                        \
+      const std::vector<MortarProjection<DIM(data)>>& projections,         \
+      size_t number_of_components);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (0, 1, 2))
 
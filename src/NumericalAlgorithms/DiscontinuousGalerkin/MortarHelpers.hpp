@@ -10,6 +10,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -95,6 +96,42 @@ Variables<Tags> project_to_mortar(const Variables<Tags>& vars,
 }
 /// @}
 
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief A projection of data from a face to a mortar, see
+ * `dg::project_to_mortars`
+ */
+template <size_t Dim>
+struct MortarProjection {
+  const double* face_data = nullptr;
+  double* mortar_data = nullptr;
+  Mesh<Dim> face_mesh{};
+  Mesh<Dim> mortar_mesh{};
+  MortarSize<Dim> mortar_size{};
+};
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Project data from several faces of an element to their mortars.
+ *
+ * \details The data of each projection has `number_of_components` components
+ * with the contiguous layout. Projections with the same face mesh, mortar mesh,
+ * and mortar size apply the same matrices, so they are done together: their
+ * face data is gathered into one buffer, projected with a single
+ * `apply_matrices` call (i.e. one blocked matrix multiplication per dimension),
+ * and scattered to the mortars. A projection that shares its matrices with no
+ * other is applied directly from the face to the mortar without any copies.
+ * This is the usual case for the mortars of an h-refined face, which all have
+ * different mortar sizes. The result is the same as calling
+ * `dg::project_to_mortar` for each projection. Batching pays off when several
+ * faces of an element project with the same matrices, e.g. when the neighbors
+ * on several sides have a higher polynomial order or the same refinement
+ * relative to the element.
+ */
+template <size_t Dim>
+void project_to_mortars(const std::vector<MortarProjection<Dim>>& projections,
+                        size_t number_of_components);
+
 /// @{
 /// \ingroup DiscontinuousGalerkinGroup
 /// Project variables from a mortar to a face.
@@ -3,13 +3,15 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <functional>
 #include <type_traits>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
-#include "DataStructures/SliceIterator.hpp"
+#include "DataStructures/SliceLayout.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -113,32 +115,19 @@ void project_contiguous_data_to_boundary(
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
 
-    const size_t interface_grid_points =
-        volume_mesh.extents().slice_away(sliced_dim).product();
-    const size_t volume_grid_points = volume_mesh.number_of_grid_points();
-
-    const double* vars_data = volume_fields.data();
-    // Since the face fields are a superset of the volume tags we need to find
-    // the first volume tag on the face and get the pointer for that.
-    double* interface_vars_data = get<first_volume_tag>(*face_fields)[0].data();
-
     // The reason we can't use data_on_slice is because the volume and face tags
     // are not the same, but data_on_slice assumes they are. In general, this
     // function should replace data_on_slice in the long term since in
     // additional to supporting different volume and face tags, it also supports
     // Gauss and Gauss-Lobatto points.
     //
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      for (size_t i = 0; i < number_of_independent_components; ++i) {
-        // clang-tidy: do not use pointer arithmetic
-        interface_vars_data[si.slice_offset() +                      // NOLINT
-                            i * interface_grid_points] =             // NOLINT
-            vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
-      }
-    }
+    // Since the face fields are a superset of the volume tags we need to find
+    // the first volume tag on the face and get the pointer for that.
+    SliceLayout(volume_mesh.extents(), sliced_dim, fixed_index)
+        .gather(make_not_null(get<first_volume_tag>(*face_fields)[0].data()),
+                face_fields->number_of_grid_points(), volume_fields.data(),
+                volume_fields.number_of_grid_points(),
+                number_of_independent_components);
   }
 }
 
@@ -193,34 +182,19 @@ void project_tensors_to_boundary(
     const size_t fixed_index = direction.side() == Side::Upper
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
-
-    const size_t interface_grid_points =
-        volume_mesh.extents().slice_away(sliced_dim).product();
-    const size_t volume_grid_points = volume_mesh.number_of_grid_points();
-
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      tmpl::for_each<TagsToProjectList>([&face_fields, interface_grid_points,
-                                         &si, &volume_fields,
-                                         volume_grid_points](auto tag_v) {
-        using tag = typename decltype(tag_v)::type;
-
-        const double* vars_data = get<tag>(volume_fields)[0].data();
-        double* interface_vars_data = get<tag>(*face_fields)[0].data();
-        static constexpr size_t number_of_independent_components_in_tensor =
-            std::decay_t<decltype(get<tag>(volume_fields))>::size();
-
-        for (size_t i = 0; i < number_of_independent_components_in_tensor;
-             ++i) {
-          // clang-tidy: do not use pointer arithmetic
-          interface_vars_data[si.slice_offset() +                      // NOLINT
-                              i * interface_grid_points] =             // NOLINT
-              vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
-        }
-      });
-    }
+    const SliceLayout slice_layout(volume_mesh.extents(), sliced_dim,
+                                   fixed_index);
+    tmpl::for_each<TagsToProjectList>(
+        [&face_fields, &slice_layout, &volume_fields](auto tag_v) {
+          using tag = typename decltype(tag_v)::type;
+          static constexpr size_t number_of_independent_components_in_tensor =
+              std::decay_t<decltype(get<tag>(volume_fields))>::size();
+          slice_layout.gather(make_not_null(get<tag>(*face_fields)[0].data()),
+                              face_fields->number_of_grid_points(),
+                              get<tag>(volume_fields)[0].data(),
+                              volume_fields.number_of_grid_points(),
+                              number_of_independent_components_in_tensor);
+        });
   }
 }
 
@@ -254,16 +228,15 @@ void project_tensor_to_boundary(
     const size_t fixed_index = direction.side() == Side::Upper
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
-
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      for (size_t tensor_storage_index = 0;
-           tensor_storage_index < volume_field.size(); ++tensor_storage_index) {
-        (*face_field)[tensor_storage_index][si.slice_offset()] =
-            volume_field[tensor_storage_index][si.volume_offset()];
-      }
+    const SliceLayout slice_layout(volume_mesh.extents(), sliced_dim,
+                                   fixed_index);
+    // The tensor components need not be contiguous, so slice them one at a
+    // time.
+    for (size_t tensor_storage_index = 0;
+         tensor_storage_index < volume_field.size(); ++tensor_storage_index) {
+      slice_layout.gather(
+          make_not_null((*face_field)[tensor_storage_index].data()), 0,
+          volume_field[tensor_storage_index].data(), 0, 1);
     }
   }
 }
@@ -11,7 +11,7 @@
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -24,15 +24,17 @@ class Index;
 namespace fd::reconstruction {
 namespace detail {
 struct MinmodReconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride) {
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(const T* const q,
+                                                          const int stride) {
     using std::min;
     using std::abs;
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    const double a = q[stride] - q[0];
+    const T a = q[stride] - q[0];
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    const double b = q[0] - q[-stride];
-    const double slope = 0.5 * (sgn(a) + sgn(b)) * min(abs(a), abs(b));
+    const T b = q[0] - q[-stride];
+    const T slope =
+        0.5 * (simd::sign(a) + simd::sign(b)) * min(abs(a), abs(b));
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     return {{q[0] - 0.5 * slope, q[0] + 0.5 * slope}};
   }
@@ -13,7 +13,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -28,22 +28,23 @@ class Index;
 namespace fd::reconstruction {
 namespace detail {
 struct MonotonicityPreserving5Reconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double alpha,
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double alpha,
       const double epsilon) {
     using std::abs;
     using std::max;
     using std::min;
 
     // define minmod function for 2 and 4 args
-    const auto minmod2 = [](const double x, const double y) {
-      return 0.5 * (sgn(x) + sgn(y)) * min(abs(x), abs(y));
+    const auto minmod2 = [](const T& x, const T& y) -> T {
+      return 0.5 * (simd::sign(x) + simd::sign(y)) * min(abs(x), abs(y));
     };
-    const auto minmod4 = [](const double w, const double x, const double y,
-                            const double z) {
-      const double sign_w = sgn(w);
-      return 0.125 * (sign_w + sgn(x)) *
-             abs((sign_w + sgn(y)) * (sign_w + sgn(z))) *
+    const auto minmod4 = [](const T& w, const T& x, const T& y,
+                            const T& z) -> T {
+      const T sign_w = simd::sign(w);
+      return 0.125 * (sign_w + simd::sign(x)) *
+             abs((sign_w + simd::sign(y)) * (sign_w + simd::sign(z))) *
              min(abs(w), min(abs(x), min(abs(y), abs(z))));
     };
 
@@ -52,50 +53,57 @@ struct MonotonicityPreserving5Reconstructor {
     auto result = UnlimitedReconstructor<4>::pointwise(q, stride);
 
     // compute q_{j+1/2}
-    const double q_mp_plus =
+    const T q_mp_plus =
         q[0] + minmod2(q[stride] - q[0], alpha * (q[0] - q[-stride]));
     // compute q_{j-1/2}
-    const double q_mp_minus =
+    const T q_mp_minus =
         q[0] + minmod2(q[-stride] - q[0], alpha * (q[0] - q[stride]));
 
-    const bool limit_q_plus =
-        ((result[1] - q[0]) * (result[1] - q_mp_plus) > epsilon);
-    const bool limit_q_minus =
-        ((result[0] - q[0]) * (result[0] - q_mp_minus) > epsilon);
-
-    if (limit_q_plus or limit_q_minus) {
-      const double dp = q[2 * stride] + q[0] - 2.0 * q[stride];
-      const double dj = q[stride] + q[-stride] - 2.0 * q[0];
-      const double dm = q[0] + q[-2 * stride] - 2.0 * q[-stride];
-      const double dm4_plus = minmod4(4.0 * dj - dp, 4 * dp - dj, dj, dp);
-      const double dm4_minus = minmod4(4.0 * dj - dm, 4 * dm - dj, dj, dm);
-
-      if (limit_q_plus) {
-        const double q_ul = q[0] + alpha * (q[0] - q[-stride]);
-        const double q_md =
-            0.5 * (q[0] + q[stride] - dm4_plus);  // inline q^{AV}
-        const double q_lc =
+    const auto limit_q_plus =
+        ((result[1] - q[0]) * (result[1] - q_mp_plus) > T(epsilon));
+    const auto limit_q_minus =
+        ((result[0] - q[0]) * (result[0] - q_mp_minus) > T(epsilon));
+
+    // The limiters are applied with selects so that several stripes can be
+    // reconstructed at once in SIMD lanes. The limited values are only
+    // computed if at least one lane needs them.
+    if (simd::any(limit_q_plus or limit_q_minus)) {
+      const T dp = q[2 * stride] + q[0] - 2.0 * q[stride];
+      const T dj = q[stride] + q[-stride] - 2.0 * q[0];
+      const T dm = q[0] + q[-2 * stride] - 2.0 * q[-stride];
+      const T dm4_plus = minmod4(4.0 * dj - dp, 4.0 * dp - dj, dj, dp);
+      const T dm4_minus = minmod4(4.0 * dj - dm, 4.0 * dm - dj, dj, dm);
+
+      if (simd::any(limit_q_plus)) {
+        const T q_ul = q[0] + alpha * (q[0] - q[-stride]);
+        const T q_md = 0.5 * (q[0] + q[stride] - dm4_plus);  // inline q^{AV}
+        const T q_lc =
             q[0] + 0.5 * (q[0] - q[-stride]) + 1.3333333333333333 * dm4_minus;
-        const double q_min =
+        const T q_min =
             max(min(q[0], min(q[stride], q_md)), min(q[0], min(q_ul, q_lc)));
-        const double q_max =
+        const T q_max =
             min(max(q[0], max(q[stride], q_md)), max(q[0], max(q_ul, q_lc)));
 
-        result[1] = result[1] + minmod2(q_min - result[1], q_max - result[1]);
+        result[1] = simd::select(
+            limit_q_plus,
+            T(result[1] + minmod2(q_min - result[1], q_max - result[1])),
+            result[1]);
       }
 
-      if (limit_q_minus) {
-        const double q_ul = q[0] + alpha * (q[0] - q[stride]);
-        const double q_md =
-            0.5 * (q[0] + q[-stride] - dm4_minus);  // inline q^{AV}
-        const double q_lc =
+      if (simd::any(limit_q_minus)) {
+        const T q_ul = q[0] + alpha * (q[0] - q[stride]);
+        const T q_md = 0.5 * (q[0] + q[-stride] - dm4_minus);  // inline q^{AV}
+        const T q_lc =
             q[0] + 0.5 * (q[0] - q[stride]) + 1.3333333333333333 * dm4_plus;
-        const double q_min =
+        const T q_min =
             max(min(q[0], min(q[-stride], q_md)), min(q[0], min(q_ul, q_lc)));
-        const double q_max =
+        const T q_max =
             min(max(q[0], max(q[-stride], q_md)), max(q[0], max(q_ul, q_lc)));
 
-        result[0] = result[0] + minmod2(q_min - result[0], q_max - result[0]);
+        result[0] = simd::select(
+            limit_q_minus,
+            T(result[0] + minmod2(q_min - result[0], q_max - result[0])),
+            result[0]);
       }
     }
 
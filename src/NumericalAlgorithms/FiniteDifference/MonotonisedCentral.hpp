@@ -11,7 +11,7 @@
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -24,24 +24,41 @@ class Index;
 namespace fd::reconstruction {
 namespace detail {
 struct MonotonisedCentralReconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride) {
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(const T* const q,
+                                                          const int stride) {
     using std::abs;
 
-    const double a = q[stride] - q[0];
-    const double b = q[0] - q[-stride];
+    const T a = q[stride] - q[0];
+    const T b = q[0] - q[-stride];
 
-    if (sgn(a) != sgn(b)) {
-      return {{q[0], q[0]}};
-    }
-    if (3.0 * abs(a) <= abs(b)) {
-      return {{q[0] - a, q[stride]}};
-    } else if (3.0 * abs(b) <= abs(a)) {
-      return {{q[-stride], q[0] + b}};
-    } else {
-      const double slope = 0.5 * (q[stride] - q[-stride]);
-      return {{q[0] - 0.5 * slope, q[0] + 0.5 * slope}};
-    }
+    // Written with selects instead of branches so that several stripes can be
+    // reconstructed at once in SIMD lanes. `simd::select` evaluates both of
+    // its arguments, so the inputs of each case are zeroed in the lanes that
+    // don't use it to avoid floating-point exceptions from discarded values.
+    const auto same_sign = simd::sign(a) == simd::sign(b);
+    const T a_if_same_sign = simd::select(same_sign, a, T(0.0));
+    const T b_if_same_sign = simd::select(same_sign, b, T(0.0));
+    const auto a_is_small = 3.0 * abs(a_if_same_sign) <= abs(b_if_same_sign);
+    const auto b_is_small =
+        not a_is_small and 3.0 * abs(b_if_same_sign) <= abs(a_if_same_sign);
+    const auto use_slope = not(a_is_small or b_is_small);
+    const T a_if_small = simd::select(a_is_small, a, T(0.0));
+    const T b_if_small = simd::select(b_is_small, b, T(0.0));
+    const T slope = 0.5 * (simd::select(use_slope, q[stride], T(0.0)) -
+                           simd::select(use_slope, q[-stride], T(0.0)));
+    return {{simd::select(
+                 same_sign,
+                 simd::select(a_is_small, T(q[0] - a_if_small),
+                              simd::select(b_is_small, q[-stride],
+                                           T(q[0] - 0.5 * slope))),
+                 q[0]),
+             simd::select(
+                 same_sign,
+                 simd::select(a_is_small, q[stride],
+                              simd::select(b_is_small, T(q[0] + b_if_small),
+                                           T(q[0] + 0.5 * slope))),
+                 q[0])}};
   }
 
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 3; }
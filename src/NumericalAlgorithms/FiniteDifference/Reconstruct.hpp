@@ -68,6 +68,18 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
+ * If the `pointwise` function is a template that can also be called with
+ * `const simd::batch<double>*` (i.e. `template <typename T> static
+ * std::array<T, 2> pointwise(const T* u, int stride, ...)`, using
+ * `simd::select` instead of branches on the data), then `reconstruct`
+ * reconstructs several adjacent stripes at once, one in each SIMD lane, when
+ * SpECTRE is built with xsimd. Since `simd::select` evaluates both of its
+ * arguments, such functions must not raise floating-point exceptions in
+ * lanes whose result is discarded. Stripes left over after the SIMD blocks,
+ * and builds without xsimd, call the same function with `T = double`.
+ * Reconstructors that also return the reconstruction order (e.g. the
+ * positivity-preserving adaptive-order scheme) always use the scalar path.
+ *
  * \note Currently the stride is always one because we transpose the data before
  * reconstruction. However, it may be faster to have a non-unit stride without
  * the transpose. We have the `stride` parameter in the reconstruction schemes
@@ -5,7 +5,13 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -16,9 +22,14 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
+CREATE_IS_CALLABLE(pointwise)
+CREATE_IS_CALLABLE_V(pointwise)
+
 template <size_t Index, size_t DimToReplace, size_t... Is,
           size_t Dim = sizeof...(Is)>
 auto generate_index_for_u_to_reconstruct_impl(
@@ -76,6 +87,118 @@ auto u_to_reconstruct_impl(const DataVector& volume_data,
   }
 }
 
+#ifdef SPECTRE_USE_XSIMD
+// Reconstructs blocks of `simd::size<simd::batch<double>>()` adjacent stripes
+// at once, with one stripe in each SIMD lane. Each block is transposed into a
+// buffer of batches so that the values of all stripes of the block at the
+// same point along the stripe (including the ghost points) form one batch,
+// then `Reconstructor::pointwise` is called with batches and the results are
+// transposed back.
+//
+// The scratch buffers are `thread_local` and only grow, so they are allocated
+// once per thread and reconstructor rather than on every call.
+//
+// Returns the number of stripes that were reconstructed. The remaining
+// stripes, of which there are fewer than the SIMD width, are reconstructed by
+// the scalar loop.
+template <typename Reconstructor, typename... ArgsForReconstructor>
+size_t reconstruct_stripes_simd(
+    const gsl::not_null<gsl::span<double>*> recons_upper,
+    const gsl::not_null<gsl::span<double>*> recons_lower,
+    const gsl::span<const double>& volume_vars,
+    const gsl::span<const double>& lower_ghost_data,
+    const gsl::span<const double>& upper_ghost_data, const size_t stripe_size,
+    const size_t number_of_stripes,
+    const ArgsForReconstructor&... args_for_reconstructor) {
+  using Batch = simd::batch<double>;
+  constexpr size_t width = simd::size<Batch>();
+  constexpr size_t ghost_zone_for_stencil =
+      (Reconstructor::stencil_width() - 1) / 2;
+  constexpr size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
+  if (number_of_stripes < width) {
+    return 0;
+  }
+
+  // The stripe with its ghost points on both sides
+  const size_t extended_stripe_size =
+      stripe_size + 2 * ghost_pts_in_neighbor_data;
+  thread_local std::vector<Batch> q{};
+  // Holds the transposed block of stripes, then the transposed
+  // reconstructed upper and lower values.
+  thread_local std::vector<double> buffer{};
+  if (q.size() < extended_stripe_size) {
+    q.resize(extended_stripe_size);
+  }
+  const size_t buffer_size =
+      width * std::max(extended_stripe_size, 2 * (stripe_size + 1));
+  if (buffer.size() < buffer_size) {
+    buffer.resize(buffer_size);
+  }
+  double* const upper_buffer = buffer.data();
+  double* const lower_buffer = buffer.data() + width * (stripe_size + 1);
+  const auto store_result = [&lower_buffer, &upper_buffer](
+                                const std::array<Batch, 2>& upper_and_lower,
+                                const std::optional<size_t> upper_index,
+                                const std::optional<size_t> lower_index) {
+    if (upper_index.has_value()) {
+      simd::store_unaligned(&upper_buffer[width * upper_index.value()],
+                            upper_and_lower[0]);
+    }
+    if (lower_index.has_value()) {
+      simd::store_unaligned(&lower_buffer[width * lower_index.value()],
+                            upper_and_lower[1]);
+    }
+  };
+
+  size_t first_stripe = 0;
+  for (; first_stripe + width <= number_of_stripes; first_stripe += width) {
+    for (size_t lane = 0; lane < width; ++lane) {
+      const size_t stripe = first_stripe + lane;
+      for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
+        buffer[width * j + lane] =
+            lower_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+        buffer[width * (ghost_pts_in_neighbor_data + stripe_size + j) + lane] =
+            upper_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+      }
+      for (size_t j = 0; j < stripe_size; ++j) {
+        buffer[width * (ghost_pts_in_neighbor_data + j) + lane] =
+            volume_vars[stripe * stripe_size + j];
+      }
+    }
+    for (size_t j = 0; j < extended_stripe_size; ++j) {
+      q[j] = simd::load_unaligned(&buffer[width * j]);
+    }
+
+    // The upper face of the lower neighbor's cell nearest to the boundary
+    store_result(Reconstructor::pointwise(&q[ghost_pts_in_neighbor_data - 1], 1,
+                                          args_for_reconstructor...),
+                 std::nullopt, 0);
+    for (size_t i = 0; i < stripe_size; ++i) {
+      store_result(
+          Reconstructor::pointwise(&q[ghost_pts_in_neighbor_data + i], 1,
+                                   args_for_reconstructor...),
+          i, i + 1);
+    }
+    // The lower face of the upper neighbor's cell nearest to the boundary
+    store_result(Reconstructor::pointwise(
+                     &q[ghost_pts_in_neighbor_data + stripe_size], 1,
+                     args_for_reconstructor...),
+                 stripe_size, std::nullopt);
+
+    for (size_t lane = 0; lane < width; ++lane) {
+      const size_t stripe = first_stripe + lane;
+      for (size_t i = 0; i < stripe_size + 1; ++i) {
+        (*recons_upper)[(stripe_size + 1) * stripe + i] =
+            upper_buffer[width * i + lane];
+        (*recons_lower)[(stripe_size + 1) * stripe + i] =
+            lower_buffer[width * i + lane];
+      }
+    }
+  }
+  return first_stripe;
+}
+#endif  // SPECTRE_USE_XSIMD
+
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
           typename... ArgsForReconstructor>
 void reconstruct_impl(
@@ -113,8 +236,23 @@ void reconstruct_impl(
                << reconstruction_order->size());
   }
 
+  size_t first_scalar_stripe = 0;
+#ifdef SPECTRE_USE_XSIMD
+  // Reconstructors whose `pointwise` function can be called with SIMD batches
+  // reconstruct several stripes at once.
+  if constexpr (is_pointwise_callable_v<Reconstructor,
+                                        const simd::batch<double>*, int,
+                                        const ArgsForReconstructor&...>) {
+    first_scalar_stripe = reconstruct_stripes_simd<Reconstructor>(
+        recons_upper, recons_lower, volume_vars, lower_ghost_data,
+        upper_ghost_data, volume_extents[0], number_of_stripes,
+        args_for_reconstructor...);
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   std::array<double, stencil_width> q{};
-  for (size_t slice = 0; slice < number_of_stripes; ++slice) {
+  for (size_t slice = first_scalar_stripe; slice < number_of_stripes;
+       ++slice) {
     const size_t vars_slice_offset = slice * volume_extents[0];
     const size_t vars_neighbor_slice_offset =
         slice * ghost_pts_in_neighbor_data;
@@ -123,9 +261,7 @@ void reconstruct_impl(
     // right cells for adjusting the correction at the interface. This means
     // we include one neighbor on the upper and lower side.
     recons_order_slice_offset =
-        slice % number_of_stripes_per_variable == 0
-            ? 0
-            : (recons_order_slice_offset + volume_extents[0] + 2);
+        (slice % number_of_stripes_per_variable) * (volume_extents[0] + 2);
     [[maybe_unused]] size_t recons_order_index = 0;
     const auto set_recons_order = [&reconstruction_order, &recons_order_index,
                                    recons_order_slice_offset](
@@ -14,6 +14,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -30,8 +31,9 @@ namespace detail {
 // pointwise reconstruction routine for the original Wcns5z scheme
 template <size_t NonlinearWeightExponent>
 struct Wcns5zWork {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon) {
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double epsilon) {
     ASSERT(epsilon > 0.0,
            "epsilon must be greater than zero but is " << epsilon);
 
@@ -45,7 +47,7 @@ struct Wcns5zWork {
         1.0833333333333333 * square(q[2 * stride] - 2.0 * q[stride] + q[0]) +
             0.25 * square(q[2 * stride] - 4.0 * q[stride] + 3.0 * q[0])};
 
-    const double tau5{abs(beta[2] - beta[0])};
+    const T tau5{abs(beta[2] - beta[0])};
 
     const std::array epsilon_k{
         epsilon * (1.0 + abs(q[0]) + abs(q[-stride]) + abs(q[-2 * stride])),
@@ -65,9 +67,9 @@ struct Wcns5zWork {
                                  5.0 * nw_buffer[2]};
     const std::array alpha_lower{nw_buffer[2], 10.0 * nw_buffer[1],
                                  5.0 * nw_buffer[0]};
-    const double alpha_norm_upper =
+    const T alpha_norm_upper =
         alpha_upper[0] + alpha_upper[1] + alpha_upper[2];
-    const double alpha_norm_lower =
+    const T alpha_norm_lower =
         alpha_lower[0] + alpha_lower[1] + alpha_lower[2];
 
     // reconstruction stencils
@@ -94,28 +96,51 @@ struct Wcns5zWork {
 
 template <size_t NonlinearWeightExponent, class FallbackReconstructor>
 struct Wcns5zReconstructor {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon,
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double epsilon,
       const size_t max_number_of_extrema) {
     // count the number of extrema in the given FD stencil
-    size_t n_extrema{0};
+    T n_extrema(0.0);
     for (int i = -1; i < 2; ++i) {
       // check if q[i * stride] is local maximum
-      n_extrema += (q[i * stride] > q[(i - 1) * stride]) and
-                   (q[i * stride] > q[(i + 1) * stride]);
+      n_extrema += simd::select((q[i * stride] > q[(i - 1) * stride]) and
+                                    (q[i * stride] > q[(i + 1) * stride]),
+                                T(1.0), T(0.0));
       // check if q[i * stride] is local minimum
-      n_extrema += (q[i * stride] < q[(i - 1) * stride]) and
-                   (q[i * stride] < q[(i + 1) * stride]);
+      n_extrema += simd::select((q[i * stride] < q[(i - 1) * stride]) and
+                                    (q[i * stride] < q[(i + 1) * stride]),
+                                T(1.0), T(0.0));
     }
 
     // if `n_extrema` is equal or smaller than a specified number, use the
-    // original Wcns5z reconstruction
-    if (n_extrema < max_number_of_extrema + 1) {
+    // original Wcns5z reconstruction, otherwise use a fallback reconstruction
+    // method. When reconstructing several stripes at once in SIMD lanes both
+    // are computed if the lanes disagree. Each scheme then gets a copy of the
+    // stencil that is zero in the lanes whose result it doesn't provide, so
+    // that discarded lanes can't raise floating-point exceptions.
+    const auto use_wcns5z =
+        n_extrema < T(static_cast<double>(max_number_of_extrema + 1));
+    if (simd::all(use_wcns5z)) {
       return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
-    } else {
-      // otherwise use a fallback reconstruction method
+    } else if (not simd::any(use_wcns5z)) {
       return FallbackReconstructor::pointwise(q, stride);
     }
+    std::array<T, 5> wcns5z_stencil{};
+    std::array<T, 5> fallback_stencil{};
+    for (int i = -2; i < 3; ++i) {
+      const auto index = static_cast<size_t>(i + 2);
+      gsl::at(wcns5z_stencil, index) =
+          simd::select(use_wcns5z, q[i * stride], T(0.0));
+      gsl::at(fallback_stencil, index) =
+          simd::select(use_wcns5z, T(0.0), q[i * stride]);
+    }
+    const auto wcns5z = Wcns5zWork<NonlinearWeightExponent>::pointwise(
+        &gsl::at(wcns5z_stencil, 2), 1, epsilon);
+    const auto fallback =
+        FallbackReconstructor::pointwise(&gsl::at(fallback_stencil, 2), 1);
+    return {{simd::select(use_wcns5z, wcns5z[0], fallback[0]),
+             simd::select(use_wcns5z, wcns5z[1], fallback[1])}};
   }
 
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
@@ -123,8 +148,9 @@ struct Wcns5zReconstructor {
 
 template <size_t NonlinearWeightExponent>
 struct Wcns5zReconstructor<NonlinearWeightExponent, void> {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon,
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double epsilon,
       const size_t /*max_number_of_extrema*/) {
     return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
   }
@@ -27,6 +27,10 @@ class not_null;
  * \ingroup SpectralGroup
  * \brief Compute the modal coefficients from the nodal coefficients
  *
+ * The nodal coefficients may hold several components back to back, i.e. a
+ * size that is a multiple of the number of grid points, which are then all
+ * transformed at once.
+ *
  * \see Spectral::nodal_to_modal_matrix
  */
 template <size_t Dim>
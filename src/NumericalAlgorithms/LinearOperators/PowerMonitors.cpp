@@ -13,6 +13,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -21,9 +22,17 @@ namespace PowerMonitors {
 template <size_t Dim>
 void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
                     const DataVector& u, const Mesh<Dim>& mesh) {
-  // Get modal coefficients
-  const ModalVector modal_coefficients = to_modal_coefficients(u, mesh);
+  power_monitors(result, to_modal_coefficients(u, mesh), mesh);
+}
 
+template <size_t Dim>
+void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh) {
+  ASSERT(modal_coefficients.size() == mesh.number_of_grid_points(),
+         "Expected " << mesh.number_of_grid_points()
+                     << " modal coefficients, but got "
+                     << modal_coefficients.size());
   double slice_sum = 0.0;
   size_t n_slice = 0;
   size_t n_stripe = 0;
@@ -147,6 +156,10 @@ std::array<double, Dim> absolute_truncation_error(
   template void power_monitors(                                         \
       const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
       const DataVector& u, const Mesh<DIM(data)>& mesh);                \
+  template void power_monitors(                                         \
+      const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
+      const ModalVector& modal_coefficients,                            \
+      const Mesh<DIM(data)>& mesh);                                     \
   template std::array<double, DIM(data)> relative_truncation_error(     \
       const DataVector& tensor_component, const Mesh<DIM(data)>& mesh); \
   template std::array<double, DIM(data)> absolute_truncation_error(     \
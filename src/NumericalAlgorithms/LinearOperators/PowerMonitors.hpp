@@ -12,6 +12,7 @@
 
 /// \cond
 class DataVector;
+class ModalVector;
 /// \endcond
 
 /*!
@@ -35,11 +36,18 @@ namespace PowerMonitors {
  * where \f$ C_{k_0,k_1,k_2}\f$ are the modal coefficients
  * of variable \f$ \psi \f$.
  *
+ * The overload taking a `ModalVector` takes the modal coefficients directly,
+ * so the caller can transform into a buffer it reuses.
  */
 template <size_t Dim>
 void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
                     const DataVector& u, const Mesh<Dim>& mesh);
 
+template <size_t Dim>
+void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh);
+
 template <size_t Dim>
 std::array<DataVector, Dim> power_monitors(const DataVector& u,
                                            const Mesh<Dim>& mesh);
@@ -12,6 +12,7 @@
 #include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Transpose.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
@@ -207,6 +208,74 @@ DataVector Spherepack::spec_to_phys_all_offsets(
   return result;
 }
 
+void Spherepack::phys_to_spec_multiple_fields(
+    const gsl::not_null<double*> spectral_coefs,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    phys_to_spec_impl(spectral_coefs, collocation_values, 1, 0, 1, 0, false);
+    return;
+  }
+  // SPHEREPACK batches over interleaved fields (the I1 x S2 layout of the
+  // `*_all_offsets` functions), so transpose into and out of that layout.
+  auto& interleaved_values =
+      memory_pool_.get(physical_size() * number_of_fields);
+  auto& interleaved_coefs =
+      memory_pool_.get(spectral_size() * number_of_fields);
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(spectral_coefs, interleaved_coefs.data(), number_of_fields,
+                spectral_size());
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void Spherepack::spec_to_phys_multiple_fields(
+    const gsl::not_null<double*> collocation_values,
+    const gsl::not_null<const double*> spectral_coefs,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    spec_to_phys_impl(collocation_values, spectral_coefs, 1, 0, 1, 0, false);
+    return;
+  }
+  auto& interleaved_coefs =
+      memory_pool_.get(spectral_size() * number_of_fields);
+  auto& interleaved_values =
+      memory_pool_.get(physical_size() * number_of_fields);
+  raw_transpose(make_not_null(interleaved_coefs.data()), spectral_coefs.get(),
+                spectral_size(), number_of_fields);
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(collocation_values, interleaved_values.data(),
+                number_of_fields, physical_size());
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
+DataVector Spherepack::phys_to_spec_multiple_fields(
+    const DataVector& collocation_values, const size_t number_of_fields) const {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  DataVector result(spectral_size() * number_of_fields);
+  phys_to_spec_multiple_fields(result.data(), collocation_values.data(),
+                               number_of_fields);
+  return result;
+}
+
+DataVector Spherepack::spec_to_phys_multiple_fields(
+    const DataVector& spectral_coefs, const size_t number_of_fields) const {
+  ASSERT(spectral_coefs.size() == spectral_size() * number_of_fields,
+         "Sizes don't match: " << spectral_coefs.size() << " vs "
+                               << spectral_size() * number_of_fields);
+  DataVector result(physical_size() * number_of_fields);
+  spec_to_phys_multiple_fields(result.data(), spectral_coefs.data(),
+                               number_of_fields);
+  return result;
+}
+
 void Spherepack::gradient(const std::array<double*, 2>& df,
                           const gsl::not_null<const double*> collocation_values,
                           const size_t physical_stride,
@@ -231,6 +300,38 @@ void Spherepack::gradient_all_offsets(
   memory_pool_.free(f_k);
 }
 
+void Spherepack::gradient_multiple_fields(
+    const std::array<double*, 2>& df,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    gradient(df, collocation_values, 1, 0);
+    return;
+  }
+  const size_t interleaved_physical_size = physical_size() * number_of_fields;
+  auto& interleaved_values = memory_pool_.get(interleaved_physical_size);
+  auto& f_k = memory_pool_.get(spectral_size() * number_of_fields);
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(f_k.data(), interleaved_values.data(), number_of_fields, 0,
+                    number_of_fields, 0, true);
+  memory_pool_.free(interleaved_values);
+
+  std::array<double*, 2> interleaved_df{};
+  for (size_t i = 0; i < 2; ++i) {
+    gsl::at(interleaved_df, i) =
+        memory_pool_.get(interleaved_physical_size).data();
+  }
+  gradient_from_coefs_impl(interleaved_df, f_k.data(), number_of_fields, 0,
+                           number_of_fields, 0, true);
+  memory_pool_.free(f_k);
+  for (size_t i = 0; i < 2; ++i) {
+    raw_transpose(make_not_null(gsl::at(df, i)), gsl::at(interleaved_df, i),
+                  number_of_fields, physical_size());
+    memory_pool_.free(gsl::at(interleaved_df, i));
+  }
+}
+
 void Spherepack::gradient_from_coefs_impl(
     const std::array<double*, 2>& df,
     const gsl::not_null<const double*> spectral_coefs,
@@ -324,6 +425,17 @@ Spherepack::FirstDeriv Spherepack::gradient_from_coefs_all_offsets(
   return result;
 }
 
+Spherepack::FirstDeriv Spherepack::gradient_multiple_fields(
+    const DataVector& collocation_values, const size_t number_of_fields) const {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  FirstDeriv result(physical_size() * number_of_fields);
+  std::array<double*, 2> temp = {{result.get(0).data(), result.get(1).data()}};
+  gradient_multiple_fields(temp, collocation_values.data(), number_of_fields);
+  return result;
+}
+
 void Spherepack::scalar_laplacian(
     const gsl::not_null<double*> scalar_laplacian,
     const gsl::not_null<const double*> collocation_values,
@@ -387,6 +499,54 @@ DataVector Spherepack::scalar_laplacian_from_coefs(
   return result;
 }
 
+void Spherepack::scalar_laplacian_multiple_fields(
+    const gsl::not_null<double*> scalar_laplacian,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const {
+  if (number_of_fields == 1) {
+    this->scalar_laplacian(scalar_laplacian, collocation_values, 1, 0);
+    return;
+  }
+  const size_t interleaved_physical_size = physical_size() * number_of_fields;
+  auto& interleaved_values = memory_pool_.get(interleaved_physical_size);
+  auto& f_k = memory_pool_.get(spectral_size() * number_of_fields);
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(f_k.data(), interleaved_values.data(), number_of_fields, 0,
+                    number_of_fields, 0, true);
+
+  // The Ylm are eigenfunctions of the Laplacian on the unit sphere, so
+  // multiply the coefficients a(m,l) and b(m,l), each stored with m varying
+  // fastest, by -l(l+1).  This is what slapgs does for a single field.
+  const size_t l1 = m_max_ + 1;
+  const size_t coefs_per_array = l1 * (l_max_ + 1);
+  for (size_t k = 0; k < 2 * coefs_per_array; ++k) {
+    const auto l = static_cast<double>((k % coefs_per_array) / l1);
+    const double factor = -l * (l + 1.0);
+    for (size_t field = 0; field < number_of_fields; ++field) {
+      f_k[k * number_of_fields + field] *= factor;
+    }
+  }
+
+  spec_to_phys_impl(interleaved_values.data(), f_k.data(), number_of_fields, 0,
+                    number_of_fields, 0, true);
+  memory_pool_.free(f_k);
+  raw_transpose(scalar_laplacian, interleaved_values.data(), number_of_fields,
+                physical_size());
+  memory_pool_.free(interleaved_values);
+}
+
+DataVector Spherepack::scalar_laplacian_multiple_fields(
+    const DataVector& collocation_values, const size_t number_of_fields) const {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  DataVector result(physical_size() * number_of_fields);
+  scalar_laplacian_multiple_fields(result.data(), collocation_values.data(),
+                                   number_of_fields);
+  return result;
+}
+
 std::array<DataVector, 2> Spherepack::theta_phi_points() const {
   std::array<DataVector, 2> result = make_array<2>(DataVector(physical_size()));
   const auto& theta = theta_points();
@@ -131,6 +131,15 @@ namespace ylm {
  *   1. storage_, which is filled in the constructor and is always const.
  *   2. memory_pool_, which is dynamic and thread_local, and is overwritten
  *      by various member functions that need temporary storage.
+ *
+ * Because each thread gets its own memory_pool_ and the SPHEREPACK Fortran
+ * routines keep no static state, the const member functions may be called
+ * concurrently from different threads, e.g. to work on the surfaces of
+ * several horizons at once.
+ *
+ * When several functions on the same surface need to be transformed, use
+ * the `*_multiple_fields` member functions, which transform all of them in
+ * one pass rather than calling e.g. `phys_to_spec` once per function.
  */
 class Spherepack {
  public:
@@ -281,6 +290,31 @@ class Spherepack {
                                       size_t stride) const;
   /// @}
 
+  /// @{
+  /// Spectral transformations of `number_of_fields` independent functions
+  /// on this surface in a single pass.
+  ///
+  /// \details The fields are stored one after another, i.e. field `k`
+  /// occupies the `physical_size()` (or `spectral_size()`) consecutive
+  /// values starting at `k * physical_size()` (or `k * spectral_size()`).
+  /// Internally the fields are interleaved and handed to SPHEREPACK
+  /// together, so each Legendre function read from the work arrays is
+  /// applied to every field before moving on, instead of streaming the
+  /// work arrays through the cache once per field.
+  void phys_to_spec_multiple_fields(
+      gsl::not_null<double*> spectral_coefs,
+      gsl::not_null<const double*> collocation_values,
+      size_t number_of_fields) const;
+  void spec_to_phys_multiple_fields(
+      gsl::not_null<double*> collocation_values,
+      gsl::not_null<const double*> spectral_coefs,
+      size_t number_of_fields) const;
+  DataVector phys_to_spec_multiple_fields(const DataVector& collocation_values,
+                                          size_t number_of_fields) const;
+  DataVector spec_to_phys_multiple_fields(const DataVector& spectral_coefs,
+                                          size_t number_of_fields) const;
+  /// @}
+
   /// Computes Pfaffian derivative (df/dtheta, csc(theta) df/dphi) at
   /// the collocation values.
   /// To act on a slice of the input and output arrays, specify stride
@@ -342,6 +376,17 @@ class Spherepack {
                                              size_t stride = 1) const;
   /// @}
 
+  /// @{
+  /// Same as `gradient`, but for `number_of_fields` functions stored one
+  /// after another (see `phys_to_spec_multiple_fields`). The components of
+  /// the result are stored in the same way.
+  void gradient_multiple_fields(const std::array<double*, 2>& df,
+                                gsl::not_null<const double*> collocation_values,
+                                size_t number_of_fields) const;
+  FirstDeriv gradient_multiple_fields(const DataVector& collocation_values,
+                                      size_t number_of_fields) const;
+  /// @}
+
   /// Computes Laplacian in physical space.
   /// To act on a slice of the input and output arrays, specify stride
   /// and offset (assumed to be the same for input and output).
@@ -374,6 +419,17 @@ class Spherepack {
                                          size_t spectral_offset = 0) const;
   /// @}
 
+  /// @{
+  /// Same as `scalar_laplacian`, but for `number_of_fields` functions
+  /// stored one after another (see `phys_to_spec_multiple_fields`).
+  void scalar_laplacian_multiple_fields(
+      gsl::not_null<double*> scalar_laplacian,
+      gsl::not_null<const double*> collocation_values,
+      size_t number_of_fields) const;
+  DataVector scalar_laplacian_multiple_fields(
+      const DataVector& collocation_values, size_t number_of_fields) const;
+  /// @}
+
   /// Computes Pfaffian first and second derivative in physical space.
   /// The first derivative is \f$df(i) = d_i f\f$, and the
   /// second derivative is \f$ddf(i,j) = d_i (d_j f)\f$,
@@ -36,6 +36,7 @@
 #include "Utilities/System/Abort.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 
 /// \cond
 namespace Parallel {
@@ -281,6 +282,7 @@ void DgElementArrayMember<Dim, Metavariables,
         this->halt_algorithm_until_next_phase_) {
       return;
     }
+    this->waiting_for_data_.stop();
     const auto invoke_for_phase = [this](auto phase_dep_v) {
       using PhaseDep = decltype(phase_dep_v);
       constexpr Parallel::Phase phase = PhaseDep::phase;
@@ -382,6 +384,7 @@ bool DgElementArrayMember<Dim, Metavariables,
         tmpl::index_of<phase_dependent_action_lists, PhaseDepActions>::value;
     this->performing_action_ = true;
     ++(this->algorithm_step_);
+    SPECTRE_TRACE_SCOPE(tracing::name<this_action>());
     // While the overhead from using the local entry method to enable
     // profiling is fairly small (<2%), we still avoid it when we aren't
     // tracing.
@@ -453,6 +456,7 @@ bool DgElementArrayMember<Dim, Metavariables,
     case AlgorithmExecution::Continue:
       return true;
     case AlgorithmExecution::Retry:
+      this->waiting_for_data_.start(tracing::waiting_name<ThisAction>());
       return false;
     case AlgorithmExecution::Pause: {
       auto& cache = *Parallel::local_branch(global_cache_proxy_);
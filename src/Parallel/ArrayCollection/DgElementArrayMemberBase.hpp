@@ -15,6 +15,7 @@
 #include "Parallel/Phase.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/Tracing.hpp"
 
 namespace Parallel {
 /*!
@@ -119,6 +120,9 @@ class DgElementArrayMemberBase : PUP::able {
   Parallel::NodeLock inbox_lock_{};
   Parallel::NodeLock element_lock_{};
   bool performing_action_ = false;
+  // Time from an iterable action requesting a retry until the algorithm is
+  // restarted, for tracing. Not serialized.
+  tracing::IdleTimer waiting_for_data_{};
   Parallel::Phase phase_{Parallel::Phase::Initialization};
   std::unordered_map<Parallel::Phase, size_t> phase_bookmarks_{};
   std::size_t algorithm_step_ = 0;
@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/BackgroundCheckpointDrain.hpp"
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel {
+void write_checkpoint_completion_marker(const std::string& checkpoint_dir) {
+  const std::string marker =
+      checkpoint_dir + "/" + checkpoint_completion_marker;
+  std::ofstream marker_file(marker);
+  marker_file << "Checkpoint completed after " << sys::pretty_wall_time()
+              << " of wallclock time\n";
+  marker_file.close();
+  if (not marker_file) {
+    ERROR("Could not write the checkpoint completion marker '" << marker
+                                                               << "'.");
+  }
+}
+
+BackgroundCheckpointDrain::~BackgroundCheckpointDrain() {
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void BackgroundCheckpointDrain::start(std::string staging_dir,
+                                      std::string checkpoint_dir) {
+  wait();
+  staging_dir_ = std::move(staging_dir);
+  checkpoint_dir_ = std::move(checkpoint_dir);
+  error_message_.clear();
+  thread_ = std::thread([this]() {
+    try {
+      namespace fs = std::filesystem;
+      fs::create_directories(checkpoint_dir_);
+      // Every node only holds the files written by its own processors, so
+      // merge them into the (shared) checkpoint directory.
+      fs::copy(staging_dir_, checkpoint_dir_,
+               fs::copy_options::recursive |
+                   fs::copy_options::overwrite_existing);
+      fs::remove_all(staging_dir_);
+    } catch (const std::exception& e) {
+      error_message_ = e.what();
+    }
+  });
+}
+
+void BackgroundCheckpointDrain::wait() {
+  if (not thread_.joinable()) {
+    return;
+  }
+  thread_.join();
+  if (not error_message_.empty()) {
+    ERROR("Failed to move the checkpoint from '"
+          << staging_dir_ << "' to '" << checkpoint_dir_
+          << "': " << error_message_);
+  }
+}
+}  // namespace Parallel
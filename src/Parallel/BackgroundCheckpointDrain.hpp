@@ -0,0 +1,66 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+#include <thread>
+
+namespace Parallel {
+/// \ingroup ParallelGroup
+/// Name of the file that `Parallel::Main` writes into a checkpoint directory
+/// once the checkpoint has been completely written to that directory.
+inline const std::string checkpoint_completion_marker = "CheckpointComplete";
+
+/// \ingroup ParallelGroup
+/// Write the `Parallel::checkpoint_completion_marker` into `checkpoint_dir`.
+void write_checkpoint_completion_marker(const std::string& checkpoint_dir);
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Moves a checkpoint from a staging directory to its final directory
+ * on a background thread.
+ *
+ * \details This is used by `Parallel::Main` to write checkpoints
+ * asynchronously: Charm++ writes the checkpoint into a staging directory in
+ * node-local storage (ideally backed by memory, such as `/dev/shm`), the
+ * simulation continues, and the files are copied to the final checkpoint
+ * directory on a background thread. All files and subdirectories of the
+ * staging directory are merged into the final directory, so the on-disk
+ * layout of the checkpoint is the same as if Charm++ had written it there
+ * directly. The staging directory is removed once it has been copied.
+ *
+ * Only one drain can be in progress at a time. `start()` waits for the
+ * previous drain to finish. `wait()` must be called before the checkpoint is
+ * used, and reports any error that occurred while copying. The destructor
+ * also waits for a drain in progress, but does not report errors.
+ */
+class BackgroundCheckpointDrain {
+ public:
+  BackgroundCheckpointDrain() = default;
+  BackgroundCheckpointDrain(const BackgroundCheckpointDrain&) = delete;
+  BackgroundCheckpointDrain& operator=(const BackgroundCheckpointDrain&) =
+      delete;
+  BackgroundCheckpointDrain(BackgroundCheckpointDrain&&) = delete;
+  BackgroundCheckpointDrain& operator=(BackgroundCheckpointDrain&&) = delete;
+  ~BackgroundCheckpointDrain();
+
+  /// Start copying `staging_dir` to `checkpoint_dir` on a background thread.
+  void start(std::string staging_dir, std::string checkpoint_dir);
+
+  /// Wait for the drain in progress, if any, to finish. It is an error if
+  /// the drain failed.
+  void wait();
+
+  /// Whether a drain was started and has not been waited for.
+  bool is_draining() const { return thread_.joinable(); }
+
+ private:
+  std::thread thread_{};
+  std::string staging_dir_{};
+  std::string checkpoint_dir_{};
+  // Set by the background thread if the drain failed. Only read after the
+  // thread has been joined.
+  std::string error_message_{};
+};
+}  // namespace Parallel
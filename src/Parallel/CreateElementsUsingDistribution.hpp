@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <CkLoopAPI.h>
 #include <array>
 #include <cstddef>
 #include <functional>
@@ -14,17 +15,90 @@
 #include "Domain/Block.hpp"
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
 #include "Parallel/DomainDiagnosticInfo.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "Utilities/Numeric.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 
 namespace Parallel {
+namespace detail {
+template <size_t Dim>
+struct ElementCostsLoopData {
+  const std::vector<ElementId<Dim>>& element_ids;
+  const std::vector<Block<Dim>>& blocks;
+  const std::vector<std::array<size_t, Dim>>& initial_extents;
+  Spectral::Quadrature quadrature;
+  std::vector<double>& costs;
+};
+
+// Computes the costs of the elements `first` to `last` (inclusive). This has
+// the signature of a CkLoop helper function, with `param` pointing to an
+// `ElementCostsLoopData<Dim>`.
+template <size_t Dim>
+void compute_element_costs(const int first, const int last, void* /*result*/,
+                           const int /*param_num*/, void* const param) {
+  const auto& data = *static_cast<const ElementCostsLoopData<Dim>*>(param);
+  for (auto i = static_cast<size_t>(first); i <= static_cast<size_t>(last);
+       ++i) {
+    const ElementId<Dim>& element_id = data.element_ids[i];
+    data.costs[i] = domain::get_num_points_and_grid_spacing_cost(
+        element_id, data.blocks[element_id.block_id()], data.initial_extents,
+        data.quadrature);
+  }
+}
+
+// Same as `domain::get_element_costs`, but the expensive
+// `ElementWeight::NumGridPointsAndGridSpacing` costs are computed by all the
+// cores of this node with CkLoop. The other cores are idle while the elements
+// are created.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, double> get_element_costs(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const domain::ElementWeight element_weight,
+    const Spectral::Quadrature quadrature) {
+  if (element_weight != domain::ElementWeight::NumGridPointsAndGridSpacing) {
+    return domain::get_element_costs(blocks, initial_refinement_levels,
+                                     initial_extents, element_weight,
+                                     quadrature);
+  }
+  const std::vector<ElementId<Dim>> element_ids =
+      initial_element_ids(initial_refinement_levels);
+  std::vector<double> costs(element_ids.size());
+  ElementCostsLoopData<Dim> data{element_ids, blocks, initial_extents,
+                                 quadrature, costs};
+#if CMK_SMP
+  CkLoop_Parallelize(compute_element_costs<Dim>, 1, &data, CkMyNodeSize(), 0,
+                     static_cast<int>(element_ids.size()) - 1);
+#else
+  compute_element_costs<Dim>(0, static_cast<int>(element_ids.size()) - 1,
+                             nullptr, 1, &data);
+#endif  // CMK_SMP
+  std::unordered_map<ElementId<Dim>, double> element_costs{};
+  element_costs.reserve(element_ids.size());
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    element_costs.insert({element_ids[i], costs[i]});
+  }
+  return element_costs;
+}
+}  // namespace detail
+
 /*!
  * \brief Creates elements using a chosen distribution.
  *
  * The `func` is called with `(element_id, target_proc, target_node)` allowing
  * the `func` to insert the element with `element_id` on the target processor
  * and node.
+ *
+ * In SMP builds the element costs are computed by all the cores of the
+ * calling node using CkLoop, since the other cores are idle while the
+ * elements are created. If `print_diagnostics` is `true`, the time spent
+ * computing the costs, distributing the elements and calling `func` is
+ * printed along with the domain diagnostics.
  */
 template <typename F, size_t Dim, typename Metavariables>
 void create_elements_using_distribution(
@@ -39,19 +113,23 @@ void create_elements_using_distribution(
     const size_t num_of_procs_to_use,
     const Parallel::GlobalCache<Metavariables>& local_cache,
     const bool print_diagnostics) {
+  const double start_time = sys::wall_time();
+  double costs_time = start_time;
   // Only need the element distribution if the element weight has a value
   // because then we have to use the space filling curve and not just use round
   // robin.
   domain::BlockZCurveProcDistribution<Dim> element_distribution{};
   if (element_weight.has_value()) {
     const std::unordered_map<ElementId<Dim>, double> element_costs =
-        domain::get_element_costs(blocks, initial_refinement_levels,
+        detail::get_element_costs(blocks, initial_refinement_levels,
                                   initial_extents, element_weight.value(),
                                   quadrature);
+    costs_time = sys::wall_time();
     element_distribution = domain::BlockZCurveProcDistribution<Dim>{
         element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
         initial_extents, procs_to_ignore};
   }
+  const double distribution_time = sys::wall_time();
 
   // Will be used to print domain diagnostic info
   std::vector<size_t> elements_per_core(number_of_procs, 0_st);
@@ -104,10 +182,16 @@ void create_elements_using_distribution(
   }
 
   if (print_diagnostics) {
+    const double creation_time = sys::wall_time();
     Parallel::printf("\n%s\n", domain::diagnostic_info(
                                    blocks.size(), local_cache,
                                    elements_per_core, elements_per_node,
                                    grid_points_per_core, grid_points_per_node));
+    Parallel::printf(
+        "Element creation took %1.3g s: computing element costs %1.3g s, "
+        "distributing elements %1.3g s, creating elements %1.3g s\n\n",
+        creation_time - start_time, costs_time - start_time,
+        distribution_time - costs_time, creation_time - distribution_time);
   }
 }
 }  // namespace Parallel
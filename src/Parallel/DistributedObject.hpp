@@ -60,6 +60,7 @@
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 /// \cond
@@ -443,6 +444,9 @@ class DistributedObject<ParallelComponent,
 
   Parallel::CProxy_GlobalCache<metavariables> global_cache_proxy_;
   bool performing_action_ = false;
+  // Time from an iterable action requesting a retry until the algorithm is
+  // restarted, for tracing. Not serialized.
+  tracing::IdleTimer waiting_for_data_{};
   Parallel::Phase phase_{Parallel::Phase::Initialization};
   std::unordered_map<Parallel::Phase, size_t> phase_bookmarks_{};
   std::size_t algorithm_step_ = 0;
@@ -907,6 +911,7 @@ void DistributedObject<
         halt_algorithm_until_next_phase_) {
       return;
     }
+    waiting_for_data_.stop();
 #ifdef SPECTRE_CHARM_PROJECTIONS
     non_action_time_start_ = sys::wall_time();
 #endif
@@ -1034,6 +1039,7 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
         tmpl::index_of<phase_dependent_action_lists, PhaseDepActions>::value;
     performing_action_ = true;
     ++algorithm_step_;
+    SPECTRE_TRACE_SCOPE(tracing::name<this_action>());
     // While the overhead from using the local entry method to enable
     // profiling is fairly small (<2%), we still avoid it when we aren't
     // tracing.
@@ -1076,6 +1082,7 @@ void DistributedObject<ParallelComponent,
                        tmpl::list<PhaseDepActionListsPack...>>::
     forward_tuple_to_action(std::tuple<Args...>&& args,
                             std::index_sequence<Is...> /*meta*/) {
+  SPECTRE_TRACE_SCOPE(tracing::name<Action>());
   Action::template apply<ParallelComponent>(
       box_, *Parallel::local_branch(global_cache_proxy_),
       static_cast<const array_index&>(array_index_),
@@ -1088,6 +1095,7 @@ void DistributedObject<ParallelComponent,
                        tmpl::list<PhaseDepActionListsPack...>>::
     forward_tuple_to_threaded_action(std::tuple<Args...>&& args,
                                      std::index_sequence<Is...> /*meta*/) {
+  SPECTRE_TRACE_SCOPE(tracing::name<Action>());
   const gsl::not_null<Parallel::NodeLock*> node_lock{&node_lock_};
   if constexpr (Parallel::is_dg_element_collection_v<parallel_component>) {
     Action::template apply<ParallelComponent>(
@@ -1151,6 +1159,7 @@ bool DistributedObject<
     case AlgorithmExecution::Continue:
       return true;
     case AlgorithmExecution::Retry:
+      waiting_for_data_.start(tracing::waiting_name<ThisAction>());
       return false;
     case AlgorithmExecution::Pause:
       terminate_ = true;
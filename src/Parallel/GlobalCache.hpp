@@ -39,7 +39,9 @@
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 #include "Utilities/TypeTraits/CreateGetTypeAliasOrDefault.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/IsA.hpp"
 
 #include "Parallel/GlobalCache.decl.h"
@@ -73,6 +75,8 @@ using type_for_get = typename type_for_get_helper<
     typename get_matching_tag<GlobalCacheTag, Metavariables>::type>::type;
 
 CREATE_GET_TYPE_ALIAS_OR_DEFAULT(component_being_mocked)
+CREATE_IS_CALLABLE(mutation_complete)
+CREATE_IS_CALLABLE_V(mutation_complete)
 
 template <typename... Tags>
 auto make_mutable_cache_tag_storage(tuples::TaggedTuple<Tags...>&& input) {
@@ -324,6 +328,16 @@ class GlobalCache
   /// object named by the GlobalCacheTag (or if that object is a
   /// `std::unique_ptr<T>`, a `gsl::not_null<T*>`), and takes the contents of
   /// `args` as subsequent arguments.
+  ///
+  /// The entry method is expedited, i.e. it is run as soon as it arrives on a
+  /// node rather than after the messages already queued there, and the time
+  /// spent applying the mutation and invoking the callbacks is traced as the
+  /// event `tracing::name<Function>()` (see `tracing`).
+  ///
+  /// If `Function` also has a static function `mutation_complete()` that
+  /// takes the contents of `args`, it is called on each node once the
+  /// callbacks have been invoked, e.g. to trace when the mutation has
+  /// reached that node.
   template <typename GlobalCacheTag, typename Function, typename... Args>
   void mutate(const std::tuple<Args...>& args);
 
@@ -551,6 +565,7 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
       Metavariables, GlobalCacheTag, Function, Args...>::registrar;
   using tag = MutableCacheTag<GlobalCache_detail::get_matching_mutable_tag<
       GlobalCacheTag, Metavariables>>;
+  SPECTRE_TRACE_SCOPE(tracing::name<Function>());
 
   // Do the mutate.
   std::apply(
@@ -596,6 +611,15 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
     (void)array_component_id;
     callback->invoke();
   }
+
+  if constexpr (GlobalCache_detail::is_mutation_complete_callable_v<
+                    Function, const Args&...>) {
+    std::apply(
+        [](const auto&... local_args) {
+          Function::mutation_complete(local_args...);
+        },
+        args);
+  }
 }
 
 #if defined(__GNUC__) && !defined(__clang__)
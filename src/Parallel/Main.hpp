@@ -7,20 +7,24 @@
 #pragma once
 
 #include <array>
+#include <CkLoopAPI.h>
 #include <boost/program_options.hpp>
 #include <charm++.h>
 #include <initializer_list>
+#include <optional>
 #include <pup.h>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "Informer/InfoFromBuild.hpp"
 #include "Informer/Informer.hpp"
 #include "Options/ParseOptions.hpp"
 #include "Options/Tags.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/BackgroundCheckpointDrain.hpp"
 #include "Parallel/CharmRegistration.hpp"
 #include "Parallel/CreateFromOptions.hpp"
 #include "Parallel/ExitCode.hpp"
@@ -37,6 +41,7 @@
 #include "Parallel/ResourceInfo.hpp"
 #include "Parallel/Tags/ResourceInfo.hpp"
 #include "Parallel/TypeTraits.hpp"
+#include "Parallel/WriteTracingData.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/Formaline.hpp"
@@ -47,6 +52,7 @@
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/Tracing.hpp"
 #include "Utilities/TypeTraits/CreateGetTypeAliasOrDefault.hpp"
 #include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
@@ -56,6 +62,8 @@ namespace Parallel {
 namespace detail {
 CREATE_IS_CALLABLE(run_deadlock_analysis_simple_actions)
 CREATE_IS_CALLABLE_V(run_deadlock_analysis_simple_actions)
+CREATE_IS_CALLABLE(execute_before_phase_change)
+CREATE_IS_CALLABLE_V(execute_before_phase_change)
 }  // namespace detail
 
 /// \ingroup ParallelGroup
@@ -111,8 +119,38 @@ class Main : public CBase_Main<Metavariables> {
   ///
   /// \details This call is wrapped within an entry method so that it may be
   /// used as the callback after a quiescence detection.
+  ///
+  /// If the executable was started with `--checkpoint-staging-dir`, Charm++
+  /// writes the checkpoint into a subdirectory of the staging directory on
+  /// every node instead, and the nodes move it to the checkpoint directory in
+  /// the background while the simulation continues (see
+  /// `Parallel::BackgroundCheckpointDrain`). The staging directory must be in
+  /// node-local storage, ideally backed by memory such as `/dev/shm`.
+  ///
+  /// Once a checkpoint directory holds the complete checkpoint, the file
+  /// `Parallel::checkpoint_completion_marker` is written into it. For staged
+  /// checkpoints this happens once all nodes have finished moving it, which
+  /// is checked before the next checkpoint is written and before exiting.
   void start_write_checkpoint();
 
+  /// Write a checkpoint into the staging directory once all nodes have
+  /// created it. Used as a callback.
+  void write_staged_checkpoint();
+
+  /// Write the completion marker, or start moving a staged checkpoint to the
+  /// checkpoint directory, and continue with the next phase. Used as the
+  /// callback of the Charm++ checkpoint, so it is also invoked when
+  /// restarting from the checkpoint.
+  void checkpoint_written();
+
+  /// Write the completion marker of the last staged checkpoint and finish
+  /// exiting. Used as a callback.
+  void checkpoints_drained();
+
+  /// Finish exiting once all nodes have written their tracing data. Used as a
+  /// callback.
+  void tracing_data_written();
+
   /// Reduction target for data used in phase change decisions.
   ///
   /// It is required that the `Parallel::ReductionData` holds a single
@@ -156,6 +194,16 @@ class Main : public CBase_Main<Metavariables> {
   // Check if future checkpoint dirs are available; error if any already exist.
   void check_future_checkpoint_dirs_available() const;
 
+  // Write the tracing data if tracing is enabled, then check that all
+  // components terminated correctly
+  void finish_exit();
+
+  // Call the static `execute_before_phase_change` member function of every
+  // component that has one. Unlike `execute_next_phase`, this is called
+  // synchronously on this processor for all components before any of them
+  // start the next phase, including before exiting.
+  void execute_before_phase_change();
+
   // Starts a reduction on the component specified by
   // the current_termination_check_index_ member variable, then increment
   // current_termination_check_index_
@@ -198,6 +246,8 @@ class Main : public CBase_Main<Metavariables> {
   Parallel::Phase current_phase_{Parallel::Phase::Initialization};
   CProxy_GlobalCache<Metavariables> global_cache_proxy_;
   detail::CProxy_AtSyncIndicator<Metavariables> at_sync_indicator_proxy_;
+  detail::CProxy_CheckpointDrainer<Metavariables> checkpoint_drainer_proxy_;
+  detail::CProxy_TraceWriter<Metavariables> trace_writer_proxy_;
   // This is only used during startup, and will be cleared after all
   // the chares are created.  It is a member variable because passing
   // local state through charm callbacks is painful.
@@ -207,6 +257,17 @@ class Main : public CBase_Main<Metavariables> {
   tuples::tagged_tuple_from_typelist<phase_change_tags_and_combines_list>
       phase_change_decision_data_;
   size_t checkpoint_dir_counter_ = 0_st;
+  // Empty if checkpoints are written directly to the checkpoint directory. Not
+  // serialized, see `pup`.
+  std::string checkpoint_staging_dir_{};
+  // The checkpoint directory that Charm++ is currently writing to, and the
+  // staged checkpoint directory that the nodes are moving data to. These are
+  // not serialized so that restarting from a checkpoint does not finish
+  // writing it again.
+  std::string checkpoint_dir_being_written_{};
+  std::string checkpoint_dir_being_drained_{};
+  // Empty if tracing is disabled. Not serialized, see `pup`.
+  std::string trace_file_prefix_{};
   Parallel::ResourceInfo<Metavariables> resource_info_{};
   // All exception errors we've received so far.
   std::vector<std::string> exception_messages_{};
@@ -214,10 +275,70 @@ class Main : public CBase_Main<Metavariables> {
   // successfully terminated.
   size_t current_termination_check_index_{0};
   std::vector<std::string> components_that_did_not_terminate_{};
+  // Wall times used to report how long the startup takes. These are not
+  // serialized because the startup is over before the first checkpoint.
+  double global_cache_start_time_{0.0};
+  double initialization_start_time_{0.0};
 };
 
 namespace detail {
 
+// The value of the command-line option `--name VALUE` or `--name=VALUE`, if
+// it was passed. Charm++ doesn't send the `CkArgMsg` when restarting from a
+// checkpoint, so options that only apply to the current run of the
+// executable are re-read from the restart command line with this.
+inline std::optional<std::string> command_line_option(const std::string& name) {
+  const std::string flag = "--" + name;
+  char** const argv = CkGetArgv();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (int i = 1; argv[i] != nullptr; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::string arg = argv[i];
+    if (arg == flag) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if (argv[i + 1] == nullptr) {
+        ERROR_NO_TRACE("The command-line option " << flag
+                                                  << " requires a value.");
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return std::string{argv[i + 1]};
+    }
+    if (arg.rfind(flag + "=", 0) == 0) {
+      return arg.substr(flag.size() + 1);
+    }
+  }
+  return std::nullopt;
+}
+
+// Whether the command-line flag `--name` was passed, see
+// `command_line_option`.
+inline bool has_command_line_flag(const std::string& name) {
+  const std::string flag = "--" + name;
+  char** const argv = CkGetArgv();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (int i = 1; argv[i] != nullptr; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (argv[i] == flag) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// The `--trace-file-prefix` passed when restarting from a checkpoint, or
+// empty if tracing is disabled in the restarted run.
+inline std::string restart_trace_file_prefix() {
+  std::optional<std::string> prefix = command_line_option("trace-file-prefix");
+#ifndef SPECTRE_TRACING
+  if (prefix.has_value()) {
+    ERROR_NO_TRACE(
+        "Cannot trace the executable because it was built without tracing. "
+        "Reconfigure with -D ENABLE_TRACING=ON.");
+  }
+#endif  // SPECTRE_TRACING
+  return std::move(prefix).value_or("");
+}
+
 // Charm++ AtSync effectively requires an additional global sync to the
 // quiescence detection we do for switching phases. However, AtSync only needs
 // to be called for one array to trigger the sync-based load balancing, so the
@@ -272,6 +393,105 @@ template <typename Metavariables>
 void AtSyncIndicator<Metavariables>::ResumeFromSync() {
   main_proxy_.execute_next_phase();
 }
+
+// CheckpointDrainer has one branch per node that moves staged checkpoints
+// written by the processors of that node from the node-local staging
+// directory to the checkpoint directory on a background thread. It is
+// constructed by the `Main` chare and only used if checkpoints are staged.
+template <typename Metavariables>
+class CheckpointDrainer : public CBase_CheckpointDrainer<Metavariables> {
+ public:
+  CheckpointDrainer() = default;
+  CheckpointDrainer(const CheckpointDrainer&) = delete;
+  CheckpointDrainer& operator=(const CheckpointDrainer&) = delete;
+  CheckpointDrainer(CheckpointDrainer&&) = delete;
+  CheckpointDrainer& operator=(CheckpointDrainer&&) = delete;
+  ~CheckpointDrainer() override {
+    (void)Parallel::charmxx::RegisterChare<
+        CheckpointDrainer<Metavariables>,
+        CkIndex_CheckpointDrainer<Metavariables>>::registrar;
+  }
+
+  explicit CheckpointDrainer(CkMigrateMessage* msg)
+      : CBase_CheckpointDrainer<Metavariables>(msg) {}
+
+  // Nothing to serialize: no checkpoint is being drained while a checkpoint
+  // is written.
+  void pup(PUP::er& /*p*/) override {}
+
+  // Wait for the previous drain and create `staging_dir`, then contribute to
+  // `callback`.
+  void prepare(const std::string& staging_dir, const CkCallback& callback) {
+    drain_.wait();
+    file_system::create_directory(staging_dir);
+    this->contribute(callback);
+  }
+
+  void drain(const std::string& staging_dir,
+             const std::string& checkpoint_dir) {
+    drain_.start(staging_dir, checkpoint_dir);
+  }
+
+  // Wait for the current drain, then contribute to `callback`.
+  void wait(const CkCallback& callback) {
+    drain_.wait();
+    this->contribute(callback);
+  }
+
+ private:
+  Parallel::BackgroundCheckpointDrain drain_{};
+};
+
+// TraceWriter has one branch per node that enables the tracing (see
+// `tracing`) on that node and writes the recorded data when exiting. It is
+// constructed by the `Main` chare, and does nothing if `file_prefix` is
+// empty.
+template <typename Metavariables>
+class TraceWriter : public CBase_TraceWriter<Metavariables> {
+ public:
+  TraceWriter(std::string file_prefix, const bool write_chrome_trace)
+      : file_prefix_(std::move(file_prefix)),
+        write_chrome_trace_(write_chrome_trace) {
+    tracing::set_enabled(not file_prefix_.empty());
+  }
+  TraceWriter(const TraceWriter&) = delete;
+  TraceWriter& operator=(const TraceWriter&) = delete;
+  TraceWriter(TraceWriter&&) = delete;
+  TraceWriter& operator=(TraceWriter&&) = delete;
+  ~TraceWriter() override {
+    (void)Parallel::charmxx::RegisterChare<
+        TraceWriter<Metavariables>,
+        CkIndex_TraceWriter<Metavariables>>::registrar;
+  }
+
+  explicit TraceWriter(CkMigrateMessage* msg)
+      : CBase_TraceWriter<Metavariables>(msg) {}
+
+  // Tracing is configured separately for each run of the executable, so
+  // nothing is serialized and the restart command line is read instead.
+  void pup(PUP::er& p) override {
+    if (p.isUnpacking()) {
+      file_prefix_ = restart_trace_file_prefix();
+      write_chrome_trace_ = has_command_line_flag("chrome-trace");
+      tracing::set_enabled(not file_prefix_.empty());
+    }
+  }
+
+  // Write the tracing data of this node, then contribute to `callback`.
+  void write(const CkCallback& callback) {
+    if (not file_prefix_.empty()) {
+      tracing::set_enabled(false);
+      Parallel::write_tracing_data(file_prefix_,
+                                   static_cast<size_t>(sys::my_node()),
+                                   write_chrome_trace_);
+    }
+    this->contribute(callback);
+  }
+
+ private:
+  std::string file_prefix_{};
+  bool write_chrome_trace_ = false;
+};
 }  // namespace detail
 
 // ================================================================
@@ -283,6 +503,7 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
   /// \todo detail::register_events_to_trace();
 
   namespace bpo = boost::program_options;
+  bool write_chrome_trace = false;
   try {
     bpo::options_description command_line_options;
     // disable clang-format because it combines the repeated call operator
@@ -307,6 +528,20 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
         ("copyright-and-licenses",
          "Returns all of the copyright and license info for SpECTRE and "
          "its dependencies.")
+        ("checkpoint-staging-dir", bpo::value<std::string>(),
+         "Write checkpoints into this node-local directory (e.g. in /dev/shm) "
+         "and move them to the checkpoint directory in the background while "
+         "the simulation continues. Not stored in the checkpoints, so pass it "
+         "again when restarting.")
+        ("trace-file-prefix", bpo::value<std::string>(),
+         "Record the wall time spent in actions and other traced code, and "
+         "waiting for data, and write a summary per node to the H5 file with "
+         "this prefix followed by the node number when exiting. Requires "
+         "building with ENABLE_TRACING. Not stored in the checkpoints, so "
+         "pass it again when restarting to trace the restarted run.")
+        ("chrome-trace",
+         "With --trace-file-prefix, also write the most recent events of "
+         "every node in the Chrome trace format (JSON).")
         ;
     // clang-format on
 
@@ -450,6 +685,24 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
       sys::exit();
     }
 
+    if (parsed_command_line_options.count("checkpoint-staging-dir") != 0) {
+      checkpoint_staging_dir_ =
+          parsed_command_line_options["checkpoint-staging-dir"]
+              .as<std::string>();
+    }
+
+    if (parsed_command_line_options.count("trace-file-prefix") != 0) {
+#ifdef SPECTRE_TRACING
+      trace_file_prefix_ =
+          parsed_command_line_options["trace-file-prefix"].as<std::string>();
+#else
+      ERROR(
+          "Cannot trace the executable because it was built without tracing. "
+          "Reconfigure with -D ENABLE_TRACING=ON.");
+#endif  // SPECTRE_TRACING
+    }
+    write_chrome_trace = parsed_command_line_options.count("chrome-trace") != 0;
+
     options_ =
         options.template apply<option_list, Metavariables>([](auto... args) {
           return tuples::tagged_tuple_from_typelist<option_list>(
@@ -467,12 +720,27 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
 
   check_future_checkpoint_dirs_available();
 
-  global_cache_proxy_ = CProxy_GlobalCache<Metavariables>::ckNew(
-      Parallel::create_from_options<Metavariables>(options_,
-                                                   const_global_cache_tags{}),
+#if CMK_SMP
+  // Lets the cores of a node share a loop, which is used to compute the
+  // element costs when the elements are created.
+  CkLoop_Init(-1);
+#endif  // CMK_SMP
+
+  // The const items include the Domain, which is created here from the
+  // DomainCreator.
+  const double global_cache_items_start_time = sys::wall_time();
+  auto const_global_cache_items = Parallel::create_from_options<Metavariables>(
+      options_, const_global_cache_tags{});
+  auto mutable_global_cache_items =
       Parallel::create_from_options<Metavariables>(options_,
-                                                   mutable_global_cache_tags{}),
-      this->thisProxy);
+                                                   mutable_global_cache_tags{});
+  global_cache_start_time_ = sys::wall_time();
+  Parallel::printf(
+      "Creating the GlobalCache items (including the Domain) took %1.3g s\n",
+      global_cache_start_time_ - global_cache_items_start_time);
+  global_cache_proxy_ = CProxy_GlobalCache<Metavariables>::ckNew(
+      std::move(const_global_cache_items),
+      std::move(mutable_global_cache_items), this->thisProxy);
 
   // Now that the GlobalCache has been built, create the singleton map which
   // will be used to allocate all the singletons. We need to be careful here
@@ -501,6 +769,10 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
       detail::CProxy_AtSyncIndicator<Metavariables>::ckNew();
   at_sync_indicator_proxy_[0].insert(this->thisProxy, sys::my_proc());
   at_sync_indicator_proxy_.doneInserting();
+  checkpoint_drainer_proxy_ =
+      detail::CProxy_CheckpointDrainer<Metavariables>::ckNew();
+  trace_writer_proxy_ = detail::CProxy_TraceWriter<Metavariables>::ckNew(
+      trace_file_prefix_, write_chrome_trace);
 
   using parallel_component_tag_list = tmpl::transform<
       component_list,
@@ -611,6 +883,8 @@ void Main<Metavariables>::pup(PUP::er& p) {  // NOLINT
   p | current_phase_;
   p | global_cache_proxy_;
   p | at_sync_indicator_proxy_;
+  p | checkpoint_drainer_proxy_;
+  p | trace_writer_proxy_;
   // Note: we do NOT serialize the options.
   // This is because options are only used in the initialization phase when
   // the executable first starts up. Thereafter, the information from the
@@ -619,6 +893,16 @@ void Main<Metavariables>::pup(PUP::er& p) {  // NOLINT
   p | phase_change_decision_data_;
 
   p | checkpoint_dir_counter_;
+  // The staging directory is node-local storage of the current run, so it is
+  // taken from the restart command line rather than from the checkpoint.
+  if (p.isUnpacking()) {
+    checkpoint_staging_dir_ =
+        detail::command_line_option("checkpoint-staging-dir").value_or("");
+  }
+  // Like the staging directory, tracing applies to the current run only.
+  if (p.isUnpacking()) {
+    trace_file_prefix_ = detail::restart_trace_file_prefix();
+  }
   p | resource_info_;
   p | exception_messages_;
   p | current_termination_check_index_;
@@ -661,6 +945,11 @@ void Main<Metavariables>::
   if (current_phase_ != Parallel::Phase::Initialization) {
     ERROR("Must be in the Initialization phase.");
   }
+  initialization_start_time_ = sys::wall_time();
+  Parallel::printf(
+      "Sending the GlobalCache and the parallel components to all nodes took "
+      "%1.3g s\n",
+      initialization_start_time_ - global_cache_start_time_);
   // Since singletons are actually single-element Charm++ arrays, we have to
   // allocate them here along with the other Charm++ arrays.
   tmpl::for_each<singleton_component_list>([this](auto singleton_component_v) {
@@ -690,6 +979,8 @@ void Main<Metavariables>::
             options_, typename parallel_component::array_allocation_tags{}),
         resource_info_.procs_to_ignore());
   });
+  Parallel::printf("Allocating the array components took %1.3g s\n",
+                   sys::wall_time() - initialization_start_time_);
 
   // Free any resources from the initial option parsing.
   options_ = decltype(options_){};
@@ -706,6 +997,10 @@ void Main<Metavariables>::
 
 template <typename Metavariables>
 void Main<Metavariables>::execute_next_phase() {
+  if (current_phase_ == Parallel::Phase::Initialization) {
+    Parallel::printf("Initialization phase took %1.3g s\n",
+                     sys::wall_time() - initialization_start_time_);
+  }
   if (not exception_messages_.empty()) {
     // Print exceptions whether we errored during execution or cleanup
     Parallel::printf(
@@ -745,6 +1040,7 @@ void Main<Metavariables>::execute_next_phase() {
     }
 
     if (current_phase_ == Parallel::Phase::PostFailureCleanup) {
+      execute_before_phase_change();
       Parallel::printf("PostFailureCleanup phase complete. Aborting.\n");
       Informer::print_exit_info();
       sys::abort("");
@@ -783,8 +1079,14 @@ void Main<Metavariables>::execute_next_phase() {
     }
   }
 
+  execute_before_phase_change();
   if (Parallel::Phase::Exit == current_phase_) {
-    check_if_component_terminated_correctly();
+    if (not checkpoint_dir_being_drained_.empty()) {
+      checkpoint_drainer_proxy_.wait(CkCallback(
+          CkIndex_Main<Metavariables>::checkpoints_drained(), this->thisProxy));
+      return;
+    }
+    finish_exit();
     return;
   }
   tmpl::for_each<component_list>([this](auto parallel_component) {
@@ -835,12 +1137,66 @@ void Main<Metavariables>::start_write_checkpoint() {
   if (not file_system::check_if_dir_exists(checkpoints_dir)) {
     checkpoint_dir_counter_ = 0;
   }
-  const std::string dir = next_checkpoint_dir();
+  checkpoint_dir_being_written_ = next_checkpoint_dir();
   checkpoint_dir_counter_++;
-  file_system::create_directory(dir);
+  if (checkpoint_staging_dir_.empty()) {
+    file_system::create_directory(checkpoint_dir_being_written_);
+    CkStartCheckpoint(
+        checkpoint_dir_being_written_.c_str(),
+        CkCallback(CkIndex_Main<Metavariables>::checkpoint_written(),
+                   this->thisProxy));
+    return;
+  }
+  // All nodes must have finished moving the previous checkpoint before the
+  // staging directory can be reused.
+  checkpoint_drainer_proxy_.prepare(
+      checkpoint_staging_dir_ + "/" + checkpoint_dir_being_written_,
+      CkCallback(CkIndex_Main<Metavariables>::write_staged_checkpoint(),
+                 this->thisProxy));
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::write_staged_checkpoint() {
+  if (not checkpoint_dir_being_drained_.empty()) {
+    write_checkpoint_completion_marker(checkpoint_dir_being_drained_);
+    checkpoint_dir_being_drained_.clear();
+  }
+  const std::string staging_dir =
+      checkpoint_staging_dir_ + "/" + checkpoint_dir_being_written_;
   CkStartCheckpoint(
-      dir.c_str(), CkCallback(CkIndex_Main<Metavariables>::execute_next_phase(),
-                              this->thisProxy));
+      staging_dir.c_str(),
+      CkCallback(CkIndex_Main<Metavariables>::checkpoint_written(),
+                 this->thisProxy));
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::checkpoint_written() {
+  // The checkpoint directory is empty when restarting from the checkpoint.
+  if (not checkpoint_dir_being_written_.empty()) {
+    if (checkpoint_staging_dir_.empty()) {
+      write_checkpoint_completion_marker(checkpoint_dir_being_written_);
+    } else {
+      checkpoint_drainer_proxy_.drain(
+          checkpoint_staging_dir_ + "/" + checkpoint_dir_being_written_,
+          checkpoint_dir_being_written_);
+      checkpoint_dir_being_drained_ = checkpoint_dir_being_written_;
+    }
+    checkpoint_dir_being_written_.clear();
+  }
+  execute_next_phase();
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::checkpoints_drained() {
+  write_checkpoint_completion_marker(checkpoint_dir_being_drained_);
+  checkpoint_dir_being_drained_.clear();
+  finish_exit();
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::tracing_data_written() {
+  Parallel::printf("Wrote tracing data to '%s*'\n", trace_file_prefix_);
+  check_if_component_terminated_correctly();
 }
 
 template <typename Metavariables>
@@ -928,6 +1284,29 @@ void Main<Metavariables>::did_all_elements_terminate(
   check_if_component_terminated_correctly();
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::execute_before_phase_change() {
+  tmpl::for_each<component_list>([this](auto parallel_component) {
+    using component = tmpl::type_from<decltype(parallel_component)>;
+    if constexpr (detail::is_execute_before_phase_change_callable_v<
+                      component, const Parallel::Phase,
+                      CProxy_GlobalCache<Metavariables>&>) {
+      component::execute_before_phase_change(current_phase_,
+                                             global_cache_proxy_);
+    }
+  });
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::finish_exit() {
+  if (not trace_file_prefix_.empty()) {
+    trace_writer_proxy_.write(CkCallback(
+        CkIndex_Main<Metavariables>::tracing_data_written(), this->thisProxy));
+    return;
+  }
+  check_if_component_terminated_correctly();
+}
+
 template <typename Metavariables>
 void Main<Metavariables>::check_if_component_terminated_correctly() {
   auto* global_cache = Parallel::local_branch(global_cache_proxy_);
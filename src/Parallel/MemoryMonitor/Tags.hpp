@@ -20,6 +20,15 @@ std::string subfile_name() {
   return "/MemoryMonitors/" + pretty_type::name<ParallelComponent>();
 }
 
+/*!
+ * Gives full subfile path to the dat file for the per-item memory breakdown of
+ * an Array parallel component
+ */
+template <typename ParallelComponent>
+std::string items_subfile_name() {
+  return "/MemoryMonitors/" + pretty_type::name<ParallelComponent>() + "Items";
+}
+
 namespace Tags {
 /*!
  * \brief Tag to hold memory usage of parallel components before it is written
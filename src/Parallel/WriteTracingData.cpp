@@ -0,0 +1,50 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/WriteTracingData.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Tracing.hpp"
+
+namespace Parallel {
+void write_tracing_data(const std::string& file_prefix, const size_t node,
+                        const bool write_chrome_trace) {
+  const std::string file_name = file_prefix + std::to_string(node);
+  const std::vector<tracing::Summary> summary = tracing::summary();
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_name + ".h5", true);
+    const std::vector<std::string> legend{"Thread", "Count", "TotalTime",
+                                          "MinTime", "MaxTime"};
+    // The summary is ordered by name, so all threads of a name are adjacent
+    for (auto it = summary.begin(); it != summary.end();) {
+      std::string subfile_name = it->name;
+      std::replace(subfile_name.begin(), subfile_name.end(), '/', '_');
+      auto& dat_file = h5file.try_insert<h5::Dat>("/Tracing/" + subfile_name,
+                                                  legend, 0);
+      const std::string& name = it->name;
+      for (; it != summary.end() and it->name == name; ++it) {
+        dat_file.append(std::vector<double>{
+            static_cast<double>(it->thread), static_cast<double>(it->count),
+            it->total_seconds, it->min_seconds, it->max_seconds});
+      }
+      h5file.close_current_object();
+    }
+  }
+  if (write_chrome_trace) {
+    std::ofstream trace_file(file_name + ".json");
+    if (not trace_file.is_open()) {
+      ERROR("Could not open the trace file '" << file_name << ".json'");
+    }
+    tracing::write_chrome_trace(trace_file, node);
+  }
+}
+}  // namespace Parallel
@@ -0,0 +1,27 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief Write the `tracing::summary` of this process to the file
+ * `file_prefix` followed by the `node` and `.h5`, and optionally the Chrome
+ * trace (see `tracing::write_chrome_trace`) to the same name ending in
+ * `.json`.
+ *
+ * \details Each traced name is written to the `h5::Dat` subfile
+ * `/Tracing/NAME` with one row per thread of the process that recorded the
+ * name, holding the number of events and their total, minimum, and maximum
+ * wall time in seconds. Any `/` in the name is replaced by `_`.
+ *
+ * Used by `Parallel::Main` when exiting. Must not be called while events are
+ * recorded.
+ */
+void write_tracing_data(const std::string& file_prefix, size_t node,
+                        bool write_chrome_trace);
+}  // namespace Parallel
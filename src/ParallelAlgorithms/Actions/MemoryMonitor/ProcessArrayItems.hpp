@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace mem_monitor {
+/// Functor for reducing the maps of item sizes contributed by each element of
+/// an Array by adding the sizes of items with the same name.
+struct AddItemSizes {
+  std::map<std::string, size_t> operator()(
+      std::map<std::string, size_t> map_1,
+      const std::map<std::string, size_t>& map_2) const {
+    for (const auto& [name, size] : map_2) {
+      map_1[name] += size;
+    }
+    return map_1;
+  }
+};
+
+/*!
+ * \brief The size in bytes of each item in `box` (simple and compute tags,
+ * excluding reference items) and of each inbox in `inboxes`.
+ *
+ * \details Inboxes are named `Inbox(TagName)`. Compute items that have not been
+ * evaluated have the size of a default-constructed object.
+ */
+template <typename DbTags, typename... InboxTags>
+std::map<std::string, size_t> size_of_items(
+    const db::DataBox<DbTags>& box,
+    const tuples::TaggedTuple<InboxTags...>& inboxes) {
+  std::map<std::string, size_t> result = box.size_of_items();
+  [[maybe_unused]] const auto add_inbox_size = [&result,
+                                                &inboxes](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    result["Inbox(" + pretty_type::get_name<tag>() + ")"] =
+        size_of_object_in_bytes(tuples::get<tag>(inboxes));
+  };
+  (add_inbox_size(tmpl::type_<InboxTags>{}), ...);
+  return result;
+}
+
+/*!
+ * \brief Simple action meant to be used as a callback for
+ * Parallel::contribute_to_reduction that writes the memory used by each
+ * DataBox item and inbox of an Array parallel component, summed over all
+ * elements, to disk.
+ *
+ * \details The columns in the dat file are
+ *
+ * - %Time
+ * - One column per DataBox item and inbox, in MB
+ * - Total (MB)
+ *
+ * The dat file will be placed in the `/MemoryMonitors/` group in the reduction
+ * file. The name of the dat file is the `pretty_type::name` of the component
+ * followed by `Items`.
+ */
+template <typename ArrayComponent>
+struct ProcessArrayItems {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const std::map<std::string, size_t>& item_sizes) {
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+
+    std::vector<std::string> legend{{"Time"}};
+    legend.reserve(item_sizes.size() + 2);
+    std::vector<double> sizes{};
+    sizes.reserve(item_sizes.size());
+    double total_size = 0.0;
+    for (const auto& [name, size_in_bytes] : item_sizes) {
+      legend.emplace_back(name + " (MB)");
+      sizes.push_back(static_cast<double>(size_in_bytes) / 1.0e6);
+      total_size += sizes.back();
+    }
+    legend.emplace_back("Total (MB)");
+
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRow>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0], items_subfile_name<ArrayComponent>(), legend,
+        std::make_tuple(time, sizes, total_size));
+  }
+};
+}  // namespace mem_monitor
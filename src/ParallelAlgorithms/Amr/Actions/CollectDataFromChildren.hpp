@@ -21,6 +21,7 @@
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeParent.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -31,10 +32,11 @@ struct CollectDataFromChildren {
   /// \brief  This function should be called after the parent element has been
   /// created by amr::Actions::CreateParent.
   ///
-  /// \details This function sends a copy of all items corresponding to the
+  /// \details This function sends all items corresponding to the
   /// mutable_item_creation_tags of `box` of `child_id` to the first sibling in
   /// `sibling_ids_to_collect` by invoking this action.  Finally, the child
-  /// element destroys itself.
+  /// element destroys itself.  Since the child is destroyed, the items are
+  /// moved out of `box` (see db::move_items) rather than copied.
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
   static void apply(
@@ -46,10 +48,14 @@ struct CollectDataFromChildren {
                        tuples::tagged_tuple_from_typelist<typename db::DataBox<
                            DbTagList>::mutable_item_creation_tags>>
         children_data{};
+    // Deregister before the items are moved out of the box, because the
+    // registrars may read them.
+    Parallel::deregister_element<ParallelComponent>(box, cache, child_id);
     children_data.emplace(
         child_id,
-        db::copy_items<
-            typename db::DataBox<DbTagList>::mutable_item_creation_tags>(box));
+        db::move_items<
+            typename db::DataBox<DbTagList>::mutable_item_creation_tags>(
+            make_not_null(&box)));
     const auto next_child_id = sibling_ids_to_collect.front();
     sibling_ids_to_collect.pop_front();
     auto& array_proxy =
@@ -58,15 +64,14 @@ struct CollectDataFromChildren {
         array_proxy[next_child_id], parent_id, sibling_ids_to_collect,
         std::move(children_data));
 
-    Parallel::deregister_element<ParallelComponent>(box, cache, child_id);
     array_proxy[child_id].ckDestroy();
   }
 
   /// \brief  This function should be called after a child element has added its
   /// data to `children_data` by a previous invocation of this action.
   ///
-  /// \details This function adds a copy of all items corresponding to the
-  /// mutable_item_creation_tags of `box` of `child_id` to `children_data`.
+  /// \details This function moves all items corresponding to the
+  /// mutable_item_creation_tags of `box` of `child_id` into `children_data`.
   /// In addition, it checks if there are additional siblings that need to be
   /// added to `sibiling_ids_to_collect`.  (This is necessary as not all
   /// siblings share a face.) If `sibling_ids_to_collect` is not empty, this
@@ -101,10 +106,12 @@ struct CollectDataFromChildren {
       }
     }
 
+    Parallel::deregister_element<ParallelComponent>(box, cache, child_id);
     children_data.emplace(
         child_id,
-        db::copy_items<
-            typename db::DataBox<DbTagList>::mutable_item_creation_tags>(box));
+        db::move_items<
+            typename db::DataBox<DbTagList>::mutable_item_creation_tags>(
+            make_not_null(&box)));
     auto& array_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
 
@@ -119,7 +126,6 @@ struct CollectDataFromChildren {
           std::move(children_data));
     }
 
-    Parallel::deregister_element<ParallelComponent>(box, cache, child_id);
     array_proxy[child_id].ckDestroy();
   }
 };
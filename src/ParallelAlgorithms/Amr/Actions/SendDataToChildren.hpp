@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -11,6 +13,9 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeChild.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 namespace amr::Actions {
 /// \brief Sends data from the parent element to its children elements during
@@ -21,6 +26,11 @@ namespace amr::Actions {
 /// corresponding to the mutable_item_creation_tags of `box` to each of the
 /// elements with `ids_of_children`.  Finally, the parent element destroys
 /// itself.
+///
+/// Because the parent element is destroyed, its items are not copied
+/// item-by-item for every child (which serializes and deserializes each item).
+/// Instead, the items are serialized once and deserialized for all but the
+/// last child, and the last child receives the items moved out of `box`.
 struct SendDataToChildren {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
@@ -29,18 +39,29 @@ struct SendDataToChildren {
                     const ElementId<Metavariables::volume_dim>& element_id,
                     const std::vector<ElementId<Metavariables::volume_dim>>&
                         ids_of_children) {
+    using items_tags =
+        typename db::DataBox<DbTagList>::mutable_item_creation_tags;
+    using items_type = tuples::tagged_tuple_from_typelist<items_tags>;
     auto& array_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    for (const auto& child_id : ids_of_children) {
-      Parallel::simple_action<amr::Actions::InitializeChild>(
-          array_proxy[child_id],
-          db::copy_items<
-              typename db::DataBox<DbTagList>::mutable_item_creation_tags>(
-              box));
-    }
 
+    // Deregister first, because the registrars may read items that are moved
+    // out of the box below.
     Parallel::deregister_element<ParallelComponent>(box, cache, element_id);
 
+    auto parent_items = db::move_items<items_tags>(make_not_null(&box));
+    if (ids_of_children.size() > 1) {
+      const std::vector<char> serialized_parent_items =
+          serialize<items_type>(parent_items);
+      for (size_t i = 0; i < ids_of_children.size() - 1; ++i) {
+        Parallel::simple_action<amr::Actions::InitializeChild>(
+            array_proxy[ids_of_children[i]],
+            deserialize<items_type>(serialized_parent_items.data()));
+      }
+    }
+    Parallel::simple_action<amr::Actions::InitializeChild>(
+        array_proxy[ids_of_children.back()], std::move(parent_items));
+
     array_proxy[element_id].ckDestroy();
   }
 };
@@ -14,6 +14,7 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Tags.hpp"
@@ -41,11 +42,15 @@ namespace TruncationError_detail {
  * the "max" of the current and new flags, where the "highest" flag is
  * `Flag::IncreaseResolution`, followed by `Flag::DoNothing`, and then
  * `Flag::DecreaseResolution`.
+ *
+ * The buffers are reused between the tensor components so they are only
+ * allocated once.
  */
 template <size_t Dim>
 void max_over_components(
     gsl::not_null<std::array<Flag, Dim>*> result,
     const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
+    const gsl::not_null<ModalVector*> modal_coefficients_buffer,
     const DataVector& tensor_component, const Mesh<Dim>& mesh,
     std::optional<double> target_abs_truncation_error,
     std::optional<double> target_rel_truncation_error);
@@ -160,9 +165,11 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
   auto result = make_array<Dim>(Flag::Undefined);
   const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
   std::array<DataVector, Dim> power_monitors_buffer{};
+  ModalVector modal_coefficients_buffer{};
   // Check all tensors and all tensor components in turn
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &power_monitors_buffer, this](const auto tag_v) {
+      [&result, &box, &mesh, &power_monitors_buffer,
+       &modal_coefficients_buffer, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::IncreaseResolution)) {
           return;
@@ -177,8 +184,12 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
         for (const DataVector& tensor_component : tensor) {
           TruncationError_detail::max_over_components(
               make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
+              make_not_null(&modal_coefficients_buffer), tensor_component,
+              mesh, target_abs_truncation_error_, target_rel_truncation_error_);
+          // The remaining components can't change the decision
+          if (result == make_array<Dim>(Flag::IncreaseResolution)) {
+            return;
+          }
         }
       });
   return result;
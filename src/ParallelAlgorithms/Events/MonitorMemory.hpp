@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <map>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -36,6 +37,7 @@
 #include "Parallel/Reduction.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArrayItems.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
@@ -71,6 +73,14 @@ namespace Events {
  * parallel component ("Blah" for example) in the input file. An ERROR will
  * occur and a list of the available components to monitor will be printed.
  *
+ * If `ItemBreakdown` is enabled, the memory used by the DgElementArray is
+ * additionally attributed to each item in the elements' DataBoxes (simple and
+ * compute tags, but not reference items) and to each of their inboxes (e.g.
+ * boundary data, mortar data, and subcell ghost data). The sizes are summed
+ * over all elements and written under `/MemoryMonitors/` with the component
+ * name followed by `Items`. See `mem_monitor::ProcessArrayItems`. This is
+ * useful for deciding which items to trim or to turn into compute tags.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -85,6 +95,13 @@ class MonitorMemory : public Event {
       // Vector of total mem usage on each node
       Parallel::ReductionDatum<std::vector<double>,
                                funcl::ElementWise<funcl::Plus<>>>>;
+  // Reduction data for the per-item breakdown of arrays
+  using ItemsReductionData = Parallel::ReductionData<
+      // Time
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      // Total size in bytes of each DataBox item and inbox
+      Parallel::ReductionDatum<std::map<std::string, size_t>,
+                               mem_monitor::AddItemSizes>>;
 
  public:
   explicit MonitorMemory(CkMigrateMessage* msg);
@@ -100,7 +117,15 @@ class MonitorMemory : public Event {
         "instead."};
   };
 
-  using options = tmpl::list<ComponentsToMonitor>;
+  struct ItemBreakdown {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Also write the memory used by each DataBox item and inbox of the "
+        "DgElementArray, summed over all elements. Has no effect if the "
+        "DgElementArray is not monitored."};
+  };
+
+  using options = tmpl::list<ComponentsToMonitor, ItemBreakdown>;
 
   static constexpr Options::String help =
       "Observe memory usage of parallel components.";
@@ -110,19 +135,22 @@ class MonitorMemory : public Event {
   template <typename Metavariables>
   MonitorMemory(
       const std::optional<std::vector<std::string>>& components_to_monitor,
-      const Options::Context& context, Metavariables /*meta*/);
+      bool item_breakdown, const Options::Context& context,
+      Metavariables /*meta*/);
 
-  using observed_reduction_data_tags =
-      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<ReductionData, ItemsReductionData>>;
 
   using compute_tags_for_observation_box = tmpl::list<>;
 
   using return_tags = tmpl::list<>;
-  using argument_tags = tmpl::list<domain::Tags::Element<Dim>>;
+  using argument_tags =
+      tmpl::list<domain::Tags::Element<Dim>, ::Tags::DataBox>;
 
-  template <typename Metavariables, typename ArrayIndex,
+  template <typename DbTagsList, typename Metavariables, typename ArrayIndex,
             typename ParallelComponent>
   void operator()(const ::Element<Dim>& element,
+                  const db::DataBox<DbTagsList>& box,
                   Parallel::GlobalCache<Metavariables>& cache,
                   const ArrayIndex& array_index,
                   const ParallelComponent* const /*meta*/,
@@ -152,6 +180,7 @@ class MonitorMemory : public Event {
 
  private:
   std::unordered_set<std::string> components_to_monitor_{};
+  bool item_breakdown_{false};
 };
 
 /// \cond
@@ -162,7 +191,9 @@ template <size_t Dim>
 template <typename Metavariables>
 MonitorMemory<Dim>::MonitorMemory(
     const std::optional<std::vector<std::string>>& components_to_monitor,
-    const Options::Context& context, Metavariables /*meta*/) {
+    const bool item_breakdown, const Options::Context& context,
+    Metavariables /*meta*/)
+    : item_breakdown_(item_breakdown) {
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
   std::unordered_map<std::string, std::string> existing_components{};
@@ -225,17 +256,18 @@ MonitorMemory<Dim>::MonitorMemory(
 }
 
 template <size_t Dim>
-template <typename Metavariables, typename ArrayIndex,
+template <typename DbTagsList, typename Metavariables, typename ArrayIndex,
           typename ParallelComponent>
 void MonitorMemory<Dim>::operator()(
-    const ::Element<Dim>& element, Parallel::GlobalCache<Metavariables>& cache,
-    const ArrayIndex& array_index, const ParallelComponent* const /*meta*/,
+    const ::Element<Dim>& element, const db::DataBox<DbTagsList>& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const ParallelComponent* const /*meta*/,
     const ObservationValue& observation_value) const {
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
 
-  tmpl::for_each<component_list>([this, &observation_value, &element, &cache,
-                                  &array_index](auto component_v) {
+  tmpl::for_each<component_list>([this, &observation_value, &element, &box,
+                                  &cache, &array_index](auto component_v) {
     using component = tmpl::type_from<decltype(component_v)>;
 
     // If we aren't monitoring this parallel component, then just exit now
@@ -281,6 +313,16 @@ void MonitorMemory<Dim>::operator()(
           mem_monitor::ProcessArray<ParallelComponent>>(
           ReductionData{observation_value.value, data}, array_element_proxy,
           memory_monitor_proxy);
+
+      if (item_breakdown_) {
+        Parallel::contribute_to_reduction<
+            mem_monitor::ProcessArrayItems<ParallelComponent>>(
+            ItemsReductionData{
+                observation_value.value,
+                mem_monitor::size_of_items(
+                    box, Parallel::local(array_element_proxy)->get_inboxes())},
+            array_element_proxy, memory_monitor_proxy);
+      }
     } else if constexpr (Parallel::is_singleton_v<component>) {
       // If this is a singleton, we only run this once so use the designated
       // element. Nothing to reduce with singletons so just call the simple
@@ -323,7 +365,15 @@ void MonitorMemory<Dim>::operator()(
 template <size_t Dim>
 void MonitorMemory<Dim>::pup(PUP::er& p) {
   Event::pup(p);
-  p | components_to_monitor_;
+  size_t version = 0;
+  p | version;
+  // Remember to increment the version number when making changes to this
+  // function. Retain support for unpacking data written by previous versions
+  // whenever possible. See `Domain` docs for details.
+  if (version >= 0) {
+    p | components_to_monitor_;
+    p | item_breakdown_;
+  }
 }
 
 template <size_t Dim>
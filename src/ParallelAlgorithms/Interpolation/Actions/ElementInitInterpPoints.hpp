@@ -28,7 +28,10 @@ namespace Actions {
 /// \ingroup ActionsGroup
 /// \brief Adds interpolation point holders to the Element's DataBox.
 ///
-/// This action is for the case in which the points are time-independent.
+/// The points of targets with time-independent points are filled once during
+/// registration. For targets with time-dependent points, the holder is an
+/// (initially empty) map from temporal id to points that is filled as the
+/// InterpolationTarget sends the points at each temporal id.
 ///
 /// This action should be placed in the Initialization PDAL for DgElementArray.
 ///
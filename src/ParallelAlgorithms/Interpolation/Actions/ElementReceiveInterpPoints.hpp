@@ -3,17 +3,28 @@
 
 #pragma once
 
+#include <limits>
+#include <utility>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "ParallelAlgorithms/Interpolation/Events/InterpolateOnElement.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 
+/// \cond
 namespace Parallel {
 template <typename Metavariables>
 class GlobalCache;
 }  // namespace Parallel
+namespace Tags {
+struct Time;
+}  // namespace Tags
+/// \endcond
 
 namespace intrp {
 namespace Actions {
@@ -21,6 +32,21 @@ namespace Actions {
 /// \ingroup ActionsGroup
 /// \brief Receives interpolation points from an InterpolationTarget.
 ///
+/// There are two overloads:
+/// - For targets whose points are time-independent, the points are received
+///   once and replace the stored points.
+/// - For targets whose points are time-dependent (see
+///   `intrp::InterpolationTarget_detail::points_are_time_dependent_v`), the
+///   points are received together with the temporal id at which they are
+///   valid. If the `Element` already holds its volume data at that temporal
+///   id, because it reached the temporal id before the points arrived (see
+///   `intrp::Events::InterpolateWithoutInterpComponent`), the data is
+///   interpolated to the points right away and sent to the
+///   InterpolationTarget. Otherwise the points are stored until the `Element`
+///   interpolates at that temporal id. Points at temporal ids that are earlier
+///   than the current `::Tags::Time` of the `Element` (if it has one) are
+///   discarded, since they have already been used.
+///
 /// Uses: nothing
 ///
 /// DataBox changes:
@@ -39,6 +65,10 @@ struct ElementReceiveInterpPoints {
       tnsr::I<DataVector, Metavariables::volume_dim,
               typename InterpolationTargetTag::compute_target_points::frame>&&
           coords) {
+    static_assert(not InterpolationTarget_detail::points_are_time_dependent_v<
+                      InterpolationTargetTag>,
+                  "Time-dependent target points must be sent together with "
+                  "their temporal id.");
     db::mutate<intrp::Tags::InterpPointInfo<Metavariables>>(
         [&coords](const gsl::not_null<
                   typename intrp::Tags::InterpPointInfo<Metavariables>::type*>
@@ -49,6 +79,57 @@ struct ElementReceiveInterpPoints {
         },
         make_not_null(&box));
   }
+
+  template <typename ParallelComponent, typename DbTags, typename Metavariables>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Metavariables::volume_dim>& array_index,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      tnsr::I<DataVector, Metavariables::volume_dim,
+              typename InterpolationTargetTag::compute_target_points::frame>&&
+          coords) {
+    static_assert(InterpolationTarget_detail::points_are_time_dependent_v<
+                      InterpolationTargetTag>,
+                  "Only time-dependent target points are sent together with "
+                  "a temporal id.");
+    using point_infos_tag = intrp::Tags::InterpPointInfo<Metavariables>;
+    using points_tag = intrp::Vars::PointInfoTag<InterpolationTargetTag,
+                                                 Metavariables::volume_dim>;
+    const auto& volume_data =
+        get<points_tag>(db::get<point_infos_tag>(box)).volume_data;
+    if (const auto data = volume_data.find(temporal_id);
+        data != volume_data.end()) {
+      Events::detail::interpolate_in_element<InterpolationTargetTag>(
+          cache, array_index, coords, temporal_id, data->second.mesh,
+          data->second.coordinates,
+          [&data]() -> const auto& { return data->second.vars; });
+      db::mutate<point_infos_tag>(
+          [&temporal_id](const gsl::not_null<typename point_infos_tag::type*>
+                             point_infos) {
+            get<points_tag>(*point_infos).volume_data.erase(temporal_id);
+          },
+          make_not_null(&box));
+      return;
+    }
+    double current_time = std::numeric_limits<double>::lowest();
+    if constexpr (db::tag_is_retrievable_v<::Tags::Time, db::DataBox<DbTags>>) {
+      current_time = db::get<::Tags::Time>(box);
+    }
+    db::mutate<point_infos_tag>(
+        [&coords, &current_time, &temporal_id](
+            const gsl::not_null<typename point_infos_tag::type*> point_infos) {
+          auto& points_at_temporal_ids = get<points_tag>(*point_infos).points;
+          for (auto it = points_at_temporal_ids.begin();
+               it != points_at_temporal_ids.end() and
+               InterpolationTarget_detail::get_temporal_id_value(it->first) <
+                   current_time;) {
+            it = points_at_temporal_ids.erase(it);
+          }
+          points_at_temporal_ids.insert_or_assign(temporal_id,
+                                                  std::move(coords));
+        },
+        make_not_null(&box));
+  }
 };
 }  // namespace Actions
 }  // namespace intrp
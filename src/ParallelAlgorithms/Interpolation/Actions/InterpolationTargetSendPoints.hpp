@@ -4,6 +4,8 @@
 #pragma once
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -11,6 +13,7 @@
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/ElementReceiveInterpPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -52,6 +55,10 @@ struct InterpolationTargetSendTimeIndepPointsToElements {
         "Actions::InterpolationTargetSendTimeIndepPointsToElement can be used "
         "only with non-sequential targets, since a sequential target is "
         "time-dependent by definition.");
+    static_assert(not InterpolationTarget_detail::points_are_time_dependent_v<
+                      InterpolationTargetTag>,
+                  "Use Actions::InterpolationTargetSendTimeDepPointsToElements "
+                  "for targets with time-dependent points.");
     auto coords = InterpolationTargetTag::compute_target_points::points(
         box, tmpl::type_<Metavariables>{});
     auto& receiver_proxy = Parallel::get_parallel_component<
@@ -62,5 +69,80 @@ struct InterpolationTargetSendTimeIndepPointsToElements {
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
+
+/// \ingroup ActionsGroup
+/// \brief Sends the interpolation points at a given temporal id to all the
+/// Elements.
+///
+/// This action is for targets whose points change with time (in every frame),
+/// such as surfaces whose shape is updated by a post-interpolation callback,
+/// and that set `points_are_time_dependent` to `std::true_type`. Rather than
+/// having every `Element` copy its volume data to the `Interpolator`, the
+/// target broadcasts its points to the `Element`s, which interpolate onto the
+/// points they contain (see `intrp::Events::InterpolateWithoutInterpComponent`)
+/// and send only the interpolated values back to the target.
+///
+/// This simple action is invoked on the InterpolationTarget by every
+/// `Element` that reaches `temporal_id` before it has received the points at
+/// `temporal_id`. Each `Element` asks at most once per `temporal_id`, from the
+/// call operator of `intrp::Events::InterpolateWithoutInterpComponent`, and
+/// interpolates its stored volume data once the points arrive (see
+/// `intrp::Actions::ElementReceiveInterpPoints`). The points are sent only for the first request at each `temporal_id`; the
+/// `temporal_id` is then held in `Tags::PendingTemporalIds<TemporalId>` until
+/// the first interpolated values arrive from an `Element`, after which it is
+/// moved to `Tags::TemporalIds<TemporalId>` and, once the interpolation is
+/// done, to `Tags::CompletedTemporalIds<TemporalId>`. Later requests for the
+/// same `temporal_id` are ignored.
+///
+/// \note Sequential targets, such as those of the apparent horizon finder,
+/// need new points several times at the same temporal id and are not
+/// supported. They still use the `Interpolator`.
+///
+/// Uses:
+/// - DataBox:
+///   - Anything that the particular
+///     InterpolationTargetTag::compute_target_points needs from the DataBox.
+///   - `Tags::TemporalIds<TemporalId>`
+///   - `Tags::CompletedTemporalIds<TemporalId>`
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `Tags::PendingTemporalIds<TemporalId>`
+template <typename InterpolationTargetTag>
+struct InterpolationTargetSendTimeDepPointsToElements {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId>
+  static void apply(db::DataBox<DbTags>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const TemporalId& temporal_id) {
+    static_assert(
+        not InterpolationTargetTag::compute_target_points::is_sequential::value,
+        "Actions::InterpolationTargetSendTimeDepPointsToElements can be used "
+        "only with non-sequential targets.");
+    static_assert(InterpolationTarget_detail::points_are_time_dependent_v<
+                      InterpolationTargetTag>,
+                  "Use "
+                  "Actions::InterpolationTargetSendTimeIndepPointsToElements "
+                  "for targets with time-independent points.");
+    if (InterpolationTarget_detail::flag_temporal_ids_as_pending<
+            InterpolationTargetTag>(make_not_null(&box),
+                                    std::vector<TemporalId>{{temporal_id}})
+            .empty()) {
+      // The points have already been sent, or the interpolation at this
+      // temporal_id is already done.
+      return;
+    }
+    auto coords = InterpolationTargetTag::compute_target_points::points(
+        box, tmpl::type_<Metavariables>{}, temporal_id);
+    auto& receiver_proxy = Parallel::get_parallel_component<
+        typename InterpolationTargetTag::template interpolating_component<
+            Metavariables>>(cache);
+    Parallel::simple_action<ElementReceiveInterpPoints<InterpolationTargetTag>>(
+        receiver_proxy, temporal_id, std::move(coords));
+  }
+};
 }  // namespace Actions
 }  // namespace intrp
@@ -0,0 +1,278 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/Structure/BlockId.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/Targets/Sphere.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
+
+/// \cond
+namespace intrp {
+template <typename Metavariables, typename Tag>
+struct InterpolationTarget;
+}  // namespace intrp
+/// \endcond
+
+namespace intrp::Events {
+namespace detail {
+/*!
+ * \brief The block logical coordinates of all target points of the
+ * `InterpolationTargetTag`, for passing to `element_logical_coordinates` on
+ * the element `array_index`.
+ *
+ * \details For the `intrp::TargetPoints::Sphere` target only the points near
+ * the element are mapped to the block logical frame, and all other points are
+ * `std::nullopt`. If no radius of the sphere passes through the element, the
+ * result is empty.
+ */
+template <typename InterpolationTargetTag, size_t VolumeDim,
+          typename Metavariables>
+std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords_in_element(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const tnsr::I<DataVector, VolumeDim,
+                  typename InterpolationTargetTag::compute_target_points::
+                      frame>& all_target_points,
+    const tnsr::I<DataVector, VolumeDim,
+                  typename InterpolationTargetTag::compute_target_points::
+                      frame>& coordinates,
+    const ElementId<VolumeDim>& array_index,
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+  using frame = typename InterpolationTargetTag::compute_target_points::frame;
+  std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords{};
+
+  // The sphere target is special because we have a better idea of where the
+  // points will be.
+  if constexpr (tt::is_a_v<
+                    TargetPoints::Sphere,
+                    typename InterpolationTargetTag::compute_target_points>) {
+    static_assert(VolumeDim == 3,
+                  "Sphere target can only be used for VolumeDim = 3.");
+    // Extremum for x, y, z, r
+    std::array<std::pair<double, double>, 4> min_max_coordinates{};
+
+    const auto& sphere =
+        Parallel::get<Tags::Sphere<InterpolationTargetTag>>(cache);
+    const std::array<double, 3>& center = sphere.center;
+
+    // Calculate r^2 from center of sphere because sqrt is expensive
+    DataVector radii_squared{get<0>(coordinates).size(), 0.0};
+    for (size_t i = 0; i < VolumeDim; i++) {
+      radii_squared += square(coordinates.get(i) - gsl::at(center, i));
+    }
+
+    // Compute min and max
+    {
+      const auto [min, max] = alg::minmax_element(radii_squared);
+      min_max_coordinates[3].first = *min;
+      min_max_coordinates[3].second = *max;
+    }
+
+    const std::set<double>& radii_of_sphere_target = sphere.radii;
+    const size_t l_max = sphere.l_max;
+
+    const size_t number_of_angular_points = (l_max + 1) * (2 * l_max + 1);
+    // first size_t = position of first radius in bounds
+    // second size_t = total bounds to use/check
+    std::optional<std::pair<size_t, size_t>> offset_and_num_points{};
+
+    // Have a very small buffer just in case of roundoff
+    double epsilon =
+        (min_max_coordinates[3].second - min_max_coordinates[3].first) *
+        std::numeric_limits<double>::epsilon() * 100.0;
+    size_t offset_index = 0;
+    // Check if any radii of the target are within the radii of our element
+    for (double radius : radii_of_sphere_target) {
+      const double square_radius = square(radius);
+      if (square_radius >=
+              (gsl::at(min_max_coordinates, 3).first - epsilon) and
+          square_radius <=
+              (gsl::at(min_max_coordinates, 3).second + epsilon)) {
+        if (offset_and_num_points.has_value()) {
+          offset_and_num_points->second += number_of_angular_points;
+        } else {
+          offset_and_num_points =
+              std::make_pair(offset_index * number_of_angular_points,
+                             number_of_angular_points);
+        }
+      }
+      offset_index++;
+    }
+
+    // If no radii pass through this element, there's nothing to do so return
+    if (not offset_and_num_points.has_value()) {
+      return {};
+    }
+
+    // Get the x,y,z bounds
+    for (size_t i = 0; i < VolumeDim; i++) {
+      const auto [min, max] = alg::minmax_element(coordinates.get(i));
+      gsl::at(min_max_coordinates, i).first = *min;
+      gsl::at(min_max_coordinates, i).second = *max;
+    }
+
+    const tnsr::I<DataVector, VolumeDim, frame> target_points_to_check{};
+    // Use the offset and number of points to create a view. We assume that if
+    // there are multiple radii in this element, that they are successive
+    // radii. If this wasn't true, that'd be a really weird topology.
+    for (size_t i = 0; i < VolumeDim; i++) {
+      make_const_view(make_not_null(&target_points_to_check.get(i)),
+                      all_target_points.get(i), offset_and_num_points->first,
+                      offset_and_num_points->second);
+    }
+
+    // To break out of inner loop and skip the point
+    bool skip_point = false;
+    tnsr::I<double, VolumeDim, frame> sphere_coords_to_map{};
+    // element_logical_coordinates expects block_logical_coords to be sized to
+    // the total number of points on the target (including all radii). By
+    // default these will all be nullopt and we.ll only fill the ones we need
+    block_logical_coords.resize(get<0>(all_target_points).size());
+
+    const Block<VolumeDim>& block =
+        Parallel::get<domain::Tags::Domain<VolumeDim>>(cache)
+            .blocks()[array_index.block_id()];
+
+    // Now for every radius in this element, we check if their points are
+    // within the x,y,z bounds of the element. If they are, map the point to
+    // the block logical frame and add it to the vector f all block logical
+    // coordinates.
+    for (size_t index = 0; index < get<0>(target_points_to_check).size();
+         index++) {
+      skip_point = false;
+      for (size_t i = 0; i < VolumeDim; i++) {
+        const double coord = target_points_to_check.get(i)[index];
+        epsilon = (gsl::at(min_max_coordinates, i).second -
+                   gsl::at(min_max_coordinates, i).first) *
+                  std::numeric_limits<double>::epsilon() * 100.0;
+        // If a point is outside any of the bounding box, skip it
+        if (coord < (gsl::at(min_max_coordinates, i).first - epsilon) or
+            coord > (gsl::at(min_max_coordinates, i).second + epsilon)) {
+          skip_point = true;
+          break;
+        }
+
+        sphere_coords_to_map.get(i) = coord;
+      }
+
+      if (skip_point) {
+        continue;
+      }
+
+      std::optional<tnsr::I<double, VolumeDim, ::Frame::BlockLogical>>
+          block_coords_of_target_point{};
+
+      if constexpr (Parallel::is_in_global_cache<
+                        Metavariables, domain::Tags::FunctionsOfTime>) {
+        const auto& functions_of_time =
+            Parallel::get<domain::Tags::FunctionsOfTime>(cache);
+        const double time =
+            InterpolationTarget_detail::get_temporal_id_value(temporal_id);
+
+        block_coords_of_target_point = block_logical_coordinates_single_point(
+            sphere_coords_to_map, block, time, functions_of_time);
+      } else {
+        block_coords_of_target_point = block_logical_coordinates_single_point(
+            sphere_coords_to_map, block);
+      }
+
+      if (block_coords_of_target_point.has_value()) {
+        // Get index into vector of all grid points of the target. This is
+        // just the offset + index
+        block_logical_coords[offset_and_num_points->first + index] =
+            make_id_pair(domain::BlockId(array_index.block_id()),
+                         std::move(block_coords_of_target_point.value()));
+      }
+    }
+  } else {
+    (void)coordinates;
+    (void)array_index;
+    block_logical_coords = InterpolationTarget_detail::block_logical_coords<
+        InterpolationTargetTag>(cache, all_target_points, temporal_id);
+  }
+  return block_logical_coords;
+}
+
+/*!
+ * \brief Interpolate the volume data of the element `array_index` to the
+ * target points of the `InterpolationTargetTag` that lie in it, and send the
+ * interpolated values to the InterpolationTarget.
+ *
+ * \details The `coordinates` are the grid points of the `mesh` in the frame of
+ * the target points. `get_interp_vars()` returns the
+ * `InterpolationTargetTag::vars_to_interpolate_to_target` on the `mesh`. It is
+ * only called if a target point lies in the element, so elements without
+ * target points don't compute them.
+ */
+template <typename InterpolationTargetTag, size_t VolumeDim,
+          typename Metavariables, typename GetInterpVars>
+void interpolate_in_element(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const ElementId<VolumeDim>& array_index,
+    const tnsr::I<DataVector, VolumeDim,
+                  typename InterpolationTargetTag::compute_target_points::
+                      frame>& all_target_points,
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+    const Mesh<VolumeDim>& mesh,
+    const tnsr::I<DataVector, VolumeDim,
+                  typename InterpolationTargetTag::compute_target_points::
+                      frame>& coordinates,
+    const GetInterpVars& get_interp_vars) {
+  std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords =
+      block_logical_coords_in_element<InterpolationTargetTag>(
+          cache, all_target_points, coordinates, array_index, temporal_id);
+
+  const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
+  const auto element_coord_holders =
+      element_logical_coordinates(element_ids, block_logical_coords);
+
+  if (element_coord_holders.count(array_index) == 0) {
+    // There are no target points in this element, so we don't need
+    // to do anything.
+    return;
+  }
+  const auto& element_coord_holder = element_coord_holders.at(array_index);
+
+  intrp::Irregular<VolumeDim> interpolator(
+      mesh, element_coord_holder.element_logical_coords);
+  auto& receiver_proxy = Parallel::get_parallel_component<
+      InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+  Parallel::simple_action<
+      Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
+      receiver_proxy,
+      std::vector<Variables<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
+          {interpolator.interpolate(get_interp_vars())}),
+      std::move(block_logical_coords),
+      std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
+      temporal_id);
+}
+}  // namespace detail
+}  // namespace intrp::Events
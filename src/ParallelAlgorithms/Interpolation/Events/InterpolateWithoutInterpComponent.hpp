@@ -3,45 +3,30 @@
 
 #pragma once
 
-#include <array>
 #include <cstddef>
-#include <limits>
-#include <optional>
 #include <pup.h>
-#include <set>
 #include <utility>
-#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Index.hpp"
-#include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Domain.hpp"
-#include "Domain/ElementLogicalCoordinates.hpp"
-#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
-#include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
-#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "Options/String.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetSendPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
 #include "ParallelAlgorithms/Interpolation/Events/GetComputeItemsOnSource.hpp"
+#include "ParallelAlgorithms/Interpolation/Events/InterpolateOnElement.hpp"
 #include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
-#include "ParallelAlgorithms/Interpolation/Targets/Sphere.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
-#include "Utilities/Algorithm.hpp"
-#include "Utilities/CartesianProduct.hpp"
-#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
-#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
-#include "Utilities/TypeTraits/IsA.hpp"
 
 /// \cond
 namespace Events::Tags {
@@ -73,6 +58,21 @@ class InterpolateWithoutInterpComponent;
  * \brief Does an interpolation onto an InterpolationTargetTag by calling
  * Actions on the InterpolationTarget component.
  *
+ * \details Only the interpolated values at the target points that lie in
+ * this `Element` are sent to the InterpolationTarget; the volume data never
+ * leaves the `Element`.
+ *
+ * If the InterpolationTargetTag has time-dependent points (see
+ * `InterpolationTarget_detail::points_are_time_dependent_v`), the points at
+ * each temporal id are broadcast to the `Element`s by
+ * `Actions::InterpolationTargetSendTimeDepPointsToElements`. If they have
+ * arrived when the event runs, the event interpolates to them and removes
+ * them from the `Element`. Otherwise the event asks the InterpolationTarget
+ * for the points, which happens at most once per `Element` and temporal id,
+ * and keeps the `vars_to_interpolate_to_target` (with the mesh and
+ * coordinates) in the `Element` until `Actions::ElementReceiveInterpPoints`
+ * interpolates them to the points. The `Element` never waits for the points.
+ *
  * \note The `intrp::TargetPoints::Sphere` target is handled specially because
  * it has the potential to be very slow due to it usually having the most points
  * out of all the stationary targets. An optimization for the future would be to
@@ -86,6 +86,9 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
     : public Event {
  private:
   using frame = typename InterpolationTargetTag::compute_target_points::frame;
+  static constexpr bool points_are_time_dependent =
+      InterpolationTarget_detail::points_are_time_dependent_v<
+          InterpolationTargetTag>;
 
  public:
   /// \cond
@@ -109,11 +112,17 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       detail::get_compute_items_on_source_or_default_t<InterpolationTargetTag,
                                                        tmpl::list<>>;
 
-  using return_tags = tmpl::list<>;
-  using argument_tags =
-      tmpl::list<typename InterpolationTargetTag::temporal_id,
-                 Tags::InterpPointInfoBase,
-                 ::Events::Tags::ObserverMesh<VolumeDim>,
+  // For targets with time-dependent points the event updates the points and
+  // the held volume data at the temporal id. The DataBox is requested because
+  // the tag holding them depends on the Metavariables.
+  using return_tags =
+      tmpl::conditional_t<points_are_time_dependent,
+                          tmpl::list<::Tags::DataBox>, tmpl::list<>>;
+  using argument_tags = tmpl::append<
+      tmpl::list<typename InterpolationTargetTag::temporal_id>,
+      tmpl::conditional_t<points_are_time_dependent, tmpl::list<>,
+                          tmpl::list<Tags::InterpPointInfoBase>>,
+      tmpl::list<::Events::Tags::ObserverMesh<VolumeDim>,
                  // We always grab the DG coords because we use them to create a
                  // bounding box for the sphere target optimization. DG coords
                  // have points on the boundary, while FD coords don't. If we
@@ -122,194 +131,110 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
                  // would be outside our bounding box, and thus wouldn't get
                  // interpolated to. We avoid this by always using DG coords,
                  // even if the mesh is FD.
-                 domain::Tags::Coordinates<VolumeDim, frame>, SourceVarTags...>;
+                 domain::Tags::Coordinates<VolumeDim, frame>,
+                 SourceVarTags...>>;
 
   template <typename ParallelComponent, typename Metavariables>
   void operator()(
       const typename InterpolationTargetTag::temporal_id::type& temporal_id,
       const typename Tags::InterpPointInfo<Metavariables>::type& point_infos,
       const Mesh<VolumeDim>& mesh,
-      const tnsr::I<DataVector, VolumeDim, frame> coordinates,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
       const typename SourceVarTags::type&... source_vars_input,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const /*meta*/,
       const ObservationValue& /*observation_value*/) const {
-    const tnsr::I<DataVector, VolumeDim, frame>& all_target_points =
-        get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(point_infos);
-    std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords{};
-
-    // The sphere target is special because we have a better idea of where the
-    // points will be.
-    if constexpr (tt::is_a_v<
-                      TargetPoints::Sphere,
-                      typename InterpolationTargetTag::compute_target_points>) {
-      static_assert(VolumeDim == 3,
-                    "Sphere target can only be used for VolumeDim = 3.");
-      // Extremum for x, y, z, r
-      std::array<std::pair<double, double>, 4> min_max_coordinates{};
-
-      const auto& sphere =
-          Parallel::get<Tags::Sphere<InterpolationTargetTag>>(cache);
-      const std::array<double, 3>& center = sphere.center;
-
-      // Calculate r^2 from center of sphere because sqrt is expensive
-      DataVector radii_squared{get<0>(coordinates).size(), 0.0};
-      for (size_t i = 0; i < VolumeDim; i++) {
-        radii_squared += square(coordinates.get(i) - gsl::at(center, i));
-      }
-
-      // Compute min and max
-      {
-        const auto [min, max] = alg::minmax_element(radii_squared);
-        min_max_coordinates[3].first = *min;
-        min_max_coordinates[3].second = *max;
-      }
-
-      const std::set<double>& radii_of_sphere_target = sphere.radii;
-      const size_t l_max = sphere.l_max;
-
-      const size_t number_of_angular_points = (l_max + 1) * (2 * l_max + 1);
-      // first size_t = position of first radius in bounds
-      // second size_t = total bounds to use/check
-      std::optional<std::pair<size_t, size_t>> offset_and_num_points{};
-
-      // Have a very small buffer just in case of roundoff
-      double epsilon =
-          (min_max_coordinates[3].second - min_max_coordinates[3].first) *
-          std::numeric_limits<double>::epsilon() * 100.0;
-      size_t offset_index = 0;
-      // Check if any radii of the target are within the radii of our element
-      for (double radius : radii_of_sphere_target) {
-        const double square_radius = square(radius);
-        if (square_radius >=
-                (gsl::at(min_max_coordinates, 3).first - epsilon) and
-            square_radius <=
-                (gsl::at(min_max_coordinates, 3).second + epsilon)) {
-          if (offset_and_num_points.has_value()) {
-            offset_and_num_points->second += number_of_angular_points;
-          } else {
-            offset_and_num_points =
-                std::make_pair(offset_index * number_of_angular_points,
-                               number_of_angular_points);
-          }
-        }
-        offset_index++;
-      }
-
-      // If no radii pass through this element, there's nothing to do so return
-      if (not offset_and_num_points.has_value()) {
-        return;
-      }
-
-      // Get the x,y,z bounds
-      for (size_t i = 0; i < VolumeDim; i++) {
-        const auto [min, max] = alg::minmax_element(coordinates.get(i));
-        gsl::at(min_max_coordinates, i).first = *min;
-        gsl::at(min_max_coordinates, i).second = *max;
-      }
-
-      const tnsr::I<DataVector, VolumeDim, frame> target_points_to_check{};
-      // Use the offset and number of points to create a view. We assume that if
-      // there are multiple radii in this element, that they are successive
-      // radii. If this wasn't true, that'd be a really weird topology.
-      for (size_t i = 0; i < VolumeDim; i++) {
-        make_const_view(make_not_null(&target_points_to_check.get(i)),
-                        all_target_points.get(i), offset_and_num_points->first,
-                        offset_and_num_points->second);
-      }
-
-      // To break out of inner loop and skip the point
-      bool skip_point = false;
-      tnsr::I<double, VolumeDim, frame> sphere_coords_to_map{};
-      // Other code below expects block_logical_coords to be sized to the total
-      // number of points on the target (including all radii). By default these
-      // will all be nullopt and we'll only fill the ones we need
-      block_logical_coords.resize(get<0>(all_target_points).size());
-
-      const Block<VolumeDim>& block =
-          Parallel::get<domain::Tags::Domain<VolumeDim>>(cache)
-              .blocks()[array_index.block_id()];
-
-      // Now for every radius in this element, we check if their points are
-      // within the x,y,z bounds of the element. If they are, map the point to
-      // the block logical frame and add it to the vector f all block logical
-      // coordinates.
-      for (size_t index = 0; index < get<0>(target_points_to_check).size();
-           index++) {
-        skip_point = false;
-        for (size_t i = 0; i < VolumeDim; i++) {
-          const double coord = target_points_to_check.get(i)[index];
-          epsilon = (gsl::at(min_max_coordinates, i).second -
-                     gsl::at(min_max_coordinates, i).first) *
-                    std::numeric_limits<double>::epsilon() * 100.0;
-          // If a point is outside any of the bounding box, skip it
-          if (coord < (gsl::at(min_max_coordinates, i).first - epsilon) or
-              coord > (gsl::at(min_max_coordinates, i).second + epsilon)) {
-            skip_point = true;
-            break;
-          }
-
-          sphere_coords_to_map.get(i) = coord;
-        }
-
-        if (skip_point) {
-          continue;
-        }
-
-        std::optional<tnsr::I<double, VolumeDim, ::Frame::BlockLogical>>
-            block_coords_of_target_point{};
-
-        if constexpr (Parallel::is_in_global_cache<
-                          Metavariables, domain::Tags::FunctionsOfTime>) {
-          const auto& functions_of_time =
-              Parallel::get<domain::Tags::FunctionsOfTime>(cache);
-          const double time =
-              InterpolationTarget_detail::get_temporal_id_value(temporal_id);
-
-          block_coords_of_target_point = block_logical_coordinates_single_point(
-              sphere_coords_to_map, block, time, functions_of_time);
-        } else {
-          block_coords_of_target_point = block_logical_coordinates_single_point(
-              sphere_coords_to_map, block);
-        }
+    detail::interpolate_in_element<InterpolationTargetTag>(
+        cache, array_index,
+        get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(
+            point_infos),
+        temporal_id, mesh, coordinates, [&]() {
+          return interp_vars(temporal_id, mesh, source_vars_input..., cache,
+                             array_index);
+        });
+  }
 
-        if (block_coords_of_target_point.has_value()) {
-          // Get index into vector of all grid points of the target. This is
-          // just the offset + index
-          block_logical_coords[offset_and_num_points->first + index] =
-              make_id_pair(domain::BlockId(array_index.block_id()),
-                           std::move(block_coords_of_target_point.value()));
-        }
-      }
-    } else {
-      (void)coordinates;
-      block_logical_coords = InterpolationTarget_detail::block_logical_coords<
-          InterpolationTargetTag>(cache, all_target_points, temporal_id);
+  template <typename DbTags, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const Mesh<VolumeDim>& mesh,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
+      const typename SourceVarTags::type&... source_vars_input,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& array_index,
+      const ParallelComponent* const /*meta*/,
+      const ObservationValue& /*observation_value*/) const {
+    using point_infos_tag = Tags::InterpPointInfo<Metavariables>;
+    using points_tag = Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>;
+    const auto& points_at_temporal_ids =
+        get<points_tag>(db::get<point_infos_tag>(*box)).points;
+    if (const auto points = points_at_temporal_ids.find(temporal_id);
+        points != points_at_temporal_ids.end()) {
+      detail::interpolate_in_element<InterpolationTargetTag>(
+          cache, array_index, points->second, temporal_id, mesh, coordinates,
+          [&]() {
+            return interp_vars(temporal_id, mesh, source_vars_input..., cache,
+                               array_index);
+          });
+      db::mutate<point_infos_tag>(
+          [&temporal_id](const gsl::not_null<typename point_infos_tag::type*>
+                             point_infos) {
+            get<points_tag>(*point_infos).points.erase(temporal_id);
+          },
+          box);
+      return;
     }
+    // The points haven't arrived yet. Keep what is needed to interpolate to
+    // them, and ask the target for them. Since the event runs once per
+    // temporal id, every Element asks at most once.
+    db::mutate<point_infos_tag>(
+        [&](const gsl::not_null<typename point_infos_tag::type*> point_infos) {
+          get<points_tag>(*point_infos)
+              .volume_data.insert_or_assign(
+                  temporal_id,
+                  typename points_tag::type::VolumeData{
+                      mesh, coordinates,
+                      interp_vars(temporal_id, mesh, source_vars_input...,
+                                  cache, array_index)});
+        },
+        box);
+    auto& target_proxy = Parallel::get_parallel_component<
+        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+    Parallel::simple_action<
+        Actions::InterpolationTargetSendTimeDepPointsToElements<
+            InterpolationTargetTag>>(target_proxy, temporal_id);
+  }
 
-    const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
-    const auto element_coord_holders =
-        element_logical_coordinates(element_ids, block_logical_coords);
+  using is_ready_argument_tags = tmpl::list<>;
 
-    if (element_coord_holders.count(array_index) == 0) {
-      // There are no target points in this element, so we don't need
-      // to do anything.
-      return;
-    }
+  template <typename ArrayIndex, typename Component, typename Metavariables>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
 
-    // There are points in this element, so interpolate to them and
-    // send the interpolated data to the target.  This is done
-    // in several steps:
-    const auto& element_coord_holder = element_coord_holders.at(array_index);
+  bool needs_evolved_variables() const override { return true; }
 
-    // 1. Get the list of variables
+ private:
+  // The variables to interpolate to the target
+  template <typename Metavariables>
+  Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+  interp_vars(
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const Mesh<VolumeDim>& mesh,
+      const typename SourceVarTags::type&... source_vars_input,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& array_index) const {
     Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
-        interp_vars(mesh.number_of_grid_points());
+        result(mesh.number_of_grid_points());
 
     if constexpr (InterpolationTarget_detail::has_compute_vars_to_interpolate_v<
                       InterpolationTargetTag>) {
-      // 1a. Call compute_vars_to_interpolate.  Need the source in a
+      // Call compute_vars_to_interpolate.  Need the source in a
       // Variables, so copy the variables here.
       // This copy would be unnecessary if we passed a Variables into
       // InterpolateWithoutInterpComponent instead of passing
@@ -330,11 +255,11 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
                                     source_vars_input)...);
 
       InterpolationTarget_detail::compute_dest_vars_from_source_vars<
-          InterpolationTargetTag>(make_not_null(&interp_vars), source_vars,
+          InterpolationTargetTag>(make_not_null(&result), source_vars,
                                   get<domain::Tags::Domain<VolumeDim>>(cache),
                                   mesh, array_index, cache, temporal_id);
     } else {
-      // 1b. There is no compute_vars_to_interpolate. So copy the
+      // There is no compute_vars_to_interpolate. So copy the
       // source vars directly into the variables.
       // This copy would be unnecessary if:
       //   - We passed a Variables into InterpolateWithoutInterpComponent
@@ -348,44 +273,20 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       //     interpolate only a subset of the Variables passed into it,
       //     or IrregularInterpolant::interpolate can interpolate individual
       //     DataVectors.
+      (void)temporal_id;
+      (void)cache;
+      (void)array_index;
       [[maybe_unused]] const auto copy_to_variables =
-          [&interp_vars](const auto tensor_tag_v, const auto& tensor) {
+          [&result](const auto tensor_tag_v, const auto& tensor) {
             using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
-            get<tensor_tag>(interp_vars) = tensor;
+            get<tensor_tag>(result) = tensor;
             return 0;
           };
       expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
                                     source_vars_input)...);
     }
-
-    // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
-        mesh, element_coord_holder.element_logical_coords);
-
-    // 3. Interpolate and send interpolated data to target
-    auto& receiver_proxy = Parallel::get_parallel_component<
-        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
-    Parallel::simple_action<
-        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
-        receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
-        std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
-        temporal_id);
-  }
-
-  using is_ready_argument_tags = tmpl::list<>;
-
-  template <typename ArrayIndex, typename Component, typename Metavariables>
-  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
-                const ArrayIndex& /*array_index*/,
-                const Component* const /*meta*/) const {
-    return true;
+    return result;
   }
-
-  bool needs_evolved_variables() const override { return true; }
 };
 
 /// \cond
@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Interpolation/Events/InterpolateOnElement.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace intrp {
+/*!
+ * \brief The interpolation from the volume data of an element to the target
+ * points of an InterpolationTargetTag that lie in the element, precomputed
+ * for target points that don't move relative to the element.
+ *
+ * \details Locating the target points in the element and computing the
+ * barycentric interpolation weights (see `intrp::Irregular`) costs much more
+ * than applying the weights, so for target points that are fixed in the
+ * frame of the element both are done once with
+ * `intrp::make_interpolation_stencil` and the stencil is reused at every
+ * temporal id (see `intrp::interpolation_stencil_is_reusable`). The stencil
+ * holds all target points in the element, e.g. all radii of a
+ * `intrp::TargetPoints::Sphere` target, so the interpolated data is sent to
+ * the InterpolationTarget in a single message per element.
+ *
+ * The stencil is only valid for the `mesh` it was computed for.
+ */
+template <size_t Dim>
+struct InterpolationStencil {
+  /// The mesh of the element volume data
+  Mesh<Dim> mesh{};
+  /// The block logical coordinates of all target points, as needed by
+  /// `intrp::Actions::InterpolationTargetVarsFromElement`. Empty if there are
+  /// no target points in the element.
+  std::vector<BlockLogicalCoords<Dim>> block_logical_coords{};
+  /// The indices of the target points in the element into all target points
+  std::vector<size_t> offsets{};
+  /// The interpolation to the target points in the element
+  Irregular<Dim> interpolant{};
+
+  bool has_target_points() const { return not offsets.empty(); }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | mesh;
+    p | block_logical_coords;
+    p | offsets;
+    p | interpolant;
+  }
+};
+
+namespace Tags {
+/// The `intrp::InterpolationStencil` of an element for the
+/// InterpolationTargetTag, computed when it is first needed
+template <typename InterpolationTargetTag, size_t VolumeDim>
+struct InterpolationStencil : db::SimpleTag {
+  using type = std::optional<intrp::InterpolationStencil<VolumeDim>>;
+};
+}  // namespace Tags
+
+/*!
+ * \brief Whether the target points of the InterpolationTargetTag are at the
+ * same element logical coordinates at all temporal ids, so an
+ * `intrp::InterpolationStencil` can be reused.
+ *
+ * \details This is the case if the target points are time-independent in
+ * their frame, and their frame is the grid frame or the maps of the `domain`
+ * are time-independent.
+ */
+template <typename InterpolationTargetTag, size_t Dim>
+bool interpolation_stencil_is_reusable(const Domain<Dim>& domain) {
+  if constexpr (InterpolationTarget_detail::points_are_time_dependent_v<
+                    InterpolationTargetTag>) {
+    (void)domain;
+    return false;
+  } else if constexpr (std::is_same_v<typename InterpolationTargetTag::
+                                          compute_target_points::frame,
+                                      ::Frame::Grid>) {
+    (void)domain;
+    return true;
+  } else {
+    return not domain.is_time_dependent();
+  }
+}
+
+/*!
+ * \brief Locate the time-independent target points of the
+ * InterpolationTargetTag in the element `element_id` and compute the weights
+ * to interpolate the volume data on the `mesh` to them.
+ *
+ * \details The `coordinates` of the element's grid points and the
+ * `temporal_id` are only used to locate the target points in the element.
+ */
+template <typename InterpolationTargetTag, size_t Dim, typename Metavariables>
+InterpolationStencil<Dim> make_interpolation_stencil(
+    Parallel::GlobalCache<Metavariables>& cache, const Mesh<Dim>& mesh,
+    const tnsr::I<
+        DataVector, Dim,
+        typename InterpolationTargetTag::compute_target_points::frame>&
+        all_target_points,
+    const tnsr::I<
+        DataVector, Dim,
+        typename InterpolationTargetTag::compute_target_points::frame>&
+        coordinates,
+    const ElementId<Dim>& element_id,
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+  static_assert(not InterpolationTarget_detail::points_are_time_dependent_v<
+                    InterpolationTargetTag>,
+                "The target points must be time-independent.");
+  InterpolationStencil<Dim> stencil{};
+  stencil.mesh = mesh;
+  stencil.block_logical_coords =
+      Events::detail::block_logical_coords_in_element<InterpolationTargetTag>(
+          cache, all_target_points, coordinates, element_id, temporal_id);
+  const std::vector<ElementId<Dim>> element_ids{{element_id}};
+  const auto element_coord_holders =
+      element_logical_coordinates(element_ids, stencil.block_logical_coords);
+  if (element_coord_holders.count(element_id) == 0) {
+    // Don't keep the coordinates of points that are never sent
+    stencil.block_logical_coords.clear();
+    return stencil;
+  }
+  const auto& element_coord_holder = element_coord_holders.at(element_id);
+  stencil.offsets = element_coord_holder.offsets;
+  stencil.interpolant =
+      Irregular<Dim>(mesh, element_coord_holder.element_logical_coords);
+  return stencil;
+}
+}  // namespace intrp
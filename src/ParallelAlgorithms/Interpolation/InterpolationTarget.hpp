@@ -14,6 +14,7 @@
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetSendPoints.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
@@ -243,6 +244,21 @@ namespace intrp {
 /// ###### Current logic:
 ///
 /// > Send the result of `compute_target_points` to all `Element`s.
+/// > This is skipped for targets with time-dependent points.
+///
+/// ##### Actions::InterpolationTargetSendTimeDepPointsToElements
+///
+/// `Actions::InterpolationTargetSendTimeDepPointsToElements` is invoked on
+/// `InterpolationTarget` by `intrp::Events::InterpolateWithoutInterpComponent`
+/// for targets whose `InterpolationTargetTag` sets `points_are_time_dependent`
+/// to `std::true_type`, whenever an `Element` needs the points at a temporal
+/// id that it hasn't received yet.
+///
+/// ###### Current logic:
+///
+/// > On the first request at a temporal id, send the result of
+/// > `compute_target_points` at the temporal id to all `Element`s, which store
+/// > it until they interpolate at that temporal id. Ignore later requests.
 ///
 /// Note that this may need to be revisited because every `Element` has
 /// a copy of every target point, which may use a lot of memory.  An
@@ -281,7 +297,9 @@ struct InterpolationTarget {
           tmpl::list<
               tmpl::conditional_t<
                   InterpolationTargetTag::compute_target_points::is_sequential::
-                      value,
+                          value or
+                      InterpolationTarget_detail::points_are_time_dependent_v<
+                          InterpolationTargetTag>,
                   tmpl::list<>,
                   tmpl::list<
                       Actions::InterpolationTargetSendTimeIndepPointsToElements<
@@ -345,6 +345,11 @@ bool have_data_at_all_points(const db::DataBox<DbTags>& box,
 ///
 /// Currently one Action calls flag_temporal_ids_for_interpolation:
 /// - InterpolationTargetVarsFromElement (called by DgElementArray)
+///
+/// Newly flagged temporal_ids are removed from
+/// `Tags::PendingTemporalIds<TemporalId>`, where
+/// InterpolationTargetSendTimeDepPointsToElements records the temporal_ids
+/// whose points have been sent to the Elements.
 template <typename InterpolationTargetTag, typename DbTags, typename TemporalId>
 std::vector<TemporalId> flag_temporal_ids_for_interpolation(
     const gsl::not_null<db::DataBox<DbTags>*> box,
@@ -364,10 +369,12 @@ std::vector<TemporalId> flag_temporal_ids_for_interpolation(
   // `ids` or `completed_ids`.
   std::vector<TemporalId> new_temporal_ids{};
 
-  db::mutate_apply<tmpl::list<Tags::TemporalIds<TemporalId>>,
+  db::mutate_apply<tmpl::list<Tags::TemporalIds<TemporalId>,
+                              Tags::PendingTemporalIds<TemporalId>>,
                    tmpl::list<Tags::CompletedTemporalIds<TemporalId>>>(
       [&temporal_ids, &new_temporal_ids](
           const gsl::not_null<std::deque<TemporalId>*> ids,
+          const gsl::not_null<std::deque<TemporalId>*> pending_ids,
           const std::deque<TemporalId>& completed_ids) {
         for (auto& id : temporal_ids) {
           if (std::find(completed_ids.begin(), completed_ids.end(), id) ==
@@ -375,6 +382,9 @@ std::vector<TemporalId> flag_temporal_ids_for_interpolation(
               std::find(ids->begin(), ids->end(), id) == ids->end()) {
             ids->push_back(id);
             new_temporal_ids.push_back(id);
+            pending_ids->erase(
+                std::remove(pending_ids->begin(), pending_ids->end(), id),
+                pending_ids->end());
           }
         }
       },
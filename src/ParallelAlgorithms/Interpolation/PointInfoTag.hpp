@@ -3,27 +3,109 @@
 
 #pragma once
 
+#include <map>
 #include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <type_traits>
 #include <vector>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
-#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Structure/BlockId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
 
 namespace intrp {
+namespace InterpolationTarget_detail {
+CREATE_HAS_TYPE_ALIAS(points_are_time_dependent)
+CREATE_HAS_TYPE_ALIAS_V(points_are_time_dependent)
+
+template <typename InterpolationTargetTag,
+          bool HasAlias = has_points_are_time_dependent_v<
+              InterpolationTargetTag>>
+struct points_are_time_dependent : std::false_type {};
+
+template <typename InterpolationTargetTag>
+struct points_are_time_dependent<InterpolationTargetTag, true>
+    : InterpolationTargetTag::points_are_time_dependent {};
+
+/// True if the `InterpolationTargetTag` has a type alias
+/// `points_are_time_dependent` set to `std::true_type`, i.e. if its target
+/// points are sent to the `Element`s anew for each temporal id instead of
+/// once during registration.
+template <typename InterpolationTargetTag>
+constexpr bool points_are_time_dependent_v =
+    points_are_time_dependent<InterpolationTargetTag>::value;
+}  // namespace InterpolationTarget_detail
+
 namespace Vars {
+/*!
+ * \brief The target points an `Element` holds for an `InterpolationTargetTag`
+ * with time-dependent points
+ *
+ * \details The points at a temporal id and the `Element` reaching that
+ * temporal id can come in either order. Points that arrive first are held in
+ * `points` until the `Element` interpolates to them. If the `Element` reaches
+ * the temporal id first, it holds the variables to interpolate in
+ * `volume_data` until the points arrive.
+ */
+template <typename InterpolationTargetTag, size_t VolumeDim>
+struct TimeDependentPointInfo {
+  using temporal_id_type = typename InterpolationTargetTag::temporal_id::type;
+  using points_type =
+      tnsr::I<DataVector, VolumeDim,
+              typename InterpolationTargetTag::compute_target_points::frame>;
+
+  /// The variables to interpolate with the mesh and the coordinates of the
+  /// grid points in the frame of the target points
+  struct VolumeData {
+    Mesh<VolumeDim> mesh{};
+    points_type coordinates{};
+    Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+        vars{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) {
+      p | mesh;
+      p | coordinates;
+      p | vars;
+    }
+  };
+
+  std::map<temporal_id_type, points_type> points{};
+  std::map<temporal_id_type, VolumeData> volume_data{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | points;
+    p | volume_data;
+  }
+};
+
 /// PointInfoTag holds the points to be interpolated onto,
 /// in whatever frame those points are to be held constant.
-/// PointInfoTag is used only for interpolation points that are
-/// time-independent in some frame, so that there is no `Interpolator`
-/// ParallelComponent.
+/// PointInfoTag is used only when interpolation bypasses the
+/// `Interpolator` ParallelComponent.
+///
+/// If the points are time-independent in some frame, the type is simply
+/// the points. If the `InterpolationTargetTag` has time-dependent points
+/// (see `InterpolationTarget_detail::points_are_time_dependent_v`), the
+/// type is a `TimeDependentPointInfo`.
 template <typename InterpolationTargetTag, size_t VolumeDim>
 struct PointInfoTag {
-  using type =
+  using points_type =
       tnsr::I<DataVector, VolumeDim,
               typename InterpolationTargetTag::compute_target_points::frame>;
+  using type = tmpl::conditional_t<
+      InterpolationTarget_detail::points_are_time_dependent_v<
+          InterpolationTargetTag>,
+      TimeDependentPointInfo<InterpolationTargetTag, VolumeDim>, points_type>;
 };
 }  // namespace Vars
 
@@ -81,6 +81,15 @@ constexpr bool if_alias_exists_assert_conforms_to_v =
  *   be interpolating to the interpolation target. Only needed when *not* using
  *   the Interpolator ParallelComponent.
  *
+ * - a type alias `points_are_time_dependent` that is either `std::true_type`
+ *   or `std::false_type` (the default). Only used when *not* using the
+ *   Interpolator ParallelComponent. If true, the target points are not sent to
+ *   the `Element`s once during registration, but for every temporal id when
+ *   the `Element`s ask for them (see
+ *   intrp::Actions::InterpolationTargetSendTimeDepPointsToElements), so that
+ *   targets that move in every frame can interpolate without collecting
+ *   volume data in the Interpolator. Sequential targets are not supported.
+ *
  * An example of a struct that conforms to this protocol is
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp InterpolationTargetTag
@@ -84,36 +84,59 @@ tnsr::I<DataVector, 2, Frame::Spherical<Fr>> get_trace_christoffel_second_kind(
   // reimplement this code to avoid dividing by sin(theta).
   //
   // Note: ylm::Spherepack gradients are flat-space Pfaffian derivatives.
-  auto grad_surface_metric_theta_theta =
-      ylm.gradient(square(get(sin_theta)) * get<0, 0>(surface_metric));
-  get<0>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<1>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<0>(grad_surface_metric_theta_theta) -=
+  //
+  // The three components are differentiated together in a single pass of the
+  // spectral transforms. `fields` holds them one after another, and each
+  // component of `gradients` holds their derivatives in the same order.
+  const size_t num_points = ylm.physical_size();
+  DataVector fields{3 * num_points};
+  DataVector gradients{6 * num_points};
+  std::array<DataVector, 3> field{};
+  std::array<std::array<DataVector, 2>, 3> grad{};
+  for (size_t k = 0; k < 3; ++k) {
+    // clang-tidy: do not use pointer arithmetic
+    gsl::at(field, k).set_data_ref(fields.data() + k * num_points,  // NOLINT
+                                   num_points);
+    for (size_t d = 0; d < 2; ++d) {
+      gsl::at(gsl::at(grad, k), d)
+          .set_data_ref(gradients.data() + (3 * d + k) * num_points,  // NOLINT
+                        num_points);
+    }
+  }
+  field[0] = square(get(sin_theta)) * get<0, 0>(surface_metric);
+  field[1] = get(sin_theta) * get<0, 1>(surface_metric);
+  field[2] = get<1, 1>(surface_metric);
+  ylm.gradient_multiple_fields(
+      {{gradients.data(), gradients.data() + 3 * num_points}},  // NOLINT
+      fields.data(), 3);
+
+  auto& grad_surface_metric_theta_theta = grad[0];
+  grad_surface_metric_theta_theta[0] /= square(get(sin_theta));
+  grad_surface_metric_theta_theta[1] /= square(get(sin_theta));
+  grad_surface_metric_theta_theta[0] -=
       2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_theta_phi =
-      ylm.gradient(get(sin_theta) * get<0, 1>(surface_metric));
-
-  get<0>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<1>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<0>(grad_surface_metric_theta_phi) -=
+  auto& grad_surface_metric_theta_phi = grad[1];
+  grad_surface_metric_theta_phi[0] /= get(sin_theta);
+  grad_surface_metric_theta_phi[1] /= get(sin_theta);
+  grad_surface_metric_theta_phi[0] -=
       get<0, 1>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_phi_phi = ylm.gradient(get<1, 1>(surface_metric));
+  const auto& grad_surface_metric_phi_phi = grad[2];
 
   auto deriv_surface_metric =
       make_with_value<tnsr::ijj<DataVector, 2, Frame::Spherical<Fr>>>(
           get<0, 0>(surface_metric), 0.0);
   // Get the partial derivative of the metric from the Pfaffian derivative
-  get<0, 0, 0>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_theta);
+  get<0, 0, 0>(deriv_surface_metric) = grad_surface_metric_theta_theta[0];
   get<1, 0, 0>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_theta);
-  get<0, 0, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_phi);
+      get(sin_theta) * grad_surface_metric_theta_theta[1];
+  get<0, 0, 1>(deriv_surface_metric) = grad_surface_metric_theta_phi[0];
   get<1, 0, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_phi);
-  get<0, 1, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_theta_phi[1];
+  get<0, 1, 1>(deriv_surface_metric) = grad_surface_metric_phi_phi[0];
   get<1, 1, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_phi_phi[1];
 
   return trace_last_indices(
       raise_or_lower_first_index(
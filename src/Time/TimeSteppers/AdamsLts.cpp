@@ -4,10 +4,19 @@
 #include "Time/TimeSteppers/AdamsLts.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <boost/container/small_vector.hpp>
+#include <boost/container_hash/hash.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
@@ -22,6 +31,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Tracing.hpp"
 
 namespace TimeSteppers::adams_lts {
 Time exact_substep_time(const TimeStepId& id) {
@@ -301,19 +311,113 @@ LtsCoefficients lts_coefficients_for_gts(
   }
   return lts_coefficients;
 }
-}  // namespace
 
-template <typename TimeType>
-LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
-                                 const ConstBoundaryHistoryTimes& remote_times,
-                                 const Time& start_time,
-                                 const TimeType& end_time,
-                                 const AdamsScheme& local_scheme,
-                                 const AdamsScheme& remote_scheme,
-                                 const AdamsScheme& small_step_scheme) {
-  if (start_time == end_time) {
-    return {};
+// Everything lts_coefficients reads from its arguments, so equal keys
+// give identical coefficients.  The ids of both histories are stored
+// in one list, with the step ids followed by their substep ids.
+struct CacheKey {
+  boost::container::small_vector<TimeStepId,
+                                 4 * adams_coefficients::maximum_order>
+      ids{};
+  size_t number_of_local_ids{};
+  Time start_time{};
+  Time end_time{};
+  std::array<AdamsScheme, 3> schemes{};
+
+  CacheKey(const ConstBoundaryHistoryTimes& local_times,
+           const ConstBoundaryHistoryTimes& remote_times,
+           const Time& start_time_in, const Time& end_time_in,
+           const AdamsScheme& local_scheme, const AdamsScheme& remote_scheme,
+           const AdamsScheme& small_step_scheme)
+      : start_time(start_time_in),
+        end_time(end_time_in),
+        schemes{{local_scheme, remote_scheme, small_step_scheme}} {
+    const auto add_ids = [this](const ConstBoundaryHistoryTimes& times) {
+      for (size_t step = 0; step < times.size(); ++step) {
+        for (size_t substep = 0; substep < times.number_of_substeps(step);
+             ++substep) {
+          ids.push_back(times[{step, substep}]);
+        }
+      }
+    };
+    add_ids(local_times);
+    number_of_local_ids = ids.size();
+    add_ids(remote_times);
+  }
+};
+
+bool operator==(const CacheKey& a, const CacheKey& b) {
+  return a.number_of_local_ids == b.number_of_local_ids and
+         a.start_time == b.start_time and a.end_time == b.end_time and
+         a.schemes == b.schemes and a.ids == b.ids;
+}
+
+struct CacheKeyHash {
+  size_t operator()(const CacheKey& key) const {
+    size_t hash = boost::hash_range(key.ids.begin(), key.ids.end());
+    boost::hash_combine(hash, key.number_of_local_ids);
+    boost::hash_combine(hash, key.start_time);
+    boost::hash_combine(hash, key.end_time);
+    for (const auto& scheme : key.schemes) {
+      boost::hash_combine(hash, scheme.type);
+      boost::hash_combine(hash, scheme.order);
+    }
+    return hash;
   }
+};
+
+struct CacheEntry {
+  CacheEntry(LtsCoefficients coefficients_in, const uint64_t use)
+      : coefficients(std::move(coefficients_in)), last_use(use) {}
+
+  LtsCoefficients coefficients;
+  // Updated by lookups, which only hold a shared lock.
+  std::atomic<uint64_t> last_use;
+};
+
+struct CoefficientsCache {
+  std::shared_mutex mutex{};
+  std::unordered_map<CacheKey, CacheEntry, CacheKeyHash> entries{};
+  // Source of the unique, increasing use stamps of the entries.
+  std::atomic<uint64_t> uses{0};
+};
+
+// One cache per process, i.e., per node in SMP builds.
+CoefficientsCache& coefficients_cache() {
+  static CoefficientsCache cache{};
+  return cache;
+}
+
+// The keys contain the absolute times, so entries stop being used
+// once all elements have moved past them.  Entries are evicted in
+// batches of a quarter of the cache so that the scan for the least
+// recently used ones is amortized over many insertions.  Must be
+// called with the cache mutex held exclusively.
+void evict_least_recently_used(const gsl::not_null<CoefficientsCache*> cache) {
+  std::vector<uint64_t> last_uses{};
+  last_uses.reserve(cache->entries.size());
+  for (const auto& entry : cache->entries) {
+    last_uses.push_back(entry.second.last_use.load(std::memory_order_relaxed));
+  }
+  const auto cutoff =
+      last_uses.begin() +
+      static_cast<std::ptrdiff_t>(lts_coefficients_cache_capacity / 4);
+  std::nth_element(last_uses.begin(), cutoff, last_uses.end());
+  // The stamps are unique, so this removes exactly the entries before
+  // the cutoff.
+  const uint64_t oldest_kept_use = *cutoff;
+  std::erase_if(cache->entries, [&oldest_kept_use](const auto& entry) {
+    return entry.second.last_use.load(std::memory_order_relaxed) <
+           oldest_kept_use;
+  });
+}
+
+template <typename TimeType>
+LtsCoefficients compute_lts_coefficients(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const TimeType& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
   const evolution_less<Time> time_less{local_times.front().time_runs_forward()};
 
   LtsCoefficients step_coefficients{};
@@ -421,6 +525,62 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
   step_coefficients.erase(std::next(unique_entry), step_coefficients.end());
   return step_coefficients;
 }
+}  // namespace
+
+template <typename TimeType>
+LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
+                                 const ConstBoundaryHistoryTimes& remote_times,
+                                 const Time& start_time,
+                                 const TimeType& end_time,
+                                 const AdamsScheme& local_scheme,
+                                 const AdamsScheme& remote_scheme,
+                                 const AdamsScheme& small_step_scheme) {
+  if (start_time == end_time) {
+    return {};
+  }
+  if constexpr (std::is_same_v<TimeType, Time>) {
+    SPECTRE_TRACE_SCOPE("AdamsLts::CachedCoefficients");
+    CoefficientsCache& cache = coefficients_cache();
+    CacheKey key(local_times, remote_times, start_time, end_time,
+                 local_scheme, remote_scheme, small_step_scheme);
+    {
+      const std::shared_lock lock(cache.mutex);
+      const auto entry = cache.entries.find(key);
+      if (entry != cache.entries.end()) {
+        entry->second.last_use.store(
+            cache.uses.fetch_add(1, std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        return entry->second.coefficients;
+      }
+    }
+    auto coefficients = [&]() {
+      SPECTRE_TRACE_SCOPE("AdamsLts::CacheMiss");
+      return compute_lts_coefficients(local_times, remote_times, start_time,
+                                      end_time, local_scheme, remote_scheme,
+                                      small_step_scheme);
+    }();
+    const std::lock_guard lock(cache.mutex);
+    if (cache.entries.size() >= lts_coefficients_cache_capacity) {
+      evict_least_recently_used(make_not_null(&cache));
+    }
+    cache.entries.try_emplace(
+        std::move(key), coefficients,
+        cache.uses.fetch_add(1, std::memory_order_relaxed));
+    return coefficients;
+  } else {
+    // Dense output times are arbitrary, so these are unlikely to be
+    // reused.
+    return compute_lts_coefficients(local_times, remote_times, start_time,
+                                    end_time, local_scheme, remote_scheme,
+                                    small_step_scheme);
+  }
+}
+
+void reset_lts_coefficients_cache() {
+  CoefficientsCache& cache = coefficients_cache();
+  const std::lock_guard lock(cache.mutex);
+  cache.entries.clear();
+}
 
 #define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
@@ -114,6 +114,15 @@ bool operator!=(const AdamsScheme& a, const AdamsScheme& b);
  * times.  Any additional terms can be generated by a second call
  * treating the remainder of the step as non-dense.
  *
+ * Coefficients for steps ending at a `Time` are stored in a cache
+ * shared by all elements on the node, because all elements with the
+ * same step pattern at the same point of the evolution need the same
+ * coefficients.  The cache is keyed by the exact time step ids read
+ * from the histories, so cached results are identical to recomputed
+ * ones.  With tracing enabled, the `AdamsLts::CachedCoefficients`
+ * events count the cached calls and the `AdamsLts::CacheMiss` events
+ * the ones that computed the coefficients.
+ *
  * \tparam TimeType The type `Time` for a step aligned with the
  * control times or `ApproximateTime` for dense output.
  */
@@ -125,4 +134,12 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
                                  const AdamsScheme& local_scheme,
                                  const AdamsScheme& remote_scheme,
                                  const AdamsScheme& small_step_scheme);
+
+/// The number of step patterns kept in the `lts_coefficients` cache
+/// of each node.  When it is full, the least recently used quarter of
+/// the entries is evicted.
+constexpr size_t lts_coefficients_cache_capacity = 4096;
+
+/// Empty the `lts_coefficients` cache on this node.
+void reset_lts_coefficients_cache();
 }  // namespace TimeSteppers::adams_lts
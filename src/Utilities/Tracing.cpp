@@ -0,0 +1,171 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/Tracing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tracing {
+namespace detail {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> enabled{false};
+}  // namespace detail
+
+namespace {
+struct Event {
+  const char* name = nullptr;
+  std::int64_t start = 0;
+  std::int64_t end = 0;
+};
+
+struct Statistics {
+  size_t count = 0;
+  std::int64_t total = 0;
+  std::int64_t min = std::numeric_limits<std::int64_t>::max();
+  std::int64_t max = 0;
+};
+
+// The events of one thread. Only the owning thread writes to it, and it is
+// kept alive after the thread exits so its events can still be summarized.
+struct ThreadBuffer {
+  explicit ThreadBuffer(const size_t thread_index)
+      : thread(thread_index), events(ring_buffer_size) {}
+
+  size_t thread;
+  std::vector<Event> events;
+  size_t number_of_events = 0;
+  std::unordered_map<const char*, Statistics> statistics{};
+};
+
+struct Registry {
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers{};
+};
+
+Registry& registry() {
+  static Registry registry{};
+  return registry;
+}
+
+ThreadBuffer& local_buffer() {
+  thread_local ThreadBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    auto& the_registry = registry();
+    const std::lock_guard lock(the_registry.mutex);
+    the_registry.buffers.push_back(
+        std::make_unique<ThreadBuffer>(the_registry.buffers.size()));
+    buffer = the_registry.buffers.back().get();
+  }
+  return *buffer;
+}
+
+void write_json_string(std::ostream& os, const char* const str) {
+  os << '"';
+  for (const char* c = str; *c != '\0'; ++c) {  // NOLINT
+    if (*c == '"' or *c == '\\') {
+      os << '\\';
+    }
+    os << *c;
+  }
+  os << '"';
+}
+}  // namespace
+
+void set_enabled(const bool enable) {
+  detail::enabled.store(enable, std::memory_order_relaxed);
+}
+
+void record(const char* const name, const std::int64_t start,
+            const std::int64_t end) {
+  auto& buffer = local_buffer();
+  buffer.events[buffer.number_of_events % ring_buffer_size] =
+      Event{name, start, end};
+  ++buffer.number_of_events;
+  auto& statistics = buffer.statistics[name];
+  const std::int64_t duration = end - start;
+  ++statistics.count;
+  statistics.total += duration;
+  statistics.min = std::min(statistics.min, duration);
+  statistics.max = std::max(statistics.max, duration);
+}
+
+std::vector<Summary> summary() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  // The same name may have different addresses, e.g. string literals in
+  // different translation units, so combine the statistics by value.
+  std::map<std::pair<std::string, size_t>, Statistics> combined{};
+  for (const auto& buffer : the_registry.buffers) {
+    for (const auto& [name, statistics] : buffer->statistics) {
+      auto& entry = combined[std::make_pair(std::string{name}, buffer->thread)];
+      entry.count += statistics.count;
+      entry.total += statistics.total;
+      entry.min = std::min(entry.min, statistics.min);
+      entry.max = std::max(entry.max, statistics.max);
+    }
+  }
+  std::vector<Summary> result{};
+  result.reserve(combined.size());
+  for (const auto& [key, statistics] : combined) {
+    result.push_back(Summary{key.first, key.second, statistics.count,
+                             1.0e-9 * static_cast<double>(statistics.total),
+                             1.0e-9 * static_cast<double>(statistics.min),
+                             1.0e-9 * static_cast<double>(statistics.max)});
+  }
+  return result;
+}
+
+void write_chrome_trace(std::ostream& os, const size_t process_id) {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  bool first_event = true;
+  for (const auto& buffer : the_registry.buffers) {
+    const size_t number_of_events =
+        std::min(buffer->number_of_events, ring_buffer_size);
+    // Write the events in the order they were recorded, starting with the
+    // oldest one that has not been overwritten
+    for (size_t i = buffer->number_of_events - number_of_events;
+         i < buffer->number_of_events; ++i) {
+      const Event& event = buffer->events[i % ring_buffer_size];
+      os << (first_event ? "\n" : ",\n") << "{\"name\":";
+      write_json_string(os, event.name);
+      // Chrome traces are in microseconds
+      os << ",\"ph\":\"X\",\"ts\":"
+         << 1.0e-3 * static_cast<double>(event.start) << ",\"dur\":"
+         << 1.0e-3 * static_cast<double>(event.end - event.start)
+         << ",\"pid\":" << process_id << ",\"tid\":" << buffer->thread
+         << "}";
+      first_event = false;
+    }
+  }
+  os << "\n]}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void clear() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  for (auto& buffer : the_registry.buffers) {
+    buffer->number_of_events = 0;
+    buffer->statistics.clear();
+  }
+}
+}  // namespace tracing
@@ -0,0 +1,226 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines the low-overhead tracing of hot code paths
+
+#pragma once
+
+#include <atomic>
+#include <boost/preprocessor/cat.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Utilities/PrettyType.hpp"
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief Low-overhead tracing of where the wall time goes in hot code paths
+ *
+ * \details Code regions are traced with `SPECTRE_TRACE_SCOPE(name)`, which
+ * records the wall time from the macro to the end of the enclosing scope.
+ * The parallel algorithm additionally traces every iterable action and the
+ * time elements spend waiting for data in each action (see
+ * `tracing::IdleTimer`).
+ *
+ * Each thread records its events into its own ring buffer of
+ * `tracing::ring_buffer_size` events, so recording takes no lock. The ring
+ * buffer only holds the most recent events, which are used for a Chrome trace
+ * (see `tracing::write_chrome_trace`), but the per-thread statistics of each
+ * name (see `tracing::summary`) include all events.
+ *
+ * Tracing is compiled in by the CMake option `ENABLE_TRACING` (which defines
+ * `SPECTRE_TRACING`) and is off at runtime until `tracing::set_enabled` is
+ * called, so a disabled traced scope only costs a relaxed atomic load.
+ * Executables enable it with the `--trace-file-prefix` command-line option.
+ */
+namespace tracing {
+/// The number of events each thread keeps for the Chrome trace
+constexpr size_t ring_buffer_size = 65536;
+
+/// \cond
+namespace detail {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern std::atomic<bool> enabled;
+}  // namespace detail
+/// \endcond
+
+/// Whether events are recorded
+inline bool enabled() {
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// Start or stop recording events on all threads of this process
+void set_enabled(bool enable);
+
+/// Nanoseconds since an arbitrary but fixed point in time
+inline std::int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/*!
+ * \brief Record an event of this thread from `start` to `end`, as returned by
+ * `tracing::now()`
+ *
+ * \details The `name` must outlive the tracing data, e.g. a string literal or
+ * the result of `tracing::name`. Events are recorded even if tracing is
+ * disabled, so callers check `tracing::enabled()` first.
+ */
+void record(const char* name, std::int64_t start, std::int64_t end);
+
+/// Nanoseconds since the Unix epoch. Unlike `now()` this can be compared
+/// between processes, up to how well the clocks of the machines are
+/// synchronized.
+inline std::int64_t system_clock_now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+/*!
+ * \brief Record an event of this thread that started at `system_clock_start`,
+ * as returned by `tracing::system_clock_now()`, and ends now
+ *
+ * \details The start may have been taken on another process, e.g. to trace
+ * the latency of a message. The same restrictions as for `tracing::record`
+ * apply.
+ */
+inline void record_since(const char* name,
+                         const std::int64_t system_clock_start) {
+  const std::int64_t end = now();
+  record(name, end - (system_clock_now() - system_clock_start), end);
+}
+
+/// A name for tracing the type `T` that lives as long as the program
+template <typename T>
+const char* name() {
+  static const std::string name = pretty_type::name<T>();
+  return name.c_str();
+}
+
+/// Records an event from its construction to its destruction. Use
+/// `SPECTRE_TRACE_SCOPE` instead so the tracing can be compiled out.
+class ScopedEvent {
+ public:
+  explicit ScopedEvent(const char* name)
+      : name_(name), start_(enabled() ? now() : -1) {}
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+  ScopedEvent(ScopedEvent&&) = delete;
+  ScopedEvent& operator=(ScopedEvent&&) = delete;
+  ~ScopedEvent() {
+    if (start_ >= 0) {
+      record(name_, start_, now());
+    }
+  }
+
+ private:
+  const char* name_;
+  std::int64_t start_;
+};
+
+/// The name of the event for the time spent waiting for data in the iterable
+/// action `Action`, i.e. `Waiting(<action name>)`
+template <typename Action>
+const char* waiting_name() {
+  static const std::string name =
+      "Waiting(" + pretty_type::name<Action>() + ")";
+  return name.c_str();
+}
+
+/*!
+ * \brief Measures the time an element of a parallel component spends idle,
+ * e.g. from an iterable action returning `Parallel::AlgorithmExecution::Retry`
+ * until the algorithm is restarted by receiving data.
+ *
+ * \details The event is named when the timer is started, so the parallel
+ * algorithm reports the time blocked in each action separately (see
+ * `tracing::waiting_name`), e.g. the time an element waits for the boundary
+ * data of its neighbors. Does nothing if `SPECTRE_TRACING` is not defined. The
+ * timer is not serialized, so the idle time during a migration is not
+ * recorded.
+ */
+class IdleTimer {
+ public:
+  /// Start the timer for the event `name` if tracing is enabled and the timer
+  /// is not running
+  void start(const char* name) {
+#ifdef SPECTRE_TRACING
+    if (start_ < 0 and enabled()) {
+      name_ = name;
+      start_ = now();
+    }
+#else
+    (void)name;
+#endif  // SPECTRE_TRACING
+  }
+
+  /// Record the time since `start()`, if the timer is running
+  void stop() {
+#ifdef SPECTRE_TRACING
+    if (start_ >= 0) {
+      record(name_, start_, now());
+      start_ = -1;
+    }
+#endif  // SPECTRE_TRACING
+  }
+
+ private:
+  const char* name_ = nullptr;
+  std::int64_t start_ = -1;
+};
+
+/// Statistics of the events with the same name on one thread
+struct Summary {
+  std::string name;
+  size_t thread = 0;
+  size_t count = 0;
+  double total_seconds = 0.0;
+  double min_seconds = 0.0;
+  double max_seconds = 0.0;
+};
+
+/*!
+ * \brief The statistics of all recorded events of this process, ordered by
+ * name and thread
+ *
+ * \details Must not be called while events are recorded, e.g. only once the
+ * algorithm has finished.
+ */
+std::vector<Summary> summary();
+
+/*!
+ * \brief Write the events in the ring buffers of this process as a Chrome
+ * trace (the JSON "Trace Event Format", viewable with `chrome://tracing` or
+ * Perfetto) with process id `process_id`.
+ *
+ * \details Must not be called while events are recorded.
+ */
+void write_chrome_trace(std::ostream& os, size_t process_id);
+
+/// Discard all recorded events. Must not be called while events are recorded.
+void clear();
+}  // namespace tracing
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief Trace the wall time spent from here until the end of the scope as
+ * the event `name` (see `tracing`)
+ *
+ * \details Expands to nothing unless `SPECTRE_TRACING` is defined. The `name`
+ * must be a string literal or another string that outlives the program, such
+ * as `tracing::name<T>()`.
+ */
+#ifdef SPECTRE_TRACING
+#define SPECTRE_TRACE_SCOPE(name)                                 \
+  const ::tracing::ScopedEvent BOOST_PP_CAT(spectre_trace_scope_, \
+                                            __LINE__)(name)
+#else
+#define SPECTRE_TRACE_SCOPE(name) static_cast<void>(0)
+#endif  // SPECTRE_TRACING
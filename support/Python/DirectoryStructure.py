@@ -30,6 +30,11 @@ class Checkpoint:
     WARNING: Don't assume checkpoints always exist in the above directory
     structure. You don't want your code to break when checkpoints are copied,
     moved around, or renamed.
+
+    Once a checkpoint is completely written, the executable places the file
+    'CheckpointComplete' into its directory. Checkpoints that are moved to
+    their directory in the background (see the '--checkpoint-staging-dir'
+    option of the executables) are incomplete until then.
     """
 
     path: Path
@@ -37,6 +42,12 @@ class Checkpoint:
 
     NAME_PATTERN = re.compile(r"Checkpoint_(\d+)")
     NUM_DIGITS = 4
+    COMPLETION_MARKER = "CheckpointComplete"
+
+    @property
+    def is_complete(self) -> bool:
+        """Whether the executable has finished writing this checkpoint"""
+        return (self.path / self.COMPLETION_MARKER).exists()
 
     @classmethod
     def match(cls, path: Union[str, Path]) -> Optional["Checkpoint"]:
@@ -57,6 +68,21 @@ def list_checkpoints(checkpoints_dir: Union[str, Path]) -> List[Checkpoint]:
     return sorted(match for match in matches if match)
 
 
+def last_complete_checkpoint(checkpoints: List[Checkpoint]) -> Checkpoint:
+    """The last of the 'checkpoints' that was written completely
+
+    Checkpoints written by older versions of the executables have no completion
+    marker, so if none of the 'checkpoints' has one the last checkpoint is
+    returned.
+    """
+    complete_checkpoints = [
+        checkpoint for checkpoint in checkpoints if checkpoint.is_complete
+    ]
+    if complete_checkpoints:
+        return complete_checkpoints[-1]
+    return checkpoints[-1]
+
+
 @dataclass(frozen=True, order=True)
 class Segment:
     """Part of a simulation that ran as one executable invocation
@@ -21,6 +21,7 @@ from yaml.representer import SafeRepresenter
 from spectre.support.DirectoryStructure import (
     Checkpoint,
     Segment,
+    last_complete_checkpoint,
     list_checkpoints,
     list_segments,
 )
@@ -505,7 +506,7 @@ def schedule(
             " and use '--from-last-checkpoint SEGMENTS_DIR' to continue from"
             " the latest segment."
         )
-        last_checkpoint = last_segment_checkpoints[-1]
+        last_checkpoint = last_complete_checkpoint(last_segment_checkpoints)
         assert from_checkpoint == last_checkpoint.path.resolve(), (
             "You're not continuing from the previous segment's last checkpoint"
             f" ({last_checkpoint.path}). This is technically possible, but"
@@ -994,7 +995,10 @@ def scheduler_options(f):
         readable=True,
         path_type=Path,
     ),
-    help="Restart from the last checkpoint in this directory.",
+    help=(
+        "Restart from the last checkpoint in this directory. Checkpoints that"
+        " were not written completely are skipped."
+    ),
 )
 def schedule_command(
     from_checkpoint,
@@ -1025,7 +1029,7 @@ def schedule_command(
                 f"Directory '{from_last_checkpoint}' contains no checkpoints "
                 f"that match the pattern '{Checkpoint.NAME_PATTERN.pattern}'."
             )
-        from_checkpoint = all_checkpoints[-1]
+        from_checkpoint = last_complete_checkpoint(all_checkpoints)
     schedule(from_checkpoint=from_checkpoint, **kwargs)
 
 
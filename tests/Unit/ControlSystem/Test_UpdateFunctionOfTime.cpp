@@ -5,10 +5,12 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "ControlSystem/Tags/MeasurementTimescales.hpp"
 #include "ControlSystem/Tags/SystemTags.hpp"
@@ -24,9 +26,11 @@
 #include "Framework/ActionTesting.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/CloneUniquePtrs.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/Tracing.hpp"
 
 namespace {
 struct System1 {
@@ -147,7 +151,7 @@ void test_mutates() {
 
   Parallel::mutate<domain::Tags::FunctionsOfTime,
                    control_system::UpdateMultipleFunctionsOfTime>(
-      cache, update_time, std::move(update_args));
+      cache, update_time, std::move(update_args), std::int64_t{-1});
 
   expected_pp.update(update_time, updated_deriv, expiration_time);
   expected_quatfot.update(update_time, updated_deriv, expiration_time);
@@ -186,33 +190,36 @@ void test_update_aggregator() {
   CHECK(aggregator.combined_name() == combined_name);
 
   aggregator.insert("Wisconsin", DataVector{1.0}, 10.0, signals.at("Wisconsin"),
-                    5.0);
+                    5.0, -1);
   CHECK_FALSE(aggregator.is_ready());
-  aggregator.insert("Texas", DataVector{2.0}, 9.0, signals.at("Texas"), 4.0);
+  aggregator.insert("Texas", DataVector{2.0}, 9.0, signals.at("Texas"), 4.0,
+                    300);
   CHECK_FALSE(aggregator.is_ready());
   aggregator.insert("Illinois", DataVector{3.0}, 8.0, signals.at("Illinois"),
-                    3.0);
+                    3.0, 100);
   CHECK_FALSE(aggregator.is_ready());
   aggregator.insert("Florida", DataVector{4.0}, 7.0, signals.at("Florida"),
-                    2.0);
+                    2.0, 200);
   CHECK_FALSE(aggregator.is_ready());
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
-      aggregator.insert("Florida", DataVector{}, 1.0, DataVector{}, 1.0),
+      aggregator.insert("Florida", DataVector{}, 1.0, DataVector{}, 1.0, -1),
       Catch::Matchers::ContainsSubstring("Already received expiration time "
                                          "data for control system 'Florida'"));
   CHECK_THROWS_WITH(
-      aggregator.insert("Alaska", DataVector{}, 1.0, DataVector{}, 1.0),
+      aggregator.insert("Alaska", DataVector{}, 1.0, DataVector{}, 1.0, -1),
       Catch::Matchers::ContainsSubstring("Received expiration time data for a "
                                          "non-active control system 'Alaska'"));
 #endif
   aggregator.insert("California", DataVector{5.0}, 6.0,
-                    signals.at("California"), 1.0);
+                    signals.at("California"), 1.0, -1);
   CHECK(aggregator.is_ready());
 
   const std::unordered_map<std::string, std::pair<DataVector, double>>
       combined_fot = aggregator.combined_fot_expiration_times();
   CHECK(aggregator.is_ready());
+  // The wall times that weren't taken (-1) are ignored
+  CHECK(aggregator.earliest_measurement_wall_time() == 100);
   const std::pair<double, double> combined_measurements =
       aggregator.combined_measurement_expiration_time();
   CHECK_FALSE(aggregator.is_ready());
@@ -225,6 +232,12 @@ void test_update_aggregator() {
   }
 
   CHECK(combined_measurements == std::make_pair(1.0, 6.0));
+
+  // The wall times of one update are not used for the next one
+  for (const auto& name : names) {
+    aggregator.insert(name, DataVector{1.0}, 1.0, signals.at(name), 1.0, -1);
+  }
+  CHECK(aggregator.earliest_measurement_wall_time() == -1);
 }
 
 struct AggregatorMetavariables {
@@ -373,7 +386,8 @@ void test_aggregate_update_action() {
                                       control_system::AggregateUpdate<System1>>(
             make_not_null(&runner), 0_st, new_measurement_timescale1,
             old_measurement_expiration13, new_measurement_expiration1,
-            control_signal, old_fot_expiration13, new_fot_expiration1)),
+            control_signal, old_fot_expiration13, new_fot_expiration1,
+            std::int64_t{-1})),
         Catch::Matchers::ContainsSubstring(
             "Expected name 'FoT1' to be in map of system-to-combined names, "
             "but it wasn't."));
@@ -392,7 +406,8 @@ void test_aggregate_update_action() {
                                       control_system::AggregateUpdate<System1>>(
             make_not_null(&runner), 0_st, new_measurement_timescale1,
             old_measurement_expiration13, new_measurement_expiration1,
-            control_signal, old_fot_expiration13, new_fot_expiration1)),
+            control_signal, old_fot_expiration13, new_fot_expiration1,
+            std::int64_t{-1})),
         Catch::Matchers::ContainsSubstring(
             "Expected combined name 'FoT1FoT3' to be in map of aggregators, "
             "but it wasn't."));
@@ -421,12 +436,20 @@ void test_aggregate_update_action() {
   CHECK(box_aggregators_component2.empty());
   CHECK(box_aggregators_component3.empty());
 
+#ifdef SPECTRE_TRACING
+  tracing::clear();
+  tracing::set_enabled(true);
+#endif  // SPECTRE_TRACING
+  // Pretend the measurements were processed 1ms ago
+  const std::int64_t measurement_wall_time =
+      tracing::system_clock_now() - 1000000;
+
   // Update one of the two functions of time for the 13 measurement
   ActionTesting::simple_action<component1,
                                control_system::AggregateUpdate<System1>>(
       make_not_null(&runner), 0_st, new_measurement_timescale1,
       old_measurement_expiration13, new_measurement_expiration1, control_signal,
-      old_fot_expiration13, new_fot_expiration1);
+      old_fot_expiration13, new_fot_expiration1, measurement_wall_time);
 
   CHECK_FALSE(box_aggregator13.is_ready());
   CHECK_FALSE(box_aggregator2.is_ready());
@@ -439,7 +462,7 @@ void test_aggregate_update_action() {
                                control_system::AggregateUpdate<System2>>(
       make_not_null(&runner), 0_st, new_measurement_timescale2,
       old_measurement_expiration2, new_measurement_expiration2, control_signal,
-      old_fot_expiration2, new_fot_expiration2);
+      old_fot_expiration2, new_fot_expiration2, std::int64_t{-1});
 
   CHECK_FALSE(box_aggregator13.is_ready());
   CHECK_FALSE(box_aggregator2.is_ready());
@@ -479,7 +502,7 @@ void test_aggregate_update_action() {
                                control_system::AggregateUpdate<System3>>(
       make_not_null(&runner), 0_st, new_measurement_timescale3,
       old_measurement_expiration13, new_measurement_expiration3, control_signal,
-      old_fot_expiration13, new_fot_expiration3);
+      old_fot_expiration13, new_fot_expiration3, std::int64_t{-1});
 
   CHECK_FALSE(box_aggregator13.is_ready());
   CHECK_FALSE(box_aggregator2.is_ready());
@@ -497,6 +520,20 @@ void test_aggregate_update_action() {
   check_equal("FoT1", functions_of_time, expected_f_of_t_map);
   check_equal("FoT3", functions_of_time, expected_f_of_t_map);
   check_equal("FoT1FoT3", measurement_timescales, expected_measurement_map);
+
+#ifdef SPECTRE_TRACING
+  // Only the update of FoT1 and FoT3 had a measurement wall time, so the
+  // latency was traced once, when the mutation completed
+  tracing::set_enabled(false);
+  const std::vector<tracing::Summary> summary = tracing::summary();
+  const auto latency = alg::find_if(summary, [](const tracing::Summary& s) {
+    return s.name == "ControlSystem::UpdateLatency";
+  });
+  REQUIRE(latency != summary.end());
+  CHECK(latency->count == 1);
+  CHECK(latency->min_seconds >= 1.0e-3);
+  tracing::clear();
+#endif  // SPECTRE_TRACING
 }
 
 SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionOfTime",
@@ -2982,12 +2982,35 @@ void serialization_of_pointers() {
         &db::get<test_databox_tags::Pointer>(box));
 }
 
+void move_items() {
+  INFO("Moving items out of a DataBox");
+  auto box = db::create<
+      db::AddSimpleTags<test_databox_tags::Tag1, test_databox_tags::Pointer>,
+      db::AddComputeTags<test_databox_tags::PointerToCounterCompute>>(
+      std::vector<double>{8.7, 93.2, 84.7}, std::make_unique<int>(3));
+  CHECK(db::get<test_databox_tags::PointerToCounter>(box) == 4);
+  const double* const vector_data =
+      db::get<test_databox_tags::Tag1>(box).data();
+  const int* const pointer = &db::get<test_databox_tags::Pointer>(box);
+
+  auto moved_items = db::move_items<
+      tmpl::list<test_databox_tags::Tag1, test_databox_tags::Pointer>>(
+      make_not_null(&box));
+  CHECK(get<test_databox_tags::Tag1>(moved_items) ==
+        std::vector<double>{8.7, 93.2, 84.7});
+  CHECK(*get<test_databox_tags::Pointer>(moved_items) == 3);
+  // The data was handed over, not copied
+  CHECK(get<test_databox_tags::Tag1>(moved_items).data() == vector_data);
+  CHECK(get<test_databox_tags::Pointer>(moved_items).get() == pointer);
+}
+
 void test_serialization_and_copy_items() {
   serialization_non_subitem_simple_items();
   serialization_subitems_simple_items();
   serialization_subitem_compute_items();
   serialization_compute_items_of_base_tags();
   serialization_of_pointers();
+  move_items();
 }
 
 namespace test_databox_tags {
@@ -6,14 +6,18 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <random>
 #include <string>
 #include <utility>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ExtractPoint.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -181,6 +185,29 @@ void verify_det_and_inv_symmetric_4d() {
   CHECK((get<3, 2>(det_inv.second)) == approx(-0.38));
   CHECK((get<3, 3>(det_inv.second)) == approx(0.16));
 }
+
+// Compares the pointwise kernel used for Tensor<DataVector> against the
+// Tensor<double> implementation at every point. The number of points is chosen
+// so that there is a remainder after the SIMD batches.
+template <typename TensorType>
+void verify_det_and_inv_pointwise(
+    const gsl::not_null<std::mt19937*> generator) {
+  constexpr size_t dim = tmpl::front<typename TensorType::index_list>::dim;
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  const DataVector used_for_size(13);
+  auto t = make_with_random_values<TensorType>(
+      generator, make_not_null(&distribution), used_for_size);
+  // Make the tensor diagonally dominant so it is well conditioned
+  for (size_t i = 0; i < dim; ++i) {
+    t.get(i, i) += 4.0;
+  }
+  const auto det_inv = determinant_and_inverse(t);
+  for (size_t s = 0; s < used_for_size.size(); ++s) {
+    const auto expected = determinant_and_inverse(extract_point(t, s));
+    CHECK(get(det_inv.first)[s] == approx(get(expected.first)));
+    CHECK_ITERABLE_APPROX(extract_point(det_inv.second, s), expected.second);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.EagerMath.DeterminantAndInverse",
@@ -235,6 +262,22 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.EagerMath.DeterminantAndInverse",
     verify_det_and_inv_generic_4d<tnsr::ab<double, 3, Frame::Grid>>();
   }
 
+  // Check the pointwise kernel used for 3x3 and 4x4 Tensor<DataVector>.
+  {
+    MAKE_GENERATOR(generator);
+    verify_det_and_inv_pointwise<tnsr::ii<DataVector, 3, Frame::Grid>>(
+        make_not_null(&generator));
+    verify_det_and_inv_pointwise<tnsr::ij<DataVector, 3, Frame::Grid>>(
+        make_not_null(&generator));
+    verify_det_and_inv_pointwise<
+        tnsr_iJ<DataVector, 3, Frame::Grid, Frame::Inertial>>(
+        make_not_null(&generator));
+    verify_det_and_inv_pointwise<tnsr::aa<DataVector, 3, Frame::Grid>>(
+        make_not_null(&generator));
+    verify_det_and_inv_pointwise<tnsr::ab<DataVector, 3, Frame::Grid>>(
+        make_not_null(&generator));
+  }
+
   // Check paired determinant and inverse for a Tensor<DataVector>.
   {
     tnsr::ij<DataVector, 2, Frame::Grid> t{};
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+#include <tuple>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/Expressions/EvaluateFused.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+using TmpUpTag = ::Tags::TempTensor<0, tnsr::I<DataVector, 3>>;
+
+template <size_t BlockSize>
+void test_evaluate_fused(const gsl::not_null<std::mt19937*> generator,
+                         const size_t number_of_points) {
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  const DataVector used_for_size(number_of_points);
+
+  const auto lapse = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto inverse_spatial_metric =
+      make_with_random_values<tnsr::II<DataVector, 3>>(
+          generator, make_not_null(&distribution), used_for_size);
+  const auto one_form = make_with_random_values<tnsr::i<DataVector, 3>>(
+      generator, make_not_null(&distribution), used_for_size);
+
+  const auto expected_raised = tenex::evaluate<ti::I>(
+      lapse() * inverse_spatial_metric(ti::I, ti::J) * one_form(ti::j));
+  const auto expected_square = tenex::evaluate(
+      inverse_spatial_metric(ti::I, ti::J) * one_form(ti::i) * one_form(ti::j));
+
+  tnsr::I<DataVector, 3> raised{};
+  Scalar<DataVector> square{};
+  // [use_evaluate_fused]
+  tenex::evaluate_fused<tmpl::list<TmpUpTag>, BlockSize>(
+      [](const gsl::not_null<Variables<tmpl::list<TmpUpTag>>*> temporaries,
+         const gsl::not_null<tnsr::I<DataVector, 3>*> local_raised,
+         const gsl::not_null<Scalar<DataVector>*> local_square,
+         const Scalar<DataVector>& local_lapse,
+         const tnsr::II<DataVector, 3>& local_inverse_spatial_metric,
+         const tnsr::i<DataVector, 3>& local_one_form) {
+        // Common subexpression shared by both equations
+        auto& one_form_up = get<TmpUpTag>(*temporaries);
+        tenex::evaluate<ti::I>(
+            make_not_null(&one_form_up),
+            local_inverse_spatial_metric(ti::I, ti::J) * local_one_form(ti::j));
+        tenex::evaluate<ti::I>(local_raised,
+                               local_lapse() * one_form_up(ti::I));
+        tenex::evaluate(local_square,
+                        one_form_up(ti::I) * local_one_form(ti::i));
+      },
+      std::make_tuple(make_not_null(&raised), make_not_null(&square)), lapse,
+      inverse_spatial_metric, one_form);
+  // [use_evaluate_fused]
+
+  CHECK_ITERABLE_APPROX(raised, expected_raised);
+  CHECK_ITERABLE_APPROX(square, expected_square);
+
+  // Without temporaries, and with an LHS that is already sized
+  tenex::evaluate_fused<tmpl::list<>, BlockSize>(
+      [](const gsl::not_null<Variables<tmpl::list<>>*> /*temporaries*/,
+         const gsl::not_null<Scalar<DataVector>*> local_square,
+         const tnsr::II<DataVector, 3>& local_inverse_spatial_metric,
+         const tnsr::i<DataVector, 3>& local_one_form) {
+        tenex::evaluate(local_square,
+                        local_inverse_spatial_metric(ti::I, ti::J) *
+                            local_one_form(ti::i) * local_one_form(ti::j));
+      },
+      std::make_tuple(make_not_null(&square)), inverse_spatial_metric,
+      one_form);
+  CHECK_ITERABLE_APPROX(square, expected_square);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.EvaluateFused",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(generator);
+  // Fewer points than a block, an exact multiple of the block size and a
+  // partial final block
+  test_evaluate_fused<tenex::default_fused_block_size>(
+      make_not_null(&generator), 5);
+  test_evaluate_fused<8>(make_not_null(&generator), 32);
+  test_evaluate_fused<8>(make_not_null(&generator), 37);
+  test_evaluate_fused<tenex::default_fused_block_size>(
+      make_not_null(&generator), 300);
+}
@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/SliceIterator.hpp"
+#include "DataStructures/SliceLayout.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <typename T, size_t Dim>
+void test_slice_layout(const Index<Dim>& extents) {
+  CAPTURE(extents);
+  const size_t number_of_components = 3;
+  // Use strides larger than the number of points to check that the kernels
+  // don't touch the padding between the components
+  const size_t volume_stride = extents.product() + 2;
+  std::vector<T> volume_data(number_of_components * volume_stride);
+  for (size_t i = 0; i < volume_data.size(); ++i) {
+    volume_data[i] = T{static_cast<double>(i) + 1.0};
+  }
+
+  for (size_t d = 0; d < Dim; ++d) {
+    for (const size_t fixed_index : {size_t{0}, extents[d] - 1}) {
+      CAPTURE(d);
+      CAPTURE(fixed_index);
+      const SliceLayout layout(extents, d, fixed_index);
+      const size_t slice_points = extents.slice_away(d).product();
+      CHECK(layout.number_of_slice_points() == slice_points);
+      const size_t slice_stride = slice_points + 1;
+
+      std::vector<T> expected_slice(number_of_components * slice_stride, T{0});
+      for (SliceIterator si(extents, d, fixed_index); si; ++si) {
+        for (size_t i = 0; i < number_of_components; ++i) {
+          expected_slice[si.slice_offset() + i * slice_stride] =
+              volume_data[si.volume_offset() + i * volume_stride];
+        }
+      }
+      std::vector<T> slice(number_of_components * slice_stride, T{0});
+      layout.gather(make_not_null(slice.data()), slice_stride,
+                    volume_data.data(), volume_stride, number_of_components);
+      CHECK(slice == expected_slice);
+
+      auto expected_volume = volume_data;
+      for (SliceIterator si(extents, d, fixed_index); si; ++si) {
+        for (size_t i = 0; i < number_of_components; ++i) {
+          expected_volume[si.volume_offset() + i * volume_stride] +=
+              slice[si.slice_offset() + i * slice_stride];
+        }
+      }
+      auto volume = volume_data;
+      layout.add_to_volume(make_not_null(volume.data()), volume_stride,
+                           slice.data(), slice_stride, number_of_components);
+      CHECK(volume == expected_volume);
+    }
+  }
+}
+
+template <typename T>
+void test() {
+  test_slice_layout<T>(Index<1>{4});
+  test_slice_layout<T>(Index<2>{3, 4});
+  test_slice_layout<T>(Index<2>{1, 5});
+  test_slice_layout<T>(Index<3>{3, 4, 5});
+  test_slice_layout<T>(Index<3>{2, 2, 2});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.SliceLayout", "[DataStructures][Unit]") {
+  const SliceLayout layout(Index<3>{3, 4, 5}, 1, 2);
+  CHECK(layout.run_length() == 3);
+  CHECK(layout.number_of_runs() == 5);
+  CHECK(layout.run_stride() == 12);
+  CHECK(layout.initial_offset() == 6);
+  CHECK(layout.number_of_slice_points() == 15);
+
+  test<double>();
+  test<std::complex<double>>();
+}
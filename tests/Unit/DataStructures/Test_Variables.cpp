@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <random>
 #include <string>
 #include <tuple>
@@ -1343,6 +1344,25 @@ void test_set_number_of_grid_points() {
   CHECK(resized_vector.size() == num_points);
 }
 
+template <typename VectorType>
+void test_variables_alignment() {
+  INFO(pretty_type::short_name<VectorType>());
+  using Vars = Variables<tmpl::list<TestHelpers::Tags::Vector<VectorType>,
+                                    TestHelpers::Tags::Scalar<VectorType>>>;
+  const auto is_aligned = [](const auto* const pointer) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<std::uintptr_t>(pointer) % 64 == 0;
+  };
+  for (const size_t num_points : {2_st, 5_st, 27_st, 125_st}) {
+    Vars vars(num_points);
+    CHECK(is_aligned(vars.data()));
+    vars.initialize(num_points + 3);
+    CHECK(is_aligned(vars.data()));
+    const Vars copy{vars};
+    CHECK(is_aligned(copy.data()));
+  }
+}
+
 void test_asserts() {
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
@@ -1432,6 +1452,12 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
     test_variables_prefix_math<ModalVector>();
   }
 
+  {
+    INFO("Test Variables alignment");
+    test_variables_alignment<ComplexDataVector>();
+    test_variables_alignment<DataVector>();
+  }
+
   {
     INFO("Test Variables serialization");
     test_variables_serialization<ComplexDataVector>();
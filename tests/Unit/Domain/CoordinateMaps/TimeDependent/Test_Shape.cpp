@@ -11,10 +11,12 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/Shape.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/RegisterDerivedWithCharm.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
@@ -486,6 +488,36 @@ void test_analytical_jacobian(const TransitionFunction& transition_func,
       target_data, center, l_max, m_max, random_coefs, random_00_coef,
       transition_func);
   CHECK_ITERABLE_APPROX(mapped_jacobian, analytical_jacobian);
+
+  // The analytic inverse Jacobian uses the cached interpolation info for
+  // `target_data`
+  CHECK_ITERABLE_APPROX(map.inv_jacobian(target_data, time, functions_of_time),
+                        determinant_and_inverse(mapped_jacobian).second);
+
+  // Evaluating the map at different points must not use the cached
+  // interpolation info, and evaluating it at `target_data` again must give
+  // the same results.
+  const std::array<double, 3> first_point{
+      {target_data[0][0], target_data[1][0], target_data[2][0]}};
+  const std::array<DataVector, 3> first_point_data{
+      {DataVector{first_point[0]}, DataVector{first_point[1]},
+       DataVector{first_point[2]}}};
+  const auto first_point_mapped =
+      map(first_point_data, time, functions_of_time);
+  const auto first_point_expected = map(first_point, time, functions_of_time);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK(gsl::at(first_point_mapped, i)[0] ==
+          approx(gsl::at(first_point_expected, i)));
+  }
+  const auto first_point_jacobian =
+      map.jacobian(first_point_data, time, functions_of_time);
+  const auto first_point_expected_jacobian =
+      map.jacobian(first_point, time, functions_of_time);
+  for (size_t i = 0; i < first_point_jacobian.size(); ++i) {
+    CHECK(first_point_jacobian[i][0] ==
+          approx(first_point_expected_jacobian[i]));
+  }
+  CHECK(map.jacobian(target_data, time, functions_of_time) == mapped_jacobian);
 }
 
 template <typename Generator>
@@ -537,6 +569,89 @@ void test_inverse(const gsl::not_null<Generator*> generator) {
     CHECK(radius == approx(mapped_radius));
   }
 }
+
+// The map is shared between the threads of a node, so evaluating it from
+// several threads at once must give the same results as evaluating it
+// serially. Each thread alternates between the grid points of two "elements"
+// so the cached interpolation info is replaced while the other threads use
+// theirs.
+template <typename Generator>
+void test_concurrent_evaluation(const gsl::not_null<Generator*> generator) {
+  using TransitionFunc =
+      CoordinateMaps::ShapeMapTransitionFunctions::SphereTransition;
+  const double time = 1.0;
+  const size_t l_max = 8;
+  const CoordinateMaps::TimeDependent::Shape shape{
+      std::array{0.0, 0.0, 0.0}, l_max, l_max,
+      std::make_unique<TransitionFunc>(1e-7, 100.0), "Shape"};
+
+  DataVector coefs{ylm::Spherepack::spectral_size(l_max, l_max), 0.0};
+  DataVector dt_coefs{ylm::Spherepack::spectral_size(l_max, l_max), 0.0};
+  DataVector d2t_coefs{ylm::Spherepack::spectral_size(l_max, l_max), 0.0};
+  std::uniform_real_distribution<double> dist_coefs{-0.01, 0.01};
+  fill_with_random_values(make_not_null(&coefs), generator,
+                          make_not_null(&dist_coefs));
+  fill_with_random_values(make_not_null(&dt_coefs), generator,
+                          make_not_null(&dist_coefs));
+  coefs[0] = 0.1 * sqrt(2.0 / M_PI);
+  FunctionsOfTimeMap functions_of_time{};
+  functions_of_time["Shape"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          time, std::array{coefs, dt_coefs, d2t_coefs}, time + 3.0);
+
+  const size_t number_of_elements = 8;
+  std::uniform_real_distribution<double> dist_coords{0.3, 1.0};
+  std::vector<std::array<DataVector, 3>> element_coords{};
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    element_coords.push_back(make_with_random_values<std::array<DataVector, 3>>(
+        generator, make_not_null(&dist_coords), DataVector{50}));
+  }
+
+  struct Results {
+    std::array<DataVector, 3> mapped_coords{};
+    std::array<DataVector, 3> frame_velocity{};
+    tnsr::Ij<DataVector, 3, Frame::NoFrame> jacobian{};
+    tnsr::Ij<DataVector, 3, Frame::NoFrame> inv_jacobian{};
+  };
+  const auto evaluate = [&shape, &time,
+                         &functions_of_time](const auto& coords) {
+    return Results{shape(coords, time, functions_of_time),
+                   shape.frame_velocity(coords, time, functions_of_time),
+                   shape.jacobian(coords, time, functions_of_time),
+                   shape.inv_jacobian(coords, time, functions_of_time)};
+  };
+
+  std::vector<Results> expected{};
+  for (const auto& coords : element_coords) {
+    expected.push_back(evaluate(coords));
+  }
+
+  const size_t number_of_threads = number_of_elements / 2;
+  const size_t number_of_evaluations = 20;
+  std::vector<Results> results(number_of_elements);
+  std::vector<std::thread> threads{};
+  for (size_t thread = 0; thread < number_of_threads; ++thread) {
+    threads.emplace_back([&element_coords, &evaluate, &results, thread]() {
+      for (size_t i = 0; i < number_of_evaluations; ++i) {
+        for (const size_t element : {2 * thread, 2 * thread + 1}) {
+          results[element] = evaluate(element_coords[element]);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    CAPTURE(i);
+    CHECK_ITERABLE_APPROX(results[i].mapped_coords, expected[i].mapped_coords);
+    CHECK_ITERABLE_APPROX(results[i].frame_velocity,
+                          expected[i].frame_velocity);
+    CHECK_ITERABLE_APPROX(results[i].jacobian, expected[i].jacobian);
+    CHECK_ITERABLE_APPROX(results[i].inv_jacobian, expected[i].inv_jacobian);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.TimeDependent.Shape",
@@ -549,6 +664,7 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.TimeDependent.Shape",
   MAKE_GENERATOR(generator);
 
   test_inverse(make_not_null(&generator));
+  test_concurrent_evaluation(make_not_null(&generator));
 
   for (const auto include_size : make_array(false, true)) {
     CAPTURE(include_size);
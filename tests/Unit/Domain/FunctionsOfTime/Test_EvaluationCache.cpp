@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+
+namespace {
+using domain::FunctionsOfTime::FunctionOfTimeHelpers::EvaluationCache;
+
+void test_cache() {
+  size_t number_of_evaluations = 0;
+  const auto evaluate = [&number_of_evaluations](const double t) {
+    return [&number_of_evaluations, t]() {
+      ++number_of_evaluations;
+      return std::array<DataVector, 2>{{DataVector{t, 2.0 * t}, DataVector{t}}};
+    };
+  };
+  const auto check = [&evaluate](const EvaluationCache& cache, const double t) {
+    const auto result = cache.get<1>(t, evaluate(t));
+    CHECK(result[0] == DataVector{t, 2.0 * t});
+    CHECK(result[1] == DataVector{t});
+  };
+
+  EvaluationCache cache{};
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 1);
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 1);
+  check(cache, 2.0);
+  CHECK(number_of_evaluations == 2);
+  check(cache, 1.0);
+  check(cache, 2.0);
+  CHECK(number_of_evaluations == 2);
+
+  // A different number of derivatives is a different evaluation
+  const auto func = cache.get<0>(1.0, [&number_of_evaluations]() {
+    ++number_of_evaluations;
+    return std::array<DataVector, 1>{{DataVector{3.0}}};
+  });
+  CHECK(func[0] == DataVector{3.0});
+  CHECK(number_of_evaluations == 3);
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 3);
+
+  cache.invalidate();
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 4);
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 4);
+
+  // Copies are different functions of time
+  const EvaluationCache copy = cache;
+  check(copy, 1.0);
+  CHECK(number_of_evaluations == 5);
+  EvaluationCache moved = EvaluationCache{cache};
+  check(moved, 1.0);
+  CHECK(number_of_evaluations == 6);
+  check(cache, 1.0);
+  CHECK(number_of_evaluations == 6);
+  moved = copy;
+  check(moved, 1.0);
+  CHECK(number_of_evaluations == 7);
+}
+
+void test_piecewise_polynomial() {
+  // The cached evaluation at the update time has to change with the update
+  domain::FunctionsOfTime::PiecewisePolynomial<2> f_of_t(
+      0.0, std::array<DataVector, 3>{{{1.0}, {0.0}, {2.0}}}, 1.0);
+  CHECK(f_of_t.func_and_2_derivs(1.0)[2] == DataVector{2.0});
+  CHECK(f_of_t.func_and_2_derivs(1.0)[2] == DataVector{2.0});
+  f_of_t.update(1.0, DataVector{4.0}, 2.0);
+  CHECK(f_of_t.func_and_2_derivs(1.0)[2] == DataVector{4.0});
+  CHECK(f_of_t.func(1.0)[0] == DataVector{2.0});
+
+  auto copy = f_of_t.get_clone();
+  f_of_t.update(2.0, DataVector{6.0}, 3.0);
+  CHECK(f_of_t.func_and_2_derivs(2.0)[2] == DataVector{6.0});
+  CHECK(copy->func_and_2_derivs(2.0)[2] == DataVector{4.0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.EvaluationCache",
+                  "[Unit][Domain]") {
+  test_cache();
+  test_piecewise_polynomial();
+}
@@ -24,6 +24,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 // Test the weighting done by `domain::get_element_costs` for a uniform cost
@@ -48,6 +49,28 @@ void test_uniform_cost_function() {
   }
 }
 
+// Test that the cost of a single element, which is used to compute the costs
+// in parallel, matches `domain::get_element_costs`
+void test_single_element_cost() {
+  const auto domain_creator = domain::creators::AlignedLattice<3>(
+      {{{{0.0, 1.0, 3.0}}, {{0.0, 1.0}}, {{0.0, 2.0}}}}, {{2, 1, 1}},
+      {{4, 5, 3}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto costs = domain::get_element_costs(
+      domain.blocks(), domain_creator.initial_refinement_levels(),
+      domain_creator.initial_extents(),
+      domain::ElementWeight::NumGridPointsAndGridSpacing,
+      Spectral::Quadrature::GaussLobatto);
+  CHECK(costs.size() == 32);
+  for (const auto& [element_id, cost] : costs) {
+    CAPTURE(element_id);
+    CHECK(domain::get_num_points_and_grid_spacing_cost(
+              element_id, domain.blocks()[element_id.block_id()],
+              domain_creator.initial_extents(),
+              Spectral::Quadrature::GaussLobatto) == cost);
+  }
+}
+
 // Test the weighting done by `domain::get_element_costs` for weighted cost
 // functions
 void test_weighted_cost_function(const domain::ElementWeight element_weight) {
@@ -506,6 +529,7 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   test_weighted_cost_function(domain::ElementWeight::NumGridPoints);
   test_weighted_cost_function(
       domain::ElementWeight::NumGridPointsAndGridSpacing);
+  test_single_element_cost();
 
   // Inputs for testing `BlockZCurveProcDistribution`
 
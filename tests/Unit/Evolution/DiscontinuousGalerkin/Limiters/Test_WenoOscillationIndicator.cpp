@@ -3,6 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
@@ -14,6 +17,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -174,6 +178,63 @@ void test_oscillation_indicator_3d() {
   test_oscillation_indicator_3d_impl(Spectral::Quadrature::Gauss);
 }
 
+template <size_t VolumeDim>
+void test_oscillation_indicators_impl(const Mesh<VolumeDim>& mesh) {
+  CAPTURE(mesh);
+  const auto logical_coords = logical_coordinates(mesh);
+  const DataVector& x = get<0>(logical_coords);
+  const DataVector& y = get<VolumeDim - 1>(logical_coords);
+  const std::array<DataVector, 4> sets{
+      {DataVector{1. + x - square(x) * y}, DataVector{square(x) + cube(y)},
+       DataVector(mesh.number_of_grid_points(), 2.),
+       DataVector{x * y - 3. * square(y)}}};
+
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  DataVector data(sets.size() * number_of_grid_points);
+  for (size_t k = 0; k < sets.size(); ++k) {
+    std::copy(gsl::at(sets, k).begin(), gsl::at(sets, k).end(),
+              data.begin() + static_cast<std::ptrdiff_t>(
+                                 k * number_of_grid_points));
+  }
+
+  for (const auto derivative_weight :
+       {Limiters::Weno_detail::DerivativeWeight::Unity,
+        Limiters::Weno_detail::DerivativeWeight::PowTwoEll,
+        Limiters::Weno_detail::DerivativeWeight::PowTwoEllOverEllFactorial}) {
+    CAPTURE(derivative_weight);
+    DataVector indicators{};
+    Limiters::Weno_detail::oscillation_indicators(
+        make_not_null(&indicators), derivative_weight, data, mesh);
+    REQUIRE(indicators.size() == sets.size());
+    for (size_t k = 0; k < sets.size(); ++k) {
+      CAPTURE(k);
+      CHECK(indicators[k] ==
+            approx(Limiters::Weno_detail::oscillation_indicator(
+                derivative_weight, gsl::at(sets, k), mesh)));
+    }
+    // A constant has no oscillation
+    CHECK(indicators[2] == approx(0.));
+
+    // No data gives no indicators
+    Limiters::Weno_detail::oscillation_indicators(
+        make_not_null(&indicators), derivative_weight, DataVector{}, mesh);
+    CHECK(indicators.size() == 0);
+  }
+}
+
+void test_oscillation_indicators() {
+  INFO("Testing oscillation_indicators");
+  for (const auto quadrature :
+       {Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss}) {
+    test_oscillation_indicators_impl(
+        Mesh<1>(5, Spectral::Basis::Legendre, quadrature));
+    test_oscillation_indicators_impl(
+        Mesh<2>({{4, 5}}, Spectral::Basis::Legendre, quadrature));
+    test_oscillation_indicators_impl(
+        Mesh<3>({{4, 3, 5}}, Spectral::Basis::Legendre, quadrature));
+  }
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.OscillationIndicator",
@@ -183,4 +244,5 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.OscillationIndicator",
   test_oscillation_indicator_1d();
   test_oscillation_indicator_2d();
   test_oscillation_indicator_3d();
+  test_oscillation_indicators();
 }
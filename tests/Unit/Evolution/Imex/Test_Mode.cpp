@@ -11,4 +11,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.Imex.Mode", "[Unit][Evolution]") {
         imex::Mode::Implicit);
   CHECK(TestHelpers::test_creation<imex::Mode>("SemiImplicit") ==
         imex::Mode::SemiImplicit);
+  CHECK(TestHelpers::test_creation<imex::Mode>("BatchedImplicit") ==
+        imex::Mode::BatchedImplicit);
 }
@@ -41,6 +41,7 @@
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/Heun2.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
@@ -91,6 +92,7 @@ struct SomeComputeTagBase : db::SimpleTag {
   using type = double;
 };
 
+template <bool BatchedSolve>
 struct SomeComputeTag : SomeComputeTagBase, db::ComputeTag {
   using base = SomeComputeTagBase;
   using argument_tags =
@@ -102,12 +104,20 @@ struct SomeComputeTag : SomeComputeTagBase, db::ComputeTag {
     // Check the initialization of the temporary Variables in the
     // solver DataBox.  None of the mutators modify the object, so it
     // should always have that state.
-    CHECK(temporary.number_of_grid_points() == 1);
-    CHECK(get(get<TensorTemporary>(temporary))[0] == 0.0);
-
-    // Check slicing
-    CHECK(get(from_evolution).size() == 1);
-    CHECK(get(from_evolution)[0] == 2.0 * get(var1)[0]);
+    if constexpr (BatchedSolve) {
+      // The batched solves use the full element and don't slice.
+      CHECK(temporary.number_of_grid_points() == get(var1).size());
+      CHECK(get(get<TensorTemporary>(temporary)) ==
+            DataVector(get(var1).size(), 0.0));
+      CHECK(get(from_evolution) == DataVector(2.0 * get(var1)));
+    } else {
+      CHECK(temporary.number_of_grid_points() == 1);
+      CHECK(get(get<TensorTemporary>(temporary))[0] == 0.0);
+
+      // Check slicing
+      CHECK(get(from_evolution).size() == 1);
+      CHECK(get(from_evolution)[0] == 2.0 * get(var1)[0]);
+    }
 
     *result = get(var1)[0] + 1.0;
   }
@@ -260,7 +270,7 @@ struct Jacobian {
   }
 };
 
-template <bool TestWithAnalyticSolution>
+template <bool TestWithAnalyticSolution, bool BatchedSolve = false>
 struct ImplicitSector : tt::ConformsTo<imex::protocols::ImplicitSector> {
   using tensors = tmpl::list<Var2, Var3>;
   using initial_guess = tmpl::conditional_t<TestWithAnalyticSolution,
@@ -270,7 +280,7 @@ struct ImplicitSector : tt::ConformsTo<imex::protocols::ImplicitSector> {
     using tags_from_evolution =
         tmpl::list<Var1, NonTensor, VariablesFromEvolution>;
     using simple_tags = tmpl::list<RecordPreparersForTest, VariablesTemporary>;
-    using compute_tags = tmpl::list<SomeComputeTag>;
+    using compute_tags = tmpl::list<SomeComputeTag<BatchedSolve>>;
 
     using source_prep =
         tmpl::list<Preparer<PrepId::Shared>, Preparer<PrepId::Source>>;
@@ -361,9 +371,9 @@ void test_internal_jacobian_ordering() {
   }
 }
 
-template <bool TestWithAnalyticSolution>
+template <bool TestWithAnalyticSolution, bool BatchedSolve = false>
 void test_solve_implicit_sector(const imex::Mode solve_mode) {
-  using sector = ImplicitSector<TestWithAnalyticSolution>;
+  using sector = ImplicitSector<TestWithAnalyticSolution, BatchedSolve>;
   // No solve is done with an analytic solution.
   const bool doing_semi_implicit_solve =
       solve_mode == imex::Mode::SemiImplicit and not TestWithAnalyticSolution;
@@ -754,6 +764,242 @@ void test_fallback() {
   CHECK(get(get<imex::Tags::SolveFailures<sector>>(box)) ==
         4.0 - get(desired_level));
 }
+
+struct NonlinearSector : tt::ConformsTo<imex::protocols::ImplicitSector> {
+  using tensors = tmpl::list<Var1>;
+  using initial_guess = imex::GuessExplicitResult;
+
+  struct SolveAttempt {
+    using tags_from_evolution = tmpl::list<>;
+    using simple_tags = tmpl::list<>;
+    using compute_tags = tmpl::list<>;
+
+    using source_prep = tmpl::list<>;
+    using jacobian_prep = tmpl::list<>;
+
+    struct source {
+      using return_tags = tmpl::list<::Tags::Source<Var1>>;
+      using argument_tags = tmpl::list<Var1>;
+
+      static void apply(const gsl::not_null<Scalar<DataVector>*> source_var1,
+                        const Scalar<DataVector>& var1) {
+        get(*source_var1) = -cube(get(var1));
+      }
+    };
+
+    struct jacobian {
+      using return_tags =
+          tmpl::list<imex::Tags::Jacobian<Var1, ::Tags::Source<Var1>>>;
+      using argument_tags = tmpl::list<Var1>;
+
+      static void apply(const gsl::not_null<Scalar<DataVector>*> dvar1_dvar1,
+                        const Scalar<DataVector>& var1) {
+        get(*dvar1_dvar1) = -3.0 * square(get(var1));
+      }
+    };
+  };
+
+  using solve_attempts = tmpl::list<SolveAttempt>;
+};
+
+void test_batched_nonlinear_solve() {
+  using sector = NonlinearSector;
+  using variables_tag = ::Tags::Variables<tmpl::list<Var1>>;
+  using history_tag = imex::Tags::ImplicitHistory<sector>;
+
+  const Slab slab(0.0, 2.0);
+  const auto time_step = slab.duration();
+  // Values spanning several orders of magnitude, so the points
+  // converge after different numbers of iterations.
+  const DataVector explicit_value{-30.0, -1.0, 0.0, 0.5, 2.0, 100.0};
+  const size_t number_of_grid_points = explicit_value.size();
+
+  // Set the initial derivative to zero so we can ignore that term in
+  // the time stepper equation.
+  variables_tag::type initial_value(number_of_grid_points);
+  get(get<Var1>(initial_value)) = explicit_value;
+  TimeSteppers::History<variables_tag::type> history(2);
+  history.insert(TimeStepId(true, 0, slab.start()), decltype(history)::no_value,
+                 db::prefix_variables<Tags::dt, variables_tag::type>(
+                     number_of_grid_points, 0.0));
+
+  auto box = db::create<
+      db::AddSimpleTags<variables_tag, history_tag, imex::Tags::Mode,
+                        Tags::ConcreteTimeStepper<ImexTimeStepper>,
+                        Tags::TimeStep, imex::Tags::SolveFailures<sector>,
+                        imex::Tags::SolveTolerance>,
+      time_stepper_ref_tags<ImexTimeStepper>>(
+      std::move(initial_value), std::move(history),
+      imex::Mode::BatchedImplicit,
+      static_cast<std::unique_ptr<ImexTimeStepper>>(
+          std::make_unique<TimeSteppers::Heun2>()),
+      time_step, Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)),
+      1.0e-12);
+
+  db::mutate_apply<imex::SolveImplicitSector<variables_tag, sector>>(
+      make_not_null(&box));
+
+  // The equation being solved is: y(dt) = y(0) + dt/2 source(y(dt))
+  // where: dt = 2, source(y) = -y^3
+  const DataVector& result = get(get<Var1>(box));
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(DataVector(result + cube(result)),
+                               explicit_value, custom_approx);
+  CHECK(get(get<imex::Tags::SolveFailures<sector>>(box)) ==
+        DataVector(number_of_grid_points, 0.0));
+}
+
+// Counts the source evaluations on a single point, i.e., in the
+// pointwise solves.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+size_t pointwise_source_evaluations = 0;
+
+struct BatchedSolveFails : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+// The same equation as NonlinearSector, but the jacobian evaluated on
+// the full element is singular at the points flagged in
+// BatchedSolveFails, so the batched solve fails there and the points
+// have to be solved pointwise.
+struct SectorWithBatchedFailure
+    : tt::ConformsTo<imex::protocols::ImplicitSector> {
+  using tensors = tmpl::list<Var1>;
+  using initial_guess = imex::GuessExplicitResult;
+
+  struct SolveAttempt {
+    using tags_from_evolution = tmpl::list<BatchedSolveFails>;
+    using simple_tags = tmpl::list<>;
+    using compute_tags = tmpl::list<>;
+
+    using source_prep = tmpl::list<>;
+    using jacobian_prep = tmpl::list<>;
+
+    struct source {
+      using return_tags = tmpl::list<::Tags::Source<Var1>>;
+      using argument_tags = tmpl::list<Var1>;
+
+      static void apply(const gsl::not_null<Scalar<DataVector>*> source_var1,
+                        const Scalar<DataVector>& var1) {
+        if (get(var1).size() == 1) {
+          ++pointwise_source_evaluations;
+        }
+        get(*source_var1) = -cube(get(var1));
+      }
+    };
+
+    struct jacobian {
+      using return_tags =
+          tmpl::list<imex::Tags::Jacobian<Var1, ::Tags::Source<Var1>>>;
+      using argument_tags = tmpl::list<Var1, BatchedSolveFails>;
+
+      static void apply(const gsl::not_null<Scalar<DataVector>*> dvar1_dvar1,
+                        const Scalar<DataVector>& var1,
+                        const Scalar<DataVector>& batched_solve_fails) {
+        get(*dvar1_dvar1) = -3.0 * square(get(var1));
+        if (get(var1).size() > 1) {
+          for (size_t i = 0; i < get(var1).size(); ++i) {
+            if (get(batched_solve_fails)[i] != 0.0) {
+              // The implicit weight is 1, so the jacobian of the
+              // residual, w dS/du - 1, vanishes.
+              get(*dvar1_dvar1)[i] = 1.0;
+            }
+          }
+        }
+      }
+    };
+  };
+
+  using solve_attempts = tmpl::list<SolveAttempt>;
+};
+
+void test_batched_solve_failure() {
+  using sector = SectorWithBatchedFailure;
+  using variables_tag = ::Tags::Variables<tmpl::list<Var1>>;
+  using history_tag = imex::Tags::ImplicitHistory<sector>;
+
+  const Slab slab(0.0, 2.0);
+  const auto time_step = slab.duration();
+  const DataVector explicit_value{-3.0, 0.5, 2.0, 10.0};
+  const Scalar<DataVector> batched_solve_fails{{{{0.0, 1.0, 0.0, 1.0}}}};
+  const size_t number_of_grid_points = explicit_value.size();
+
+  // Set the initial derivative to zero so we can ignore that term in
+  // the time stepper equation.
+  variables_tag::type initial_value(number_of_grid_points);
+  get(get<Var1>(initial_value)) = explicit_value;
+  TimeSteppers::History<variables_tag::type> history(2);
+  history.insert(TimeStepId(true, 0, slab.start()), decltype(history)::no_value,
+                 db::prefix_variables<Tags::dt, variables_tag::type>(
+                     number_of_grid_points, 0.0));
+
+  auto box = db::create<
+      db::AddSimpleTags<BatchedSolveFails, variables_tag, history_tag,
+                        imex::Tags::Mode,
+                        Tags::ConcreteTimeStepper<ImexTimeStepper>,
+                        Tags::TimeStep, imex::Tags::SolveFailures<sector>,
+                        imex::Tags::SolveTolerance>,
+      time_stepper_ref_tags<ImexTimeStepper>>(
+      batched_solve_fails, std::move(initial_value), std::move(history),
+      imex::Mode::BatchedImplicit,
+      static_cast<std::unique_ptr<ImexTimeStepper>>(
+          std::make_unique<TimeSteppers::Heun2>()),
+      time_step, Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)),
+      1.0e-12);
+
+  pointwise_source_evaluations = 0;
+  db::mutate_apply<imex::SolveImplicitSector<variables_tag, sector>>(
+      make_not_null(&box));
+
+  // The flagged points were solved pointwise.
+  CHECK(pointwise_source_evaluations > 0);
+  // The equation being solved is: y(dt) = y(0) + dt/2 source(y(dt))
+  // where: dt = 2, source(y) = -y^3
+  const DataVector& result = get(get<Var1>(box));
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(DataVector(result + cube(result)),
+                               explicit_value, custom_approx);
+  CHECK(get(get<imex::Tags::SolveFailures<sector>>(box)) ==
+        DataVector(number_of_grid_points, 0.0));
+
+  // Without failures the batched solve does all the work.
+  db::mutate<variables_tag, BatchedSolveFails>(
+      [&explicit_value](const gsl::not_null<variables_tag::type*> vars,
+                        const gsl::not_null<Scalar<DataVector>*> fails) {
+        get(get<Var1>(*vars)) = explicit_value;
+        get(*fails) = 0.0;
+      },
+      make_not_null(&box));
+  pointwise_source_evaluations = 0;
+  db::mutate_apply<imex::SolveImplicitSector<variables_tag, sector>>(
+      make_not_null(&box));
+  CHECK(pointwise_source_evaluations == 0);
+  CHECK_ITERABLE_CUSTOM_APPROX(DataVector(result + cube(result)),
+                               explicit_value, custom_approx);
+}
+
+void test_dense_solve() {
+  std::array<std::array<double, 3>, 3> matrix{
+      {{{0.0, 2.0, 1.0}}, {{1.0, 1.0, 0.0}}, {{3.0, 0.0, 1.0}}}};
+  const auto original_matrix = matrix;
+  const std::array<double, 3> expected{{1.0, -2.0, 3.0}};
+  std::array<double, 3> rhs{};
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      gsl::at(rhs, i) +=
+          gsl::at(gsl::at(original_matrix, i), j) * gsl::at(expected, j);
+    }
+  }
+  CHECK(imex::solve_implicit_sector_detail::dense_solve_in_place(
+      make_not_null(&matrix), make_not_null(&rhs)));
+  CHECK_ITERABLE_APPROX(rhs, expected);
+
+  std::array<std::array<double, 2>, 2> singular{
+      {{{1.0, 2.0}}, {{2.0, 4.0}}}};
+  std::array<double, 2> singular_rhs{{1.0, 1.0}};
+  CHECK_FALSE(imex::solve_implicit_sector_detail::dense_solve_in_place(
+      make_not_null(&singular), make_not_null(&singular_rhs)));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Imex.SolveImplicitSector",
@@ -765,6 +1011,11 @@ SPECTRE_TEST_CASE("Unit.Evolution.Imex.SolveImplicitSector",
   test_solve_implicit_sector<true>(imex::Mode::Implicit);
   test_solve_implicit_sector<false>(imex::Mode::SemiImplicit);
   test_solve_implicit_sector<true>(imex::Mode::SemiImplicit);
+  test_solve_implicit_sector<false, true>(imex::Mode::BatchedImplicit);
+  test_solve_implicit_sector<true, true>(imex::Mode::BatchedImplicit);
   test_point_reseting();
   test_fallback();
+  test_batched_nonlinear_solve();
+  test_batched_solve_failure();
+  test_dense_solve();
 }
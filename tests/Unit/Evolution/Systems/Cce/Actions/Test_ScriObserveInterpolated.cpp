@@ -34,6 +34,7 @@
 #include "IO/H5/File.hpp"
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
@@ -363,6 +364,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.Actions.ScriObserveInterpolated",
           make_not_null(&runner), 0);
     }
   }
+  // Write out the buffered reduction data
+  ActionTesting::threaded_action<
+      observation_component, observers::ThreadedActions::FlushReductionData>(
+      make_not_null(&runner), 0);
   const auto& interpolation_manager = ActionTesting::get_databox_tag<
       evolution_component,
       Tags::InterpolationManager<ComplexDataVector, Tags::News>>(runner, 0);
@@ -4,25 +4,43 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Creators/Tags/FunctionsOfTime.hpp"
+#include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/ElementMap.hpp"
+#include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/Systems/Cce/Actions/SendGhVarsToCce.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/ParallelAlgorithms/Interpolation/InterpolateOnElementTestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationStencil.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeTargetPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/PostInterpolationCallback.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
-#include "Time/Tags/Time.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -34,7 +52,8 @@ struct mock_element {
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = ElementId<Metavariables::volume_dim>;
   using simple_tags = tmpl::list<
-      ::Tags::Time, domain::Tags::Mesh<Metavariables::volume_dim>,
+      typename Metavariables::InterpolationTargetA::temporal_id,
+      domain::Tags::Mesh<Metavariables::volume_dim>,
       ::Tags::Variables<
           tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>>,
       intrp::Tags::InterpPointInfo<Metavariables>,
@@ -57,30 +76,202 @@ struct initialize_elements_and_queue_simple_actions {
                   const Domain<3>& domain,
                   const std::vector<ElementId<3>>& element_ids,
                   const InterpPointInfo& interp_point_info, Runner& runner,
-                  const double time) {
+                  const TimeStepId& temporal_id) {
+    using metavars = typename ElemComponent::metavariables;
     using elem_component = ElemComponent;
+    using target_tag = typename metavars::InterpolationTargetA;
+    using target_component =
+        InterpolateOnElementTestHelpers::mock_interpolation_target<metavars,
+                                                                   target_tag>;
+    using stencil_tag = intrp::Tags::InterpolationStencil<target_tag, 3>;
+    using point_info_tag = intrp::Tags::InterpPointInfo<metavars>;
+    using vars_tag = ::Tags::Variables<
+        tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>>;
 
     // Emplace elements.
     for (const auto& element_id : element_ids) {
-      // 1. Get vars, mesh, and coords
-      auto [vars, mesh, inertial_coords] =
-          InterpolateOnElementTestHelpers::make_volume_data_and_mesh<
-              ElemComponent, false>(domain_creator, runner, domain, element_id,
-                                    time);
-
-      // 2. emplace element.
+      // 1. emplace element. The volume data is set afterwards because with
+      // time-dependent maps it needs the functions of time from the cache.
       ActionTesting::emplace_component_and_initialize<elem_component>(
           &runner, element_id,
-          {time, mesh, std::move(vars), interp_point_info,
-           std::move(inertial_coords)});
+          {temporal_id, Mesh<3>{}, typename vars_tag::type{},
+           interp_point_info, tnsr::I<DataVector, 3, Frame::Inertial>{}});
+
+      // 2. Set vars, mesh, and coords
+      auto [vars, mesh, inertial_coords] =
+          InterpolateOnElementTestHelpers::make_volume_data_and_mesh<
+              ElemComponent, metavars::use_time_dependent_maps>(
+              domain_creator, runner, domain, element_id, temporal_id);
+      db::mutate<domain::Tags::Mesh<3>,
+                 domain::Tags::Coordinates<3, Frame::Inertial>, vars_tag>(
+          [&vars_l = vars, &mesh_l = mesh,
+           &inertial_coords_l = inertial_coords](
+              const gsl::not_null<Mesh<3>*> box_mesh,
+              const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+                  box_coords,
+              const gsl::not_null<typename vars_tag::type*> box_vars) {
+            *box_mesh = mesh_l;
+            *box_coords = std::move(inertial_coords_l);
+            *box_vars = std::move(vars_l);
+          },
+          make_not_null(&ActionTesting::get_databox<elem_component>(
+              make_not_null(&runner), element_id)));
     }
 
     ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
 
     // Call the action on all the elements.
-    for (const auto& element_id : element_ids) {
-      ActionTesting::next_action<elem_component>(make_not_null(&runner),
-                                                 element_id);
+    const auto run_step = [&runner, &element_ids]() {
+      for (const auto& element_id : element_ids) {
+        ActionTesting::next_action<elem_component>(make_not_null(&runner),
+                                                   element_id);
+      }
+    };
+    run_step();
+
+    if constexpr (metavars::use_time_dependent_maps) {
+      // The elements move in the frame of the target points, so the points
+      // are located at every step by the interpolation event and nothing is
+      // cached. The interpolated data is checked by the target.
+      for (const auto& element_id : element_ids) {
+        CHECK_FALSE(ActionTesting::get_databox_tag<elem_component, stencil_tag>(
+                        runner, element_id)
+                        .has_value());
+      }
+      CHECK_FALSE(ActionTesting::is_simple_action_queue_empty<target_component>(
+          runner, 0));
+    } else {
+      const auto mutate_element = [&runner](const ElementId<3>& element_id,
+                                            const auto& function) {
+        db::mutate_apply<
+            tmpl::list<typename target_tag::temporal_id, point_info_tag,
+                       domain::Tags::Mesh<3>,
+                       domain::Tags::Coordinates<3, Frame::Inertial>,
+                       vars_tag>,
+            tmpl::list<>>(function,
+                          make_not_null(&ActionTesting::get_databox<
+                                        elem_component>(make_not_null(&runner),
+                                                        element_id)));
+      };
+      const auto stencil = [&runner](const ElementId<3>& element_id)
+          -> const typename stencil_tag::type& {
+        return ActionTesting::get_databox_tag<elem_component, stencil_tag>(
+            runner, element_id);
+      };
+      // Each element containing target points sends a single message per step,
+      // which the target checks.
+      const auto check_messages = [&runner, &element_ids, &stencil]() {
+        size_t elements_with_points = 0;
+        for (const auto& element_id : element_ids) {
+          REQUIRE(stencil(element_id).has_value());
+          if (stencil(element_id)->has_target_points()) {
+            ++elements_with_points;
+          }
+        }
+        CHECK(elements_with_points > 0);
+        CHECK(ActionTesting::number_of_queued_simple_actions<target_component>(
+                  runner, 0) == elements_with_points);
+        while (not ActionTesting::is_simple_action_queue_empty<
+               target_component>(runner, 0)) {
+          ActionTesting::invoke_queued_simple_action<target_component>(
+              make_not_null(&runner), 0);
+        }
+      };
+
+      // The domain is time-independent, so the elements have cached the
+      // interpolation to the target points.
+      size_t number_of_points_in_elements = 0;
+      std::unordered_map<ElementId<3>, std::vector<size_t>> first_offsets{};
+      for (const auto& element_id : element_ids) {
+        REQUIRE(stencil(element_id).has_value());
+        CHECK(stencil(element_id)->mesh ==
+              ActionTesting::get_databox_tag<elem_component,
+                                             domain::Tags::Mesh<3>>(
+                  runner, element_id));
+        CHECK(stencil(element_id)->has_target_points() ==
+              not stencil(element_id)->block_logical_coords.empty());
+        number_of_points_in_elements += stencil(element_id)->offsets.size();
+        first_offsets[element_id] = stencil(element_id)->offsets;
+      }
+      // Points on element boundaries are sent by all elements containing them
+      CHECK(number_of_points_in_elements >=
+            get<0>(get<intrp::Vars::PointInfoTag<target_tag, 3>>(
+                       interp_point_info))
+                .size());
+      check_messages();
+
+      // At the next step the cached stencil is reused. To show that the
+      // points are not located again, move the element's copy of the target
+      // points out of the domain: the elements still send the data at the
+      // original points, which is what the target checks against.
+      const TimeStepId next_temporal_id(
+          true, 0,
+          temporal_id.step_time() +
+              temporal_id.step_time().slab().duration() / 15);
+      const InterpPointInfo moved_point_info = [&interp_point_info]() {
+        InterpPointInfo result = interp_point_info;
+        for (auto& component :
+             get<intrp::Vars::PointInfoTag<target_tag, 3>>(result)) {
+          component += 100.0;
+        }
+        return result;
+      }();
+      for (const auto& element_id : element_ids) {
+        mutate_element(
+            element_id, [&next_temporal_id, &moved_point_info](
+                            const gsl::not_null<TimeStepId*> time_step_id,
+                            const gsl::not_null<InterpPointInfo*> point_info,
+                            const auto /*mesh*/, const auto /*coords*/,
+                            const auto /*vars*/) {
+              *time_step_id = next_temporal_id;
+              *point_info = moved_point_info;
+            });
+      }
+      run_step();
+      check_messages();
+      for (const auto& element_id : element_ids) {
+        CHECK(stencil(element_id)->offsets == first_offsets.at(element_id));
+      }
+
+      // After a change of the mesh the points are located again, now with the
+      // original points, and the stencil is rebuilt for the new mesh.
+      const TimeStepId last_temporal_id(
+          true, 0,
+          next_temporal_id.step_time() +
+              temporal_id.step_time().slab().duration() / 15);
+      for (const auto& element_id : element_ids) {
+        const auto& block = domain.blocks()[element_id.block_id()];
+        mutate_element(
+            element_id,
+            [&last_temporal_id, &interp_point_info, &element_id, &block](
+                const gsl::not_null<TimeStepId*> time_step_id,
+                const gsl::not_null<InterpPointInfo*> point_info,
+                const gsl::not_null<Mesh<3>*> mesh,
+                const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+                    coords,
+                const gsl::not_null<typename vars_tag::type*> vars) {
+              *time_step_id = last_temporal_id;
+              *point_info = interp_point_info;
+              *mesh = Mesh<3>{mesh->extents(0) + 1, mesh->basis(0),
+                              mesh->quadrature(0)};
+              const ElementMap<3, Frame::Inertial> map{
+                  element_id, block.stationary_map().get_clone()};
+              *coords = map(logical_coordinates(*mesh));
+              vars->initialize(mesh->number_of_grid_points());
+              InterpolateOnElementTestHelpers::fill_variables<
+                  InterpolateOnElementTestHelpers::Tags::TestSolution>(vars,
+                                                                       *coords);
+            });
+      }
+      run_step();
+      check_messages();
+      for (const auto& element_id : element_ids) {
+        CHECK(stencil(element_id)->mesh ==
+              ActionTesting::get_databox_tag<elem_component,
+                                             domain::Tags::Mesh<3>>(
+                  runner, element_id));
+        CHECK(stencil(element_id)->offsets == first_offsets.at(element_id));
+      }
     }
   }
 };
@@ -108,7 +299,7 @@ struct MockPostInterpolationCallback
 
 struct InterpolationTargetAImpl
     : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
-  using temporal_id = ::Tags::Time;
+  using temporal_id = ::Tags::TimeStepId;
   using vars_to_interpolate_to_target =
       tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
   using compute_target_points = MockComputeTargetPoints;
@@ -117,11 +308,16 @@ struct InterpolationTargetAImpl
   using compute_items_on_target = tmpl::list<>;
 };
 
+template <bool UseTimeDependentMaps>
 struct MockMetavariables {
   using InterpolationTargetA = InterpolationTargetAImpl;
-  static constexpr bool use_time_dependent_maps = false;
+  static constexpr bool use_time_dependent_maps = UseTimeDependentMaps;
   static constexpr size_t volume_dim = 3;
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<3>>;
+  using mutable_global_cache_tags =
+      tmpl::conditional_t<use_time_dependent_maps,
+                          tmpl::list<domain::Tags::FunctionsOfTimeInitialize>,
+                          tmpl::list<>>;
   struct factory_creation
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
     using factory_classes = tmpl::map<
@@ -152,6 +348,9 @@ void run_test() {
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.Actions.SendGhVarsToCce",
                   "[Unit][Cce]") {
   domain::creators::register_derived_with_charm();
-  run_test<MockMetavariables>();
+  domain::creators::time_dependence::register_derived_with_charm();
+  domain::FunctionsOfTime::register_derived_with_charm();
+  run_test<MockMetavariables<false>>();
+  run_test<MockMetavariables<true>>();
 }
 }  // namespace
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/Ccz4/FusedTimeDerivative.hpp"
+#include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <size_t Dim>
+struct TimeDerivatives {
+  explicit TimeDerivatives(const size_t num_points)
+      : dt_conformal_spatial_metric(num_points),
+        dt_ln_lapse(num_points),
+        dt_shift(num_points),
+        dt_ln_conformal_factor(num_points),
+        dt_a_tilde(num_points),
+        dt_trace_extrinsic_curvature(num_points),
+        dt_theta(num_points),
+        dt_gamma_hat(num_points),
+        dt_b(num_points),
+        dt_field_a(num_points),
+        dt_field_b(num_points),
+        dt_field_d(num_points),
+        dt_field_p(num_points) {}
+
+  tnsr::ii<DataVector, Dim> dt_conformal_spatial_metric;
+  Scalar<DataVector> dt_ln_lapse;
+  tnsr::I<DataVector, Dim> dt_shift;
+  Scalar<DataVector> dt_ln_conformal_factor;
+  tnsr::ii<DataVector, Dim> dt_a_tilde;
+  Scalar<DataVector> dt_trace_extrinsic_curvature;
+  Scalar<DataVector> dt_theta;
+  tnsr::I<DataVector, Dim> dt_gamma_hat;
+  tnsr::I<DataVector, Dim> dt_b;
+  tnsr::i<DataVector, Dim> dt_field_a;
+  tnsr::iJ<DataVector, Dim> dt_field_b;
+  tnsr::ijj<DataVector, Dim> dt_field_d;
+  tnsr::i<DataVector, Dim> dt_field_p;
+};
+
+template <size_t Dim, typename Generator>
+void test(const gsl::not_null<Generator*> generator,
+          const Ccz4::EvolveShift evolve_shift,
+          const Ccz4::SlicingConditionType slicing_condition_type) {
+  CAPTURE(Dim);
+  const size_t num_points = 50;
+  const DataVector used_for_size(num_points,
+                                 std::numeric_limits<double>::signaling_NaN());
+  std::uniform_real_distribution<> dist(-0.1, 0.1);
+  const auto random = [&generator, &dist, &used_for_size](auto tensor) {
+    return make_with_random_values<decltype(tensor)>(
+        generator, make_not_null(&dist), used_for_size);
+  };
+
+  const double c = 1.0;
+  const double cleaning_speed = 1.6;
+  const double f = 0.75;
+  const double kappa_1 = 0.1;
+  const double kappa_2 = 0.3;
+  const double kappa_3 = 0.4;
+  const double mu = 0.7;
+  const double one_over_relaxation_time = 10.0;
+  const auto eta = random(Scalar<DataVector>{});
+  const auto k_0 = random(Scalar<DataVector>{});
+  const auto d_k_0 = random(tnsr::i<DataVector, Dim>{});
+
+  // Perturb flat space so the conformal metric is invertible
+  auto conformal_spatial_metric = random(tnsr::ii<DataVector, Dim>{});
+  for (size_t i = 0; i < Dim; ++i) {
+    conformal_spatial_metric.get(i, i) += 1.0;
+  }
+  const auto ln_lapse = random(Scalar<DataVector>{});
+  const auto shift = random(tnsr::I<DataVector, Dim>{});
+  const auto ln_conformal_factor = random(Scalar<DataVector>{});
+  const auto a_tilde = random(tnsr::ii<DataVector, Dim>{});
+  const auto trace_extrinsic_curvature = random(Scalar<DataVector>{});
+  const auto theta = random(Scalar<DataVector>{});
+  const auto gamma_hat = random(tnsr::I<DataVector, Dim>{});
+  const auto b = random(tnsr::I<DataVector, Dim>{});
+  const auto field_a = random(tnsr::i<DataVector, Dim>{});
+  const auto field_b = random(tnsr::iJ<DataVector, Dim>{});
+  const auto field_d = random(tnsr::ijj<DataVector, Dim>{});
+  const auto field_p = random(tnsr::i<DataVector, Dim>{});
+  const auto d_a_tilde = random(tnsr::ijj<DataVector, Dim>{});
+  const auto d_trace_extrinsic_curvature = random(tnsr::i<DataVector, Dim>{});
+  const auto d_theta = random(tnsr::i<DataVector, Dim>{});
+  const auto d_gamma_hat = random(tnsr::iJ<DataVector, Dim>{});
+  const auto d_b = random(tnsr::iJ<DataVector, Dim>{});
+  const auto d_field_a = random(tnsr::ij<DataVector, Dim>{});
+  const auto d_field_b = random(tnsr::ijK<DataVector, Dim>{});
+  const auto d_field_d = random(tnsr::ijkk<DataVector, Dim>{});
+  const auto d_field_p = random(tnsr::ij<DataVector, Dim>{});
+
+  const auto compute = [&](const size_t block_size) {
+    TimeDerivatives<Dim> result(num_points);
+    Ccz4::FusedTimeDerivative<Dim>::apply(
+        make_not_null(&result.dt_conformal_spatial_metric),
+        make_not_null(&result.dt_ln_lapse), make_not_null(&result.dt_shift),
+        make_not_null(&result.dt_ln_conformal_factor),
+        make_not_null(&result.dt_a_tilde),
+        make_not_null(&result.dt_trace_extrinsic_curvature),
+        make_not_null(&result.dt_theta), make_not_null(&result.dt_gamma_hat),
+        make_not_null(&result.dt_b), make_not_null(&result.dt_field_a),
+        make_not_null(&result.dt_field_b), make_not_null(&result.dt_field_d),
+        make_not_null(&result.dt_field_p), c, cleaning_speed, eta, f, k_0,
+        d_k_0, kappa_1, kappa_2, kappa_3, mu, one_over_relaxation_time,
+        evolve_shift, slicing_condition_type, conformal_spatial_metric,
+        ln_lapse, shift, ln_conformal_factor, a_tilde,
+        trace_extrinsic_curvature, theta, gamma_hat, b, field_a, field_b,
+        field_d, field_p, d_a_tilde, d_trace_extrinsic_curvature, d_theta,
+        d_gamma_hat, d_b, d_field_a, d_field_b, d_field_d, d_field_p,
+        block_size);
+    return result;
+  };
+
+  // A single block is one call to Ccz4::TimeDerivative for all points
+  const auto expected = compute(num_points);
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  // Block sizes that do and don't divide the number of points
+  for (const size_t block_size :
+       {size_t{1}, size_t{7}, size_t{25},
+        Ccz4::FusedTimeDerivative<Dim>::default_block_size}) {
+    CAPTURE(block_size);
+    const auto result = compute(block_size);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_conformal_spatial_metric,
+                                 expected.dt_conformal_spatial_metric,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_ln_lapse, expected.dt_ln_lapse,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_shift, expected.dt_shift,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_ln_conformal_factor,
+                                 expected.dt_ln_conformal_factor,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_a_tilde, expected.dt_a_tilde,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_trace_extrinsic_curvature,
+                                 expected.dt_trace_extrinsic_curvature,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_theta, expected.dt_theta,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_gamma_hat, expected.dt_gamma_hat,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_b, expected.dt_b, custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_field_a, expected.dt_field_a,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_field_b, expected.dt_field_b,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_field_d, expected.dt_field_d,
+                                 custom_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(result.dt_field_p, expected.dt_field_p,
+                                 custom_approx);
+  }
+}
+
+template <size_t Dim, typename Generator>
+void test_all_settings(const gsl::not_null<Generator*> generator) {
+  for (const auto evolve_shift :
+       {Ccz4::EvolveShift::False, Ccz4::EvolveShift::True}) {
+    for (const auto slicing_condition_type :
+         {Ccz4::SlicingConditionType::Harmonic,
+          Ccz4::SlicingConditionType::Log}) {
+      test<Dim>(generator, evolve_shift, slicing_condition_type);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.Ccz4.FusedTimeDerivative",
+                  "[Unit][Evolution]") {
+  MAKE_GENERATOR(generator);
+  test_all_settings<1>(make_not_null(&generator));
+  test_all_settings<2>(make_not_null(&generator));
+  test_all_settings<3>(make_not_null(&generator));
+
+  CHECK(Ccz4::FusedTimeDerivative<3>::number_of_temporary_components() == 371);
+}
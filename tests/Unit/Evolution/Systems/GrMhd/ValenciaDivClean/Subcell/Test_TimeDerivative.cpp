@@ -85,9 +85,11 @@ struct DummyAnalyticSolutionTag : db::SimpleTag,
   using type = Solutions::SmoothFlow;
 };
 
+template <bool FusedDimensionSweeps>
 struct DummyEvolutionMetaVars {
   struct SubcellOptions {
     static constexpr bool subcell_enabled_at_external_boundary = false;
+    static constexpr bool fused_dimension_sweeps = FusedDimensionSweeps;
   };
   struct factory_creation
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
@@ -129,6 +131,7 @@ auto face_centered_gr_tags(
   return face_centered_gr_vars;
 }
 
+template <bool FusedDimensionSweeps = false>
 std::array<double, 5> test(const size_t num_dg_pts,
                            const ::fd::DerivativeOrder fd_derivative_order,
                            std::optional<double> expansion_velocity) {
@@ -397,7 +400,8 @@ std::array<double, 5> test(const size_t num_dg_pts,
           domain::Tags::DivMeshVelocity,
           evolution::dg::Tags::NormalCovectorAndMagnitude<3>, ::Tags::Time,
           domain::Tags::FunctionsOfTimeInitialize, DummyAnalyticSolutionTag,
-          Parallel::Tags::MetavariablesImpl<DummyEvolutionMetaVars>,
+          Parallel::Tags::MetavariablesImpl<
+              DummyEvolutionMetaVars<FusedDimensionSweeps>>,
           CellCenteredFluxesTag,
           evolution::dg::subcell::Tags::SubcellOptions<3>,
           evolution::dg::subcell::Tags::ReconstructionOrder<3>>,
@@ -463,7 +467,8 @@ std::array<double, 5> test(const size_t num_dg_pts,
       dg_mesh_velocity, div_dg_mesh_velocity,
       dummy_normal_covector_and_magnitude, dummy_time,
       clone_unique_ptrs(dummy_functions_of_time),
-      grmhd::Solutions::SmoothFlow{}, DummyEvolutionMetaVars{},
+      grmhd::Solutions::SmoothFlow{},
+      DummyEvolutionMetaVars<FusedDimensionSweeps>{},
       cell_centered_fluxes,
       evolution::dg::subcell::SubcellOptions{
           4.0, 1_st, 1.0e-3, 1.0e-4, false,
@@ -529,7 +534,7 @@ std::array<double, 5> test(const size_t num_dg_pts,
            get<Tags::TildeB<>>(output_minus_expected_dt_cons_vars))))}};
 }
 
-// [[TimeOut, 10]]
+// [[TimeOut, 15]]
 SPECTRE_TEST_CASE(
     "Unit.Evolution.Systems.ValenciaDivClean.Subcell.TimeDerivative",
     "[Unit][Evolution]") {
@@ -589,6 +594,18 @@ SPECTRE_TEST_CASE(
     }
   }
 
+  // Check that processing one dimension at a time gives the same answer as
+  // processing all dimensions at once
+  for (const std::optional<double>& velocity :
+       {dummy_expansion_velocity, std::optional<double>{0.1}}) {
+    const auto data_unfused = test(5, DO::Two, velocity);
+    const auto data_fused = test<true>(5, DO::Two, velocity);
+    for (size_t i = 0; i < data_unfused.size(); ++i) {
+      CAPTURE(i);
+      CHECK(gsl::at(data_fused, i) == approx(gsl::at(data_unfused, i)));
+    }
+  }
+
   // Now use an expansion map.
   previous_error_5 = {};
   previous_error_6 = {};
@@ -0,0 +1,140 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/BufferedReductionWriter.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+void check_subfile(const std::string& file_name,
+                   const std::string& subfile_name,
+                   const std::vector<std::string>& expected_legend,
+                   const Matrix& expected_data) {
+  const h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
+  const auto& dat_file = h5file.get<h5::Dat>(subfile_name);
+  CHECK(dat_file.get_legend() == expected_legend);
+  CHECK(dat_file.get_data() == expected_data);
+  h5file.close_current_object();
+}
+
+void test_row_count_policy() {
+  const std::string file_prefix = "Unit.IO.Observers.BufferedReductionWriter";
+  const std::string file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  const std::vector<std::string> legend_a{"Time", "A"};
+  const std::vector<std::string> legend_b{"Time", "B", "C"};
+
+  // Never flush because of the wallclock
+  observers::BufferedReductionWriter writer{3, 1.0e300};
+  CHECK(writer.max_buffered_rows() == 3);
+  CHECK(writer.max_seconds_between_flushes() == 1.0e300);
+
+  writer.append(file_prefix, "/a", "", legend_a, {0.0, 1.0});
+  writer.append(file_prefix, "/b", "", legend_b, {0.0, 2.0, 3.0});
+  CHECK(writer.number_of_buffered_rows() == 2);
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+
+  // Checkpointing keeps the buffered rows
+  writer = serialize_and_deserialize(writer);
+  CHECK(writer.number_of_buffered_rows() == 2);
+  CHECK(writer.max_buffered_rows() == 3);
+
+  // Reaching the maximum number of rows writes all subfiles
+  writer.append(file_prefix, "/a", "", legend_a, {1.0, 4.0});
+  CHECK(writer.number_of_buffered_rows() == 0);
+  REQUIRE(file_system::check_if_file_exists(file_name));
+  {
+    Matrix expected_a(2, 2);
+    expected_a(0, 0) = 0.0;
+    expected_a(0, 1) = 1.0;
+    expected_a(1, 0) = 1.0;
+    expected_a(1, 1) = 4.0;
+    check_subfile(file_name, "/a", legend_a, expected_a);
+    Matrix expected_b(1, 3);
+    expected_b(0, 0) = 0.0;
+    expected_b(0, 1) = 2.0;
+    expected_b(0, 2) = 3.0;
+    check_subfile(file_name, "/b", legend_b, expected_b);
+  }
+
+  // An explicit flush appends to the existing subfiles
+  writer.append(file_prefix, "/b", "", legend_b, {1.0, 5.0, 6.0});
+  CHECK(writer.number_of_buffered_rows() == 1);
+  writer.flush();
+  CHECK(writer.number_of_buffered_rows() == 0);
+  {
+    Matrix expected_b(2, 3);
+    expected_b(0, 0) = 0.0;
+    expected_b(0, 1) = 2.0;
+    expected_b(0, 2) = 3.0;
+    expected_b(1, 0) = 1.0;
+    expected_b(1, 1) = 5.0;
+    expected_b(1, 2) = 6.0;
+    check_subfile(file_name, "/b", legend_b, expected_b);
+  }
+  // Flushing an empty buffer does nothing
+  writer.flush();
+
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+void test_wallclock_policy() {
+  const std::string file_prefix =
+      "Unit.IO.Observers.BufferedReductionWriter.Wallclock";
+  const std::string file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  // A zero interval writes every row immediately
+  observers::BufferedReductionWriter writer{1000, 0.0};
+  writer.append(file_prefix, "/a", "", {"Time", "A"}, {0.0, 1.0});
+  CHECK(writer.number_of_buffered_rows() == 0);
+  CHECK(file_system::check_if_file_exists(file_name));
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.BufferedReductionWriter",
+                  "[Unit][Observers]") {
+  const observers::BufferedReductionWriter default_writer{};
+  CHECK(default_writer.number_of_buffered_rows() == 0);
+  CHECK(default_writer.max_buffered_rows() ==
+        observers::BufferedReductionWriter::default_max_buffered_rows);
+  CHECK(default_writer.max_seconds_between_flushes() ==
+        observers::BufferedReductionWriter::
+            default_max_seconds_between_flushes);
+
+  test_row_count_policy();
+  test_wallclock_policy();
+
+  CHECK_THROWS_WITH(
+      ([]() {
+        observers::BufferedReductionWriter writer{};
+        writer.append("Unused", "/a", "", {"Time", "A"}, {0.0});
+      }()),
+      Catch::Matchers::ContainsSubstring(
+          "There must be one name provided for each piece of data"));
+  CHECK_THROWS_WITH(
+      ([]() {
+        observers::BufferedReductionWriter writer{};
+        writer.append("Unused", "/a", "", {"Time", "A"}, {0.0, 1.0});
+        writer.append("Unused", "/a", "", {"Time", "B"}, {0.0, 1.0});
+      }()),
+      Catch::Matchers::ContainsSubstring("The legend for subfile '/a'"));
+}
@@ -264,6 +264,14 @@ void test_reduction_observer(const bool observe_per_core) {
     REQUIRE(
         ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
 
+    // The reduction data is buffered on node 0 until it is flushed
+    CHECK_FALSE(file_system::check_if_file_exists(h5_file_name));
+    CHECK(ActionTesting::get_databox_tag<obs_writer,
+                                         observers::Tags::ReductionWriteBuffer>(
+              runner, 0)
+              .number_of_buffered_rows() == 1);
+    runner.threaded_action<obs_writer,
+                           observers::ThreadedActions::FlushReductionData>(0);
     REQUIRE(file_system::check_if_file_exists(h5_file_name));
     REQUIRE(file_system::check_if_file_exists(output_file_prefix + "0.h5") ==
             observe_per_core);
@@ -278,6 +286,8 @@ void test_reduction_observer(const bool observe_per_core) {
                            observers::ThreadedActions::WriteReductionDataRow>(
         0, "/element_data", legend,
         std::make_tuple(0., 1., single_row_of_data));
+    runner.threaded_action<obs_writer,
+                           observers::ThreadedActions::FlushReductionData>(0);
 
     // Check that the H5 file was written correctly.
     {
@@ -33,6 +33,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
+  TestHelpers::db::test_simple_tag<ReductionWriteBuffer>(
+      "ReductionWriteBuffer");
   TestHelpers::db::test_simple_tag<ObservationKey<TestTag>>(
       "ObservationKey(TestTag)");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
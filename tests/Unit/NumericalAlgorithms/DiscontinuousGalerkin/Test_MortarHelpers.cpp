@@ -6,8 +6,11 @@
 #include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <random>
 #include <utility>
+#include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -18,6 +21,8 @@
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -315,10 +320,68 @@ void test_projections() {
     }
   }
 }
+
+template <size_t Dim>
+void test_project_to_mortars(
+    const Mesh<Dim>& face_mesh,
+    const std::vector<std::pair<Mesh<Dim>, dg::MortarSize<Dim>>>& mortars) {
+  CAPTURE(face_mesh);
+  const size_t number_of_components = 3;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<DataVector> face_data{};
+  std::vector<DataVector> mortar_data{};
+  std::vector<dg::MortarProjection<Dim>> projections{};
+  // Reserve so the data pointers stay valid
+  face_data.reserve(mortars.size());
+  mortar_data.reserve(mortars.size());
+  for (const auto& [mortar_mesh, mortar_size] : mortars) {
+    face_data.push_back(make_with_random_values<DataVector>(
+        make_not_null(&gen), make_not_null(&dist),
+        DataVector{number_of_components * face_mesh.number_of_grid_points()}));
+    mortar_data.emplace_back(number_of_components *
+                             mortar_mesh.number_of_grid_points());
+    projections.push_back(dg::MortarProjection<Dim>{
+        face_data.back().data(), mortar_data.back().data(), face_mesh,
+        mortar_mesh, mortar_size});
+  }
+  dg::project_to_mortars(projections, number_of_components);
+  for (size_t i = 0; i < mortars.size(); ++i) {
+    CAPTURE(i);
+    CHECK_ITERABLE_APPROX(
+        mortar_data[i],
+        apply_matrices(Spectral::projection_matrix_parent_to_child(
+                           face_mesh, mortars[i].first, mortars[i].second),
+                       face_data[i], face_mesh.extents()));
+  }
+}
+
+void test_batched_projections() {
+  using Spectral::MortarSize;
+  // Projections sharing the same matrices are projected together, the others
+  // one by one
+  test_project_to_mortars(
+      lgl_mesh<1>({{3}}),
+      {{lgl_mesh<1>({{3}}), {{MortarSize::LowerHalf}}},
+       {lgl_mesh<1>({{3}}), {{MortarSize::UpperHalf}}},
+       {lgl_mesh<1>({{3}}), {{MortarSize::LowerHalf}}},
+       {lgl_mesh<1>({{5}}), {{MortarSize::Full}}},
+       {lgl_mesh<1>({{3}}), {{MortarSize::LowerHalf}}}});
+  test_project_to_mortars(
+      lgl_mesh<2>({{3, 4}}),
+      {{lgl_mesh<2>({{3, 4}}), {{MortarSize::LowerHalf, MortarSize::Full}}},
+       {lgl_mesh<2>({{3, 4}}), {{MortarSize::UpperHalf, MortarSize::Full}}},
+       {lgl_mesh<2>({{3, 5}}), {{MortarSize::Full, MortarSize::Full}}},
+       {lgl_mesh<2>({{3, 4}}), {{MortarSize::LowerHalf, MortarSize::Full}}},
+       {lgl_mesh<2>({{3, 4}}), {{MortarSize::UpperHalf, MortarSize::Full}}},
+       {lgl_mesh<2>({{4, 4}}),
+        {{MortarSize::LowerHalf, MortarSize::UpperHalf}}}});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DG.MortarHelpers", "[Unit][NumericalAlgorithms]") {
   test_mortar_mesh();
   test_mortar_size();
   test_projections();
+  test_batched_projections();
 }
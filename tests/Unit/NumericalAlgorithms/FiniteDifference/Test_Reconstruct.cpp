@@ -0,0 +1,138 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/FiniteDifference/AoWeno.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Minmod.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/PositivityPreservingAdaptiveOrder.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Reconstruct.tpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Check that `detail::reconstruct` gives the same result as calling the
+// scalar `pointwise` function on each stripe. In 1d each variable is one
+// stripe, so with many variables the stripes are reconstructed both in SIMD
+// blocks (when built with xsimd) and by the scalar remainder loop.
+template <typename Reconstructor, typename... Args>
+void test_stripes(const gsl::not_null<std::mt19937*> generator,
+                  const Args&... args) {
+  constexpr size_t ghost_zone = Reconstructor::stencil_width() / 2 + 1;
+  const size_t number_of_cells = Reconstructor::stencil_width() + 2;
+  const size_t number_of_variables = 19;
+  // Positive data so the positivity-preserving reconstructions mostly use
+  // the high orders
+  std::uniform_real_distribution<> distribution(0.5, 1.5);
+  const auto volume_vars = make_with_random_values<DataVector>(
+      generator, make_not_null(&distribution),
+      DataVector(number_of_cells * number_of_variables));
+  const auto lower_ghost = make_with_random_values<DataVector>(
+      generator, make_not_null(&distribution),
+      DataVector(ghost_zone * number_of_variables));
+  const auto upper_ghost = make_with_random_values<DataVector>(
+      generator, make_not_null(&distribution),
+      DataVector(ghost_zone * number_of_variables));
+  DirectionMap<1, gsl::span<const double>> ghost_cell_vars{};
+  ghost_cell_vars[Direction<1>::lower_xi()] =
+      gsl::make_span(lower_ghost.data(), lower_ghost.size());
+  ghost_cell_vars[Direction<1>::upper_xi()] =
+      gsl::make_span(upper_ghost.data(), upper_ghost.size());
+
+  const size_t face_size = (number_of_cells + 1) * number_of_variables;
+  DataVector upper(face_size);
+  DataVector lower(face_size);
+  std::array<gsl::span<double>, 1> upper_span{
+      gsl::make_span(upper.data(), upper.size())};
+  std::array<gsl::span<double>, 1> lower_span{
+      gsl::make_span(lower.data(), lower.size())};
+  std::vector<std::uint8_t> order_storage(
+      number_of_cells + 2, std::numeric_limits<std::uint8_t>::max());
+  std::optional<std::array<gsl::span<std::uint8_t>, 1>> order{
+      {{gsl::make_span(order_storage.data(), order_storage.size())}}};
+  fd::reconstruction::detail::reconstruct<Reconstructor>(
+      make_not_null(&upper_span), make_not_null(&lower_span),
+      make_not_null(&order),
+      gsl::make_span(volume_vars.data(), volume_vars.size()), ghost_cell_vars,
+      Index<1>{number_of_cells}, number_of_variables, args...);
+
+  DataVector expected_upper(face_size);
+  DataVector expected_lower(face_size);
+  std::vector<std::uint8_t> expected_order(
+      number_of_cells + 2, std::numeric_limits<std::uint8_t>::max());
+  std::vector<double> stripe(number_of_cells + 2 * ghost_zone);
+  for (size_t var = 0; var < number_of_variables; ++var) {
+    for (size_t i = 0; i < ghost_zone; ++i) {
+      stripe[i] = lower_ghost[var * ghost_zone + i];
+      stripe[ghost_zone + number_of_cells + i] =
+          upper_ghost[var * ghost_zone + i];
+    }
+    for (size_t i = 0; i < number_of_cells; ++i) {
+      stripe[ghost_zone + i] = volume_vars[var * number_of_cells + i];
+    }
+    for (size_t i = 0; i < number_of_cells + 2; ++i) {
+      // `i` is the cell index counted from the lower neighbor's cell nearest
+      // to the boundary
+      const auto result = Reconstructor::pointwise(
+          &stripe[ghost_zone - 1 + i], 1, args...);
+      const size_t offset = (number_of_cells + 1) * var;
+      if (i > 0) {
+        expected_upper[offset + i - 1] = std::get<0>(result);
+      }
+      if (i < number_of_cells + 1) {
+        expected_lower[offset + i] = std::get<1>(result);
+      }
+      if constexpr (std::tuple_size_v<std::decay_t<decltype(result)>> > 2) {
+        expected_order[i] =
+            std::min(static_cast<std::uint8_t>(std::get<2>(result)),
+                     expected_order[i]);
+      }
+    }
+  }
+  CHECK_ITERABLE_APPROX(upper, expected_upper);
+  CHECK_ITERABLE_APPROX(lower, expected_lower);
+  CHECK(order_storage == expected_order);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.FiniteDifference.ReconstructStripes",
+                  "[Unit][NumericalAlgorithms]") {
+  MAKE_GENERATOR(generator);
+  namespace recons = fd::reconstruction::detail;
+  test_stripes<recons::MinmodReconstructor>(make_not_null(&generator));
+  test_stripes<recons::MonotonisedCentralReconstructor>(
+      make_not_null(&generator));
+  test_stripes<recons::Wcns5zReconstructor<2, void>>(make_not_null(&generator),
+                                                     2.0e-16, size_t{0});
+  test_stripes<
+      recons::Wcns5zReconstructor<2, recons::MonotonisedCentralReconstructor>>(
+      make_not_null(&generator), 2.0e-16, size_t{1});
+  test_stripes<recons::MonotonicityPreserving5Reconstructor>(
+      make_not_null(&generator), 4.0, 1.0e-10);
+  test_stripes<recons::AoWeno53Reconstructor<8>>(make_not_null(&generator),
+                                                 0.85, 0.999, 1.0e-12);
+  test_stripes<recons::PositivityPreservingAdaptiveOrderReconstructor<
+      recons::MonotonisedCentralReconstructor, true, true, true>>(
+      make_not_null(&generator), 4.0, 6.0, 8.0);
+  test_stripes<recons::PositivityPreservingAdaptiveOrderReconstructor<
+      recons::MinmodReconstructor, false, false, false>>(
+      make_not_null(&generator), 4.0, 6.0, 8.0);
+}
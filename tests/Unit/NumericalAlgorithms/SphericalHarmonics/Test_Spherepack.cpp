@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -151,6 +152,67 @@ void test_loop_over_offset(
   }
 }
 
+void test_multiple_fields(const size_t l_max, const size_t m_max) {
+  const Spherepack ylm_spherepack(l_max, m_max);
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+  const size_t physical_size = ylm_spherepack.physical_size();
+  const size_t spectral_size = ylm_spherepack.spectral_size();
+
+  const std::vector<DataVector> fields{
+      YlmTestFunctions::FuncA{}.func(theta, phi),
+      YlmTestFunctions::FuncB{}.func(theta, phi),
+      YlmTestFunctions::FuncC{}.func(theta, phi)};
+  const size_t number_of_fields = fields.size();
+  DataVector u(physical_size * number_of_fields);
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    std::copy(fields[k].begin(), fields[k].end(),
+              u.begin() + static_cast<std::ptrdiff_t>(k * physical_size));
+  }
+
+  const auto u_spec =
+      ylm_spherepack.phys_to_spec_multiple_fields(u, number_of_fields);
+  const auto u_roundtrip =
+      ylm_spherepack.spec_to_phys_multiple_fields(u_spec, number_of_fields);
+  CHECK_ITERABLE_APPROX(u_roundtrip, u);
+  const auto du =
+      ylm_spherepack.gradient_multiple_fields(u, number_of_fields);
+  const auto laplacian_u =
+      ylm_spherepack.scalar_laplacian_multiple_fields(u, number_of_fields);
+
+  // Each field must agree with the single-field interfaces
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    const DataVector expected_spec = ylm_spherepack.phys_to_spec(fields[k]);
+    const DataVector field_spec{};
+    make_const_view(make_not_null(&field_spec), u_spec, k * spectral_size,
+                    spectral_size);
+    CHECK_ITERABLE_APPROX(field_spec, expected_spec);
+
+    const auto expected_du = ylm_spherepack.gradient(fields[k]);
+    for (size_t i = 0; i < 2; ++i) {
+      const DataVector field_du{};
+      make_const_view(make_not_null(&field_du), du.get(i), k * physical_size,
+                      physical_size);
+      CHECK_ITERABLE_APPROX(field_du, expected_du.get(i));
+    }
+
+    const DataVector expected_laplacian =
+        ylm_spherepack.scalar_laplacian(fields[k]);
+    const DataVector field_laplacian{};
+    make_const_view(make_not_null(&field_laplacian), laplacian_u,
+                    k * physical_size, physical_size);
+    CHECK_ITERABLE_APPROX(field_laplacian, expected_laplacian);
+  }
+
+  // A single field goes through the unbatched code path
+  const DataVector single_spec =
+      ylm_spherepack.phys_to_spec_multiple_fields(fields[0], 1);
+  CHECK_ITERABLE_APPROX(single_spec, ylm_spherepack.phys_to_spec(fields[0]));
+  CHECK_ITERABLE_APPROX(
+      ylm_spherepack.scalar_laplacian_multiple_fields(fields[0], 1),
+      ylm_spherepack.scalar_laplacian(fields[0]));
+}
+
 void test_theta_phi_points(
     const size_t l_max, const size_t m_max,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -799,6 +861,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Spherepack",
   }
 
   test_prolong_restrict();
+  test_multiple_fields(10, 10);
+  test_multiple_fields(10, 7);
 
   Spherepack s(4, 4);
   auto s_copy(s);
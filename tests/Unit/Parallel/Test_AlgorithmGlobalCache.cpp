@@ -97,12 +97,32 @@ struct initialize {
   }
 };
 
+// Global variable to make sure that the mutation overtook a queued message.
+size_t number_of_calls_to_check_mutation_was_expedited = 0;
+
+// Sent before the mutation, but since `GlobalCache::mutate` is an expedited
+// entry method it runs after the mutation has been applied.
+struct check_mutation_was_expedited {
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/) {
+    ++number_of_calls_to_check_mutation_was_expedited;
+    const std::vector<double> expected_result{42.0};
+    SPECTRE_PARALLEL_REQUIRE(Parallel::get<Tags::VectorOfDoubles>(cache) ==
+                             expected_result);
+  }
+};
+
 struct add_new_stored_double {
   template <typename ParallelComponent, typename... DbTags,
             typename Metavariables, typename ArrayIndex>
   static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/) {
+    Parallel::simple_action<check_mutation_was_expedited>(
+        Parallel::get_parallel_component<ParallelComponent>(cache));
     // [mutate_global_cache_item]
     Parallel::mutate<Tags::VectorOfDoubles,
                      MutationFunctions::add_stored_double>(cache, 42.0);
@@ -132,6 +152,8 @@ struct finalize {
         number_of_calls_to_check_and_use_stored_double_is_ready == 2);
     SPECTRE_PARALLEL_REQUIRE(
         number_of_calls_to_check_and_use_stored_double_apply == 1);
+    SPECTRE_PARALLEL_REQUIRE(
+        number_of_calls_to_check_mutation_was_expedited == 1);
   }
 };
 
@@ -215,7 +237,8 @@ struct use_stored_double {
 //
 // 1) MutateCacheComponent mutates the value in the GlobalCache using
 //    simple_actions, and then tests that the value in the GlobalCache
-//    is correct, using simple_actions.
+//    is correct, using simple_actions. It also checks that the mutation
+//    overtakes a simple action that was queued before it.
 //
 // 2) UseMutatedCacheComponent has a single iterable_action that waits
 //    for the size of the value in the GlobalCache to be correct.
@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <fstream>
+#include <string>
+
+#include "Parallel/BackgroundCheckpointDrain.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+void write_file(const std::string& filename, const std::string& contents) {
+  std::ofstream file(filename);
+  file << contents;
+}
+
+std::string read_file(const std::string& filename) {
+  std::ifstream file(filename);
+  std::string contents{};
+  std::getline(file, contents);
+  return contents;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.BackgroundCheckpointDrain",
+                  "[Unit][Parallel]") {
+  const std::string base_dir = "Unit.Parallel.BackgroundCheckpointDrain";
+  if (file_system::check_if_dir_exists(base_dir)) {
+    file_system::rm(base_dir, true);
+  }
+  const std::string checkpoint_dir = base_dir + "/Checkpoints/Checkpoint_0000";
+  const std::string staging_dir_node0 = base_dir + "/Node0";
+  const std::string staging_dir_node1 = base_dir + "/Node1";
+  file_system::create_directory(staging_dir_node0 + "/Sub");
+  file_system::create_directory(staging_dir_node1 + "/Sub");
+  write_file(staging_dir_node0 + "/RestartInfo", "Info");
+  write_file(staging_dir_node0 + "/Sub/Proc0", "Data0");
+  write_file(staging_dir_node1 + "/Sub/Proc1", "Data1");
+
+  {
+    Parallel::BackgroundCheckpointDrain drain{};
+    CHECK_FALSE(drain.is_draining());
+    drain.start(staging_dir_node0, checkpoint_dir);
+    CHECK(drain.is_draining());
+    // Waits for the first drain
+    drain.start(staging_dir_node1, checkpoint_dir);
+    drain.wait();
+    CHECK_FALSE(drain.is_draining());
+    // Waiting again does nothing
+    drain.wait();
+  }
+  CHECK_FALSE(file_system::check_if_dir_exists(staging_dir_node0));
+  CHECK_FALSE(file_system::check_if_dir_exists(staging_dir_node1));
+  CHECK(read_file(checkpoint_dir + "/RestartInfo") == "Info");
+  CHECK(read_file(checkpoint_dir + "/Sub/Proc0") == "Data0");
+  CHECK(read_file(checkpoint_dir + "/Sub/Proc1") == "Data1");
+
+  const std::string marker =
+      checkpoint_dir + "/" + Parallel::checkpoint_completion_marker;
+  CHECK_FALSE(file_system::check_if_file_exists(marker));
+  Parallel::write_checkpoint_completion_marker(checkpoint_dir);
+  CHECK(file_system::check_if_file_exists(marker));
+
+  {
+    Parallel::BackgroundCheckpointDrain drain{};
+    drain.start(base_dir + "/DoesNotExist", checkpoint_dir);
+    CHECK_THROWS_WITH(
+        drain.wait(),
+        Catch::Matchers::ContainsSubstring(
+            "Failed to move the checkpoint from "
+            "'Unit.Parallel.BackgroundCheckpointDrain/DoesNotExist' to "
+            "'Unit.Parallel.BackgroundCheckpointDrain/Checkpoints/"
+            "Checkpoint_0000'"));
+    CHECK_FALSE(drain.is_draining());
+  }
+  CHECK_THROWS_WITH(
+      Parallel::write_checkpoint_completion_marker(base_dir + "/DoesNotExist"),
+      Catch::Matchers::ContainsSubstring(
+          "Could not write the checkpoint completion marker"));
+
+  file_system::rm(base_dir, true);
+}
@@ -3,10 +3,14 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <map>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -23,16 +27,27 @@
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArrayItems.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Numeric.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 namespace {
+struct TestDoubleVectorTag : db::SimpleTag {
+  using type = std::vector<double>;
+};
+
+struct TestInboxTag {
+  using type = std::vector<double>;
+};
+
 template <typename Metavariables>
 struct MockMemoryMonitor {
   using chare_type = ActionTesting::MockSingletonChare;
@@ -471,6 +486,70 @@ void test_process_singleton() {
   check_output<sing_comp<metavars>>(runner, time, num_nodes, sizes);
 }
 
+void test_process_array_items() {
+  INFO("Test ProcessArrayItems");
+  {
+    INFO("size_of_items");
+    const auto box = db::create<tmpl::list<TestDoubleVectorTag>>(
+        std::vector<double>(10, 1.0));
+    const tuples::TaggedTuple<TestInboxTag> inboxes{
+        std::vector<double>(20, 2.0)};
+    const auto item_sizes = mem_monitor::size_of_items(box, inboxes);
+    CHECK(item_sizes.size() == 2);
+    CHECK(item_sizes.at(pretty_type::get_name<TestDoubleVectorTag>()) ==
+          size_of_object_in_bytes(std::vector<double>(10, 1.0)));
+    CHECK(item_sizes.at("Inbox(" + pretty_type::get_name<TestInboxTag>() +
+                        ")") ==
+          size_of_object_in_bytes(std::vector<double>(20, 2.0)));
+
+    const auto summed_sizes =
+        mem_monitor::AddItemSizes{}(item_sizes, item_sizes);
+    for (const auto& [name, size] : item_sizes) {
+      CHECK(summed_sizes.at(name) == 2 * size);
+    }
+  }
+
+  const size_t num_nodes = 2;
+  const size_t num_procs_per_node = 3;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<mem_mon_comp<metavars>>(runner, 0);
+  auto& mem_monitor_proxy =
+      Parallel::get_parallel_component<mem_mon_comp<metavars>>(cache);
+
+  const double time = 0.5;
+  const std::map<std::string, size_t> item_sizes{
+      {"Inbox(BoundaryData)", 3000000}, {"EvolvedVars", 5000000}};
+
+  Parallel::simple_action<
+      mem_monitor::ProcessArrayItems<array_comp<metavars>>>(mem_monitor_proxy,
+                                                            time, item_sizes);
+  ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+      make_not_null(&runner), 0);
+  CHECK(ActionTesting::number_of_queued_threaded_actions<
+            obs_writer_comp<metavars>>(runner, 0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat(
+      mem_monitor::items_subfile_name<array_comp<metavars>>());
+  CHECK(dataset.get_legend() ==
+        std::vector<std::string>{"Time", "EvolvedVars (MB)",
+                                 "Inbox(BoundaryData) (MB)", "Total (MB)"});
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  CHECK(data(0, 0) == time);
+  CHECK(data(0, 1) == 5.0);
+  CHECK(data(0, 2) == 3.0);
+  CHECK(data(0, 3) == 8.0);
+}
+
 struct BadArrayChareMetavariables {
   using component_list =
       tmpl::list<ArrayParallelComponent<BadArrayChareMetavariables>>;
@@ -483,7 +562,7 @@ void test_event_construction() {
         std::vector<std::string> misspelled_component{"GlabolCahce"};
 
         Events::MonitorMemory<1> event{
-            {misspelled_component}, Options::Context{}, metavars{}};
+            {misspelled_component}, false, Options::Context{}, metavars{}};
       }()),
       Catch::Matchers::ContainsSubstring(
           "Cannot monitor memory usage of unknown parallel component"));
@@ -492,7 +571,7 @@ void test_event_construction() {
       ([]() {
         std::vector<std::string> array_component{"ArrayParallelComponent"};
 
-        Events::MonitorMemory<2> event{{array_component},
+        Events::MonitorMemory<2> event{{array_component}, false,
                                        Options::Context{},
                                        BadArrayChareMetavariables{}};
       }()),
@@ -531,15 +610,17 @@ void test_monitor_memory_event() {
 
   // Create event
   Events::MonitorMemory<3> monitor_memory{
-      {components_to_monitor}, Options::Context{}, metavars{}};
+      {components_to_monitor}, true, Options::Context{}, metavars{}};
 
   const auto& element =
       ActionTesting::get_databox_tag<dg_elem_comp<event_metavars>,
                                      domain::Tags::Element<3>>(runner, 0);
+  const auto& box =
+      ActionTesting::get_databox<dg_elem_comp<event_metavars>>(runner, 0);
 
   // Run the event. This will queue a lot of actions
   const double time = 1.4;
-  monitor_memory(element, cache, 0,
+  monitor_memory(element, box, cache, 0,
                  std::add_pointer_t<dg_elem_comp<event_metavars>>{},
                  {"TimeName", time});
 
@@ -661,6 +742,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
   test_process_singleton();
+  test_process_array_items();
   test_event_construction();
   test_monitor_memory_event();
 }
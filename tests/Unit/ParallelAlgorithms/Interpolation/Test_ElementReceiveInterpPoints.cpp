@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <type_traits>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -72,9 +73,13 @@ struct mock_interpolation_target {
               Metavariables, InterpolationTargetTag>>>,
       Parallel::PhaseActions<
           Parallel::Phase::Register,
-          tmpl::list<
-              intrp::Actions::InterpolationTargetSendTimeIndepPointsToElements<
-                  InterpolationTargetTag>>>>;
+          tmpl::conditional_t<
+              intrp::InterpolationTarget_detail::points_are_time_dependent_v<
+                  InterpolationTargetTag>,
+              tmpl::list<>,
+              tmpl::list<intrp::Actions::
+                             InterpolationTargetSendTimeIndepPointsToElements<
+                                 InterpolationTargetTag>>>>>;
   using component_being_mocked =
       intrp::InterpolationTarget<Metavariables, InterpolationTargetTag>;
 };
@@ -108,13 +113,30 @@ struct MockMetavariables {
     template <typename Metavariables>
     using interpolating_component = mock_element<Metavariables>;
   };
+  struct InterpolationTargetC
+      : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
+    using temporal_id = ::Tags::TimeStepId;
+    using vars_to_interpolate_to_target = tmpl::list<Tags::TestSolution>;
+    using compute_items_on_target = tmpl::list<>;
+    using compute_target_points =
+        ::intrp::TargetPoints::LineSegment<InterpolationTargetC, 3,
+                                           Frame::Inertial>;
+    using post_interpolation_callbacks =
+        tmpl::list<intrp::callbacks::ObserveTimeSeriesOnSurface<
+            tmpl::list<>, InterpolationTargetC>>;
+    using points_are_time_dependent = std::true_type;
+    template <typename Metavariables>
+    using interpolating_component = mock_element<Metavariables>;
+  };
   static constexpr size_t volume_dim = 3;
   using interpolation_target_tags =
-      tmpl::list<InterpolationTargetA, InterpolationTargetB>;
+      tmpl::list<InterpolationTargetA, InterpolationTargetB,
+                 InterpolationTargetC>;
 
   using component_list = tmpl::list<
       mock_interpolation_target<MockMetavariables, InterpolationTargetA>,
       mock_interpolation_target<MockMetavariables, InterpolationTargetB>,
+      mock_interpolation_target<MockMetavariables, InterpolationTargetC>,
       mock_element<MockMetavariables>>;
 };
 
@@ -129,6 +151,9 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ElementReceivePoints",
   using target_component_b =
       mock_interpolation_target<metavars,
                                 typename metavars::InterpolationTargetB>;
+  using target_component_c =
+      mock_interpolation_target<metavars,
+                                typename metavars::InterpolationTargetC>;
   using elem_component = mock_element<metavars>;
 
   // Options
@@ -138,13 +163,18 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ElementReceivePoints",
       {{1.0, 1.0, 1.0}}, {{2.4, 2.4, 2.4}}, 15);
   intrp::OptionHolders::LineSegment<3> line_segment_opts_b(
       {{1.0, 1.0, 1.0}}, {{2.1, 2.1, 2.1}}, 12);
+  intrp::OptionHolders::LineSegment<3> line_segment_opts_c(
+      {{1.0, 1.0, 1.0}}, {{1.5, 1.5, 1.5}}, 6);
   tuples::TaggedTuple<intrp::Tags::LineSegment<metavars::InterpolationTargetA,
                                                metavars::volume_dim>,
                       intrp::Tags::LineSegment<metavars::InterpolationTargetB,
                                                metavars::volume_dim>,
+                      intrp::Tags::LineSegment<metavars::InterpolationTargetC,
+                                               metavars::volume_dim>,
                       domain::Tags::Domain<metavars::volume_dim>>
       tuple_of_opts{std::move(line_segment_opts_a),
                     std::move(line_segment_opts_b),
+                    std::move(line_segment_opts_c),
                     domain_creator.create_domain()};
 
   // Initialization
@@ -159,6 +189,10 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ElementReceivePoints",
   for (size_t i = 0; i < 2; ++i) {
     ActionTesting::next_action<target_component_b>(make_not_null(&runner), 0);
   }
+  ActionTesting::emplace_component<target_component_c>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<target_component_c>(make_not_null(&runner), 0);
+  }
   ActionTesting::emplace_component<elem_component>(&runner, 0);
   for (size_t i = 0; i < 2; ++i) {
     ActionTesting::next_action<elem_component>(make_not_null(&runner), 0);
@@ -182,6 +216,12 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ElementReceivePoints",
   CHECK(get<intrp::Vars::PointInfoTag<metavars::InterpolationTargetB,
                                       metavars::volume_dim>>(
             init_point_infos) == point_info_type{});
+  CHECK(get<intrp::Vars::PointInfoTag<metavars::InterpolationTargetC,
+                                      metavars::volume_dim>>(init_point_infos)
+            .points.empty());
+  CHECK(get<intrp::Vars::PointInfoTag<metavars::InterpolationTargetC,
+                                      metavars::volume_dim>>(init_point_infos)
+            .volume_data.empty());
 
   // Now invoke the only Registration action (InterpolationTargetSendPoints).
   ActionTesting::next_action<target_component_a>(make_not_null(&runner), 0);
@@ -233,6 +273,14 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ElementReceivePoints",
   // Should be no queued simple actions on either component.
   CHECK(runner.is_simple_action_queue_empty<target_component_a>(0));
   CHECK(runner.is_simple_action_queue_empty<target_component_b>(0));
+  CHECK(runner.is_simple_action_queue_empty<target_component_c>(0));
   CHECK(runner.is_simple_action_queue_empty<elem_component>(0));
+
+  // Target C has time-dependent points, so nothing was sent during
+  // registration. The elements ask for them when they interpolate, which is
+  // tested in Test_InterpolateWithoutInterpComponent.
+  CHECK(get<intrp::Vars::PointInfoTag<metavars::InterpolationTargetC,
+                                      metavars::volume_dim>>(point_infos)
+            .points.empty());
 }
 }  // namespace
@@ -4,39 +4,53 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <deque>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/Sphere.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Creators/Tags/FunctionsOfTime.hpp"
 #include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/ParallelAlgorithms/Interpolation/InterpolateOnElementTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/ElementReceiveInterpPoints.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetSendPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Callbacks/ObserveTimeSeriesOnSurface.hpp"
 #include "ParallelAlgorithms/Interpolation/Events/InterpolateWithoutInterpComponent.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeVarsToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "ParallelAlgorithms/Interpolation/Targets/LineSegment.hpp"
 #include "ParallelAlgorithms/Interpolation/Targets/Sphere.hpp"
+#include "Time/Slab.hpp"
 #include "Time/Tags/TimeStepId.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 namespace {
 
@@ -174,6 +188,251 @@ void run_test() {
       initialize_elements_and_queue_simple_actions<metavars, elem_component>{});
 }
 
+template <typename Metavariables>
+struct mock_element_with_time_dependent_points {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<Metavariables::volume_dim>;
+  using simple_tags = tmpl::list<
+      ::Tags::TimeStepId, intrp::Tags::InterpPointInfo<Metavariables>,
+      ::Events::Tags::ObserverMesh<Metavariables::volume_dim>,
+      domain::Tags::Coordinates<Metavariables::volume_dim, Frame::Inertial>,
+      ::Tags::Variables<
+          tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+template <typename Metavariables, typename InterpolationTargetTag>
+struct mock_interpolation_target_with_time_dependent_points {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using component_being_mocked =
+      intrp::InterpolationTarget<Metavariables, InterpolationTargetTag>;
+  using temporal_id = typename InterpolationTargetTag::temporal_id::type;
+  using simple_tags =
+      tmpl::list<InterpolateOnElementTestHelpers::Tags::TestTargetPoints,
+                 intrp::Tags::PendingTemporalIds<temporal_id>,
+                 intrp::Tags::TemporalIds<temporal_id>,
+                 intrp::Tags::CompletedTemporalIds<temporal_id>>;
+  using const_global_cache_tags =
+      Parallel::get_const_global_cache_tags_from_actions<
+          tmpl::list<typename InterpolationTargetTag::compute_target_points>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+  using replace_these_simple_actions =
+      tmpl::list<intrp::Actions::InterpolationTargetVarsFromElement<
+          InterpolationTargetTag>>;
+  using with_these_simple_actions =
+      tmpl::list<InterpolateOnElementTestHelpers::
+                     MockInterpolationTargetVarsFromElement<
+                         InterpolationTargetTag>>;
+};
+
+struct MockMetavariablesWithTimeDependentPoints {
+  struct InterpolationTargetA
+      : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
+    using temporal_id = ::Tags::TimeStepId;
+    using compute_items_on_target = tmpl::list<>;
+    using vars_to_interpolate_to_target =
+        tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
+    using compute_target_points =
+        ::intrp::TargetPoints::LineSegment<InterpolationTargetA, 3,
+                                           Frame::Inertial>;
+    using post_interpolation_callbacks =
+        tmpl::list<intrp::callbacks::ObserveTimeSeriesOnSurface<
+            tmpl::list<>, InterpolationTargetA>>;
+    using points_are_time_dependent = std::true_type;
+    template <typename Metavariables>
+    using interpolating_component =
+        mock_element_with_time_dependent_points<Metavariables>;
+  };
+  static constexpr size_t volume_dim = 3;
+  using const_global_cache_tags = tmpl::list<domain::Tags::Domain<3>>;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+
+  using component_list =
+      tmpl::list<mock_interpolation_target_with_time_dependent_points<
+                     MockMetavariablesWithTimeDependentPoints,
+                     InterpolationTargetA>,
+                 mock_element_with_time_dependent_points<
+                     MockMetavariablesWithTimeDependentPoints>>;
+
+  using event = intrp::Events::InterpolateWithoutInterpComponent<
+      volume_dim, InterpolationTargetA,
+      tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<tmpl::pair<Event, tmpl::list<event>>>;
+  };
+};
+
+void test_time_dependent_points() {
+  using metavars = MockMetavariablesWithTimeDependentPoints;
+  using target_tag = metavars::InterpolationTargetA;
+  using target_component =
+      mock_interpolation_target_with_time_dependent_points<metavars,
+                                                           target_tag>;
+  using elem_component = mock_element_with_time_dependent_points<metavars>;
+  using points_tag = intrp::Vars::PointInfoTag<target_tag, 3>;
+
+  const domain::creators::Sphere domain_creator(
+      0.9, 2.9, domain::creators::Sphere::Excision{}, 2_st, 7_st, false);
+  const auto domain = domain_creator.create_domain();
+  const std::vector<ElementId<3>> element_ids =
+      initial_element_ids(domain_creator.initial_refinement_levels());
+
+  const size_t num_points = 6;
+  tnsr::I<DataVector, 3, Frame::Inertial> target_points(num_points);
+  for (size_t d = 0; d < 3; ++d) {
+    for (size_t i = 0; i < num_points; ++i) {
+      target_points.get(d)[i] = 1.0 + 0.1 * i;
+    }
+  }
+
+  tuples::TaggedTuple<intrp::Tags::LineSegment<target_tag, 3>,
+                      domain::Tags::Domain<3>>
+      tuple_of_opts{intrp::OptionHolders::LineSegment<3>(
+                        {{1.0, 1.0, 1.0}}, {{1.5, 1.5, 1.5}}, num_points),
+                    domain_creator.create_domain()};
+  ActionTesting::MockRuntimeSystem<metavars> runner{std::move(tuple_of_opts)};
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Parallel::Phase::Initialization);
+  ActionTesting::emplace_component_and_initialize<target_component>(
+      &runner, 0, {target_points, {}, {}, {}});
+
+  const Slab slab(0.0, 1.0);
+  const TimeStepId temporal_id(true, 0, Time(slab, Rational(11, 15)));
+  for (const auto& element_id : element_ids) {
+    auto [vars, mesh, inertial_coords] =
+        InterpolateOnElementTestHelpers::make_volume_data_and_mesh<
+            elem_component, false>(domain_creator, runner, domain, element_id,
+                                   temporal_id);
+    ActionTesting::emplace_component_and_initialize<elem_component>(
+        &runner, element_id,
+        {temporal_id, typename intrp::Tags::InterpPointInfo<metavars>::type{},
+         mesh, std::move(inertial_coords), std::move(vars)});
+  }
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+
+  const metavars::event event{};
+  const auto run_event = [&event, &runner](const ElementId<3>& element_id) {
+    // The event never waits for the points.
+    CHECK(static_cast<const Event&>(event).is_ready(
+        ActionTesting::get_databox<elem_component>(runner, element_id),
+        ActionTesting::cache<elem_component>(runner, element_id), element_id,
+        std::add_pointer_t<elem_component>{}));
+    auto& box = ActionTesting::get_databox<elem_component>(
+        make_not_null(&runner), element_id);
+    auto obs_box = make_observation_box<
+        typename metavars::event::compute_tags_for_observation_box>(
+        make_not_null(&box));
+    event.run(make_not_null(&obs_box),
+              ActionTesting::cache<elem_component>(runner, element_id),
+              element_id, std::add_pointer_t<elem_component>{}, {});
+  };
+  const auto point_info = [&runner](const ElementId<3>& element_id)
+      -> const auto& {
+    return get<points_tag>(
+        ActionTesting::get_databox_tag<elem_component,
+                                       intrp::Tags::InterpPointInfo<metavars>>(
+            runner, element_id));
+  };
+  const auto invoke_all_target_actions = [&runner]() {
+    while (not ActionTesting::is_simple_action_queue_empty<target_component>(
+        runner, 0)) {
+      ActionTesting::invoke_queued_simple_action<target_component>(
+          make_not_null(&runner), 0);
+    }
+  };
+
+  // No element has the points yet, so each keeps its volume data and asks the
+  // target for the points exactly once.
+  for (const auto& element_id : element_ids) {
+    run_event(element_id);
+    CHECK(point_info(element_id).points.empty());
+    CHECK(point_info(element_id).volume_data.size() == 1);
+    CHECK(point_info(element_id).volume_data.count(temporal_id) == 1);
+  }
+  CHECK(ActionTesting::number_of_queued_simple_actions<target_component>(
+            runner, 0) == element_ids.size());
+
+  // Only the first request sends the points to the elements.
+  invoke_all_target_actions();
+  CHECK(ActionTesting::get_databox_tag<
+            target_component, intrp::Tags::PendingTemporalIds<TimeStepId>>(
+            runner, 0) == std::deque<TimeStepId>{temporal_id});
+
+  // The elements interpolate their held volume data to the points as soon as
+  // they arrive, and drop both.
+  for (const auto& element_id : element_ids) {
+    REQUIRE(ActionTesting::number_of_queued_simple_actions<elem_component>(
+                runner, element_id) == 1);
+    ActionTesting::invoke_queued_simple_action<elem_component>(
+        make_not_null(&runner), element_id);
+    CHECK(point_info(element_id).points.empty());
+    CHECK(point_info(element_id).volume_data.empty());
+  }
+
+  // The elements containing target points sent the interpolated values to
+  // the target, where they are checked.
+  CHECK_FALSE(ActionTesting::is_simple_action_queue_empty<target_component>(
+      runner, 0));
+  invoke_all_target_actions();
+
+  // At the next temporal id the points arrive before the elements get there,
+  // so the event interpolates to them directly without asking for them.
+  const TimeStepId next_temporal_id(true, 0, Time(slab, Rational(12, 15)));
+  ActionTesting::simple_action<
+      target_component,
+      intrp::Actions::InterpolationTargetSendTimeDepPointsToElements<
+          target_tag>>(make_not_null(&runner), 0, next_temporal_id);
+  for (const auto& element_id : element_ids) {
+    REQUIRE(ActionTesting::number_of_queued_simple_actions<elem_component>(
+                runner, element_id) == 1);
+    ActionTesting::invoke_queued_simple_action<elem_component>(
+        make_not_null(&runner), element_id);
+    CHECK(point_info(element_id).points.count(next_temporal_id) == 1);
+    db::mutate<::Tags::TimeStepId>(
+        [&next_temporal_id](const gsl::not_null<TimeStepId*> time_step_id) {
+          *time_step_id = next_temporal_id;
+        },
+        make_not_null(&ActionTesting::get_databox<elem_component>(
+            make_not_null(&runner), element_id)));
+    run_event(element_id);
+    CHECK(point_info(element_id).points.empty());
+    CHECK(point_info(element_id).volume_data.empty());
+  }
+  CHECK_FALSE(ActionTesting::is_simple_action_queue_empty<target_component>(
+      runner, 0));
+  invoke_all_target_actions();
+
+  // Once the target has started interpolating at the temporal id, the
+  // temporal id is no longer pending and later requests are ignored.
+  auto& target_box = ActionTesting::get_databox<target_component>(
+      make_not_null(&runner), 0);
+  CHECK(intrp::InterpolationTarget_detail::flag_temporal_ids_for_interpolation<
+            target_tag>(make_not_null(&target_box),
+                        std::vector<TimeStepId>{temporal_id}) ==
+        std::vector<TimeStepId>{temporal_id});
+  CHECK(ActionTesting::get_databox_tag<
+            target_component, intrp::Tags::PendingTemporalIds<TimeStepId>>(
+            runner, 0)
+            .empty());
+  ActionTesting::simple_action<
+      target_component,
+      intrp::Actions::InterpolationTargetSendTimeDepPointsToElements<
+          target_tag>>(make_not_null(&runner), 0, temporal_id);
+  for (const auto& element_id : element_ids) {
+    CHECK(ActionTesting::is_simple_action_queue_empty<elem_component>(
+        runner, element_id));
+  }
+}
+
 SPECTRE_TEST_CASE(
     "Unit.NumericalAlgorithms.Interpolator.InterpolateEventNoInterpolator",
     "[Unit]") {
@@ -187,5 +446,7 @@ SPECTRE_TEST_CASE(
 
   // Off-center test
   run_test<MockMetavariables<false, false>, true>();
+
+  test_time_dependent_points();
 }
 }  // namespace
@@ -39,6 +39,7 @@
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
@@ -796,6 +797,10 @@ void run_test() {
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 2));
+  // Write out the buffered reduction data
+  ActionTesting::threaded_action<obs_writer,
+                                 observers::ThreadedActions::FlushReductionData>(
+      make_not_null(&runner), 0);
 
   // By hand compute integral(r^2 d(cos theta) dphi (2x+3y+5z)^2)
   const std::vector<double> expected_integral_a{2432.0 * M_PI / 3.0};
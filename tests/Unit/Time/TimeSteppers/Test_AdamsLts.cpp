@@ -26,6 +26,7 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Rational.hpp"
+#include "Utilities/Tracing.hpp"
 
 namespace {
 namespace adams_lts = TimeSteppers::adams_lts;
@@ -749,11 +750,136 @@ void test_lts_coefficients() {
   }
 }
 
+// The number of calls to lts_coefficients that computed the
+// coefficients, as reported by tracing.
+size_t number_of_cache_misses() {
+  size_t misses = 0;
+  for (const auto& event : tracing::summary()) {
+    if (event.name == "AdamsLts::CacheMiss") {
+      misses += event.count;
+    }
+  }
+  return misses;
+}
+
+void check_cache_misses(const size_t expected) {
+#ifdef SPECTRE_TRACING
+  CHECK(number_of_cache_misses() == expected);
+#else
+  CHECK(number_of_cache_misses() == 0);
+  (void)expected;
+#endif  // SPECTRE_TRACING
+}
+
+void test_lts_coefficients_cache() {
+  const Slab slab(0.0, 1.0);
+  const TimeDelta step = slab.duration() / 4;
+  const adams_lts::AdamsScheme ab1{adams_lts::SchemeType::Explicit, 1};
+  const adams_lts::AdamsScheme ab2{adams_lts::SchemeType::Explicit, 2};
+
+  // Two mortars with the same step pattern, where the remote side
+  // takes steps twice as large as the local side.
+  const auto make_history = [&]() {
+    TimeSteppers::BoundaryHistory<double, double, double> history{};
+    for (const int i : {0, 1, 2}) {
+      history.local().insert(TimeStepId(true, 0, slab.start() + i * step), 2,
+                             0.0);
+    }
+    for (const int i : {0, 2}) {
+      history.remote().insert(TimeStepId(true, 0, slab.start() + i * step), 2,
+                              0.0);
+    }
+    return history;
+  };
+  const auto history1 = make_history();
+  const auto history2 = make_history();
+  const Time start = slab.start() + 2 * step;
+  const Time end = start + step;
+
+  tracing::clear();
+  tracing::set_enabled(true);
+  adams_lts::reset_lts_coefficients_cache();
+  const auto coefficients1 = adams_lts::lts_coefficients(
+      history1.local(), history1.remote(), start, end, ab2, ab2, ab2);
+  check_cache_misses(1);
+  const auto coefficients2 = adams_lts::lts_coefficients(
+      history2.local(), history2.remote(), start, end, ab2, ab2, ab2);
+  check_cache_misses(1);
+  CHECK(coefficients2 == coefficients1);
+
+  // A different scheme or side is a different pattern
+  CHECK(adams_lts::lts_coefficients(history1.local(), history1.remote(),
+                                    start, end, ab1, ab1, ab1) !=
+        coefficients1);
+  check_cache_misses(2);
+  // NOLINTNEXTLINE(readability-suspicious-call-argument)
+  CHECK(adams_lts::lts_coefficients(history1.remote(), history1.local(),
+                                    start, end, ab2, ab2, ab2) !=
+        coefficients1);
+  check_cache_misses(3);
+
+  // Dense output is not cached
+  CHECK(adams_lts::lts_coefficients(history1.local(), history1.remote(),
+                                    start, ApproximateTime{start.value()},
+                                    ab2, ab2, ab2)
+            .empty());
+  const auto dense = adams_lts::lts_coefficients(
+      history1.local(), history1.remote(), start,
+      ApproximateTime{(start + step / 2).value()}, ab2, ab2, ab2);
+  CHECK(not dense.empty());
+  check_cache_misses(3);
+
+  adams_lts::reset_lts_coefficients_cache();
+  CHECK(adams_lts::lts_coefficients(history1.local(), history1.remote(),
+                                    start, end, ab2, ab2, ab2) ==
+        coefficients1);
+  check_cache_misses(4);
+
+  // Fill the cache with steps ending at different times and check
+  // that the least recently used entries are evicted first.
+  adams_lts::reset_lts_coefficients_cache();
+  tracing::clear();
+  constexpr size_t capacity = adams_lts::lts_coefficients_cache_capacity;
+  TimeSteppers::BoundaryHistory<double, double, double> gts_history{};
+  gts_history.local().insert(TimeStepId(true, 0, slab.start()), 1, 0.0);
+  gts_history.remote().insert(TimeStepId(true, 0, slab.start()), 1, 0.0);
+  const TimeDelta fill_step = slab.duration() / static_cast<int>(capacity + 1);
+  const auto coefficients_ending_at = [&](const size_t index) {
+    return adams_lts::lts_coefficients(
+        gts_history.local(), gts_history.remote(), slab.start(),
+        slab.start() + static_cast<int>(index + 1) * fill_step, ab1, ab1, ab1);
+  };
+  for (size_t index = 0; index < capacity; ++index) {
+    coefficients_ending_at(index);
+  }
+  check_cache_misses(capacity);
+  // Refresh the oldest entry
+  coefficients_ending_at(0);
+  check_cache_misses(capacity);
+  // Evicts the least recently used quarter, i.e., the entries with
+  // indices 1 to capacity / 4.
+  coefficients_ending_at(capacity);
+  check_cache_misses(capacity + 1);
+  coefficients_ending_at(0);
+  coefficients_ending_at(capacity / 4 + 1);
+  coefficients_ending_at(capacity - 1);
+  check_cache_misses(capacity + 1);
+  coefficients_ending_at(capacity / 4);
+  check_cache_misses(capacity + 2);
+  coefficients_ending_at(1);
+  check_cache_misses(capacity + 3);
+
+  tracing::set_enabled(false);
+  tracing::clear();
+  adams_lts::reset_lts_coefficients_cache();
+}
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsLts", "[Unit][Time]") {
   test_exact_substep_time();
   test_lts_coefficients_struct();
   test_apply_coefficients(0.0);
   test_apply_coefficients(DataVector(5, 0.0));
   test_lts_coefficients();
+  test_lts_coefficients_cache();
 }
 }  // namespace
@@ -0,0 +1,157 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Utilities/Tracing.hpp"
+
+namespace {
+struct TracedType {};
+
+size_t count_occurrences(const std::string& str, const std::string& pattern) {
+  size_t count = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+void test_summary() {
+  tracing::clear();
+  // Names are combined by value, not by address
+  const std::string other_name = "Event";
+  tracing::record("Event", 0, 3000);
+  tracing::record(other_name.c_str(), 10, 1010);
+  tracing::record(tracing::name<TracedType>(), 5, 7);
+  std::thread other_thread([]() { tracing::record("Event", 0, 2); });
+  other_thread.join();
+
+  const std::vector<tracing::Summary> summary = tracing::summary();
+  REQUIRE(summary.size() == 3);
+  CHECK(summary[0].name == "Event");
+  CHECK(summary[1].name == "Event");
+  CHECK(summary[0].thread != summary[1].thread);
+  const auto& main_thread_summary =
+      summary[0].count == 2 ? summary[0] : summary[1];
+  const auto& other_thread_summary =
+      summary[0].count == 2 ? summary[1] : summary[0];
+  CHECK(main_thread_summary.count == 2);
+  CHECK(main_thread_summary.total_seconds == approx(4.0e-6));
+  CHECK(main_thread_summary.min_seconds == approx(1.0e-6));
+  CHECK(main_thread_summary.max_seconds == approx(3.0e-6));
+  CHECK(other_thread_summary.count == 1);
+  CHECK(other_thread_summary.total_seconds == approx(2.0e-9));
+  CHECK(summary[2].name == "TracedType");
+  CHECK(summary[2].thread == main_thread_summary.thread);
+  CHECK(summary[2].count == 1);
+  CHECK(summary[2].min_seconds == approx(2.0e-9));
+
+  tracing::clear();
+  CHECK(tracing::summary().empty());
+}
+
+void test_chrome_trace() {
+  tracing::clear();
+  tracing::record("First\"", 1000, 3500);
+  tracing::record("Second", 4000, 5000);
+  std::ostringstream os{};
+  tracing::write_chrome_trace(os, 3);
+  const std::string trace = os.str();
+  CHECK(trace.find("{\"name\":\"First\\\"\",\"ph\":\"X\",\"ts\":1.000,"
+                   "\"dur\":2.500,\"pid\":3,") != std::string::npos);
+  CHECK(trace.find("{\"name\":\"Second\",\"ph\":\"X\",\"ts\":4.000,"
+                   "\"dur\":1.000,\"pid\":3,") != std::string::npos);
+  CHECK(trace.find("First") < trace.find("Second"));
+  CHECK(trace.substr(0, 15) == "{\"traceEvents\":");
+
+  // Only the most recent events are kept in the ring buffer, but all of them
+  // are in the summary
+  tracing::clear();
+  for (size_t i = 0; i < tracing::ring_buffer_size + 10; ++i) {
+    tracing::record(i < 10 ? "Old" : "New", 0, 1);
+  }
+  std::ostringstream wrapped_os{};
+  tracing::write_chrome_trace(wrapped_os, 0);
+  const std::string wrapped_trace = wrapped_os.str();
+  CHECK(count_occurrences(wrapped_trace, "\"Old\"") == 0);
+  CHECK(count_occurrences(wrapped_trace, "\"New\"") ==
+        tracing::ring_buffer_size);
+  const auto summary = tracing::summary();
+  REQUIRE(summary.size() == 2);
+  CHECK(summary[0].name == "New");
+  CHECK(summary[0].count == tracing::ring_buffer_size);
+  CHECK(summary[1].name == "Old");
+  CHECK(summary[1].count == 10);
+  tracing::clear();
+}
+
+void test_scopes() {
+  tracing::clear();
+  CHECK_FALSE(tracing::enabled());
+  {
+    SPECTRE_TRACE_SCOPE("Scope");
+    tracing::IdleTimer idle_timer{};
+    idle_timer.start(tracing::waiting_name<TracedType>());
+    idle_timer.stop();
+  }
+  CHECK(tracing::summary().empty());
+
+  tracing::set_enabled(true);
+  CHECK(tracing::enabled());
+  {
+    SPECTRE_TRACE_SCOPE("Scope");
+    SPECTRE_TRACE_SCOPE(tracing::name<TracedType>());
+    tracing::IdleTimer idle_timer{};
+    // Stopping a timer that is not running does nothing
+    idle_timer.stop();
+    idle_timer.start(tracing::waiting_name<TracedType>());
+    // Starting a running timer does not restart or rename it
+    idle_timer.start("Idle");
+    idle_timer.stop();
+    idle_timer.stop();
+  }
+  tracing::set_enabled(false);
+#ifdef SPECTRE_TRACING
+  const auto summary = tracing::summary();
+  REQUIRE(summary.size() == 3);
+  CHECK(summary[0].name == "Scope");
+  CHECK(summary[0].count == 1);
+  CHECK(summary[1].name == "TracedType");
+  CHECK(summary[1].count == 1);
+  CHECK(summary[2].name == "Waiting(TracedType)");
+  CHECK(summary[2].count == 1);
+  CHECK(summary[0].total_seconds >= summary[1].total_seconds);
+#else
+  CHECK(tracing::summary().empty());
+#endif  // SPECTRE_TRACING
+  tracing::clear();
+}
+
+void test_record_since() {
+  tracing::clear();
+  // A start taken with the system clock, e.g. on another process, 2ms ago
+  tracing::record_since("Latency", tracing::system_clock_now() - 2000000);
+  const auto summary = tracing::summary();
+  REQUIRE(summary.size() == 1);
+  CHECK(summary[0].name == "Latency");
+  CHECK(summary[0].count == 1);
+  CHECK(summary[0].total_seconds >= 2.0e-3);
+  // Generous bound so the test isn't flaky on a loaded machine
+  CHECK(summary[0].total_seconds < 1.0);
+  tracing::clear();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.Tracing", "[Utilities][Unit]") {
+  test_summary();
+  test_chrome_trace();
+  test_scopes();
+  test_record_since();
+}
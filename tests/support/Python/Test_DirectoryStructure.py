@@ -10,6 +10,7 @@ from spectre.Informer import unit_test_build_path
 from spectre.support.DirectoryStructure import (
     Checkpoint,
     Segment,
+    last_complete_checkpoint,
     list_checkpoints,
     list_segments,
 )
@@ -37,6 +38,20 @@ class TestDirectoryStructure(unittest.TestCase):
         checkpoint.path.mkdir()
         self.assertEqual(list_checkpoints(self.test_dir), [checkpoint])
 
+        # Without completion markers the last checkpoint is used
+        self.assertFalse(checkpoint.is_complete)
+        next_checkpoint = Checkpoint.match(self.test_dir / "Checkpoint_0003")
+        next_checkpoint.path.mkdir()
+        checkpoints = list_checkpoints(self.test_dir)
+        self.assertEqual(checkpoints, [checkpoint, next_checkpoint])
+        self.assertEqual(last_complete_checkpoint(checkpoints), next_checkpoint)
+        # Incomplete checkpoints are skipped once markers exist
+        (checkpoint.path / Checkpoint.COMPLETION_MARKER).touch()
+        self.assertTrue(checkpoint.is_complete)
+        self.assertEqual(last_complete_checkpoint(checkpoints), checkpoint)
+        (next_checkpoint.path / Checkpoint.COMPLETION_MARKER).touch()
+        self.assertEqual(last_complete_checkpoint(checkpoints), next_checkpoint)
+
     def test_segments(self):
         first_segment = Segment.first(self.test_dir)
         self.assertEqual(